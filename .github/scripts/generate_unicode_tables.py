@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# generate_unicode_tables.py
+# Writes src/unicode_tables.h, the character property and case mapping tables
+# used by the i18n_string_util character functions (e.g., is_space(), to_lower()).
+# The data comes from Python's unicodedata module, so rerun this with a newer
+# Python to update the tables to a newer version of Unicode:
+#
+#   python3 .github/scripts/generate_unicode_tables.py src/unicode_tables.h
+
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+MAX_CODE_POINT = 0x110000
+
+SPACE, PUNCTUATION, ALPHA, DIGIT, UPPER, LOWER = 1, 2, 4, 8, 16, 32
+# like iswspace(), the no-break spaces aren't treated as spaces
+NO_BREAK_SPACES = {0x00A0, 0x2007, 0x202F}
+
+
+def properties(cp):
+    ch = chr(cp)
+    category = unicodedata.category(ch)
+    flags = 0
+    if (cp in (0x09, 0x0A, 0x0B, 0x0C, 0x0D) or category in ("Zs", "Zl", "Zp")) and \
+            cp not in NO_BREAK_SPACES:
+        flags |= SPACE
+    if category[0] in "PS":
+        flags |= PUNCTUATION
+    if category[0] == "L":
+        flags |= ALPHA
+    if category == "Nd":
+        flags |= DIGIT
+    if category in ("Lu", "Lt"):
+        flags |= UPPER
+    if category == "Ll":
+        flags |= LOWER
+    return flags
+
+
+def simple_lower(cp):
+    lowered = chr(cp).lower()
+    # U+0130's full mapping adds a combining dot, its simple mapping is just 'i'
+    return ord(lowered[0]) if len(lowered) == 1 or cp == 0x130 else cp
+
+
+def simple_upper(cp):
+    uppered = chr(cp).upper()
+    if len(uppered) == 1:
+        return ord(uppered)
+    # full mappings that expand (e.g., U+1F80) have a single character titlecase
+    titled = chr(cp).title()
+    return ord(titled) if len(titled) == 1 else cp
+
+
+def case_delta(cp, mapped):
+    # mappings stay within a plane, so only the low 16 bits are stored
+    assert (cp >> 16) == (mapped >> 16)
+    return (mapped - cp) & 0xFFFF
+
+
+def build_table(values, limit):
+    """Splits values into deduplicated blocks, returning the block index and the blocks."""
+    blocks = {}
+    index = []
+    for start in range(0, limit, BLOCK_SIZE):
+        block = tuple(values[start:start + BLOCK_SIZE])
+        index.append(blocks.setdefault(block, len(blocks)))
+    return index, [value for block in blocks for value in block]
+
+
+def table_limit(values):
+    """The end of the last block with a non-zero value."""
+    last = max(cp for cp, value in enumerate(values) if value != 0)
+    return ((last >> BLOCK_SHIFT) + 1) << BLOCK_SHIFT
+
+
+def format_array(name, value_type, values, per_line):
+    lines = ["    inline constexpr std::array<%s, %d> %s{" % (value_type, len(values), name)]
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append("        " + ",".join(str(value) for value in chunk) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("    };")
+    return "\n".join(lines)
+
+
+def main():
+    output = sys.argv[1] if len(sys.argv) > 1 else "src/unicode_tables.h"
+
+    props = [properties(cp) for cp in range(MAX_CODE_POINT)]
+    lowers = [case_delta(cp, simple_lower(cp)) for cp in range(MAX_CODE_POINT)]
+    uppers = [case_delta(cp, simple_upper(cp)) for cp in range(MAX_CODE_POINT)]
+
+    props_limit = table_limit(props)
+    case_limit = max(table_limit(lowers), table_limit(uppers))
+    props_index, props_blocks = build_table(props, props_limit)
+    lower_index, lower_blocks = build_table(lowers, case_limit)
+    upper_index, upper_blocks = build_table(uppers, case_limit)
+    # the ASCII fast path reads the first block directly
+    assert props_index[0] == 0 and lower_index[0] == 0 and upper_index[0] == 0
+    assert max(props_index + lower_index + upper_index) < 256
+
+    with open(output, "w", encoding="utf-8", newline="\n") as header:
+        header.write("""/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+// Generated by .github/scripts/generate_unicode_tables.py from Unicode %s; do not edit.
+
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <array>
+#include <cstdint>
+
+// clang-format off
+/// @private
+namespace i18n_string_util::unicode_tables
+    {
+    /// @brief Property flags for a code point.
+    enum property : uint8_t
+        {
+        /// @brief White space (other than no-break spaces).
+        space = %d,
+        /// @brief Punctuation or a symbol (i.e., general categories P* and S*).
+        punctuation = %d,
+        /// @brief A letter (i.e., general category L*).
+        alpha = %d,
+        /// @brief A decimal digit (i.e., general category Nd).
+        digit = %d,
+        /// @brief An uppercase or titlecase letter (i.e., general categories Lu and Lt).
+        upper = %d,
+        /// @brief A lowercase letter (i.e., general category Ll).
+        lower = %d
+        };
+
+    /// @brief The code points in each block of a table.
+    inline constexpr uint32_t BLOCK_SHIFT{ %d };
+    /// @brief The code points after the last one with any properties.
+    inline constexpr uint32_t PROPERTY_LIMIT{ 0x%X };
+    /// @brief The code points after the last one with a case mapping.
+    inline constexpr uint32_t CASE_MAPPING_LIMIT{ 0x%X };
+
+    /// @brief The property block for each block of code points.
+%s
+
+    /// @brief Deduplicated blocks of property flags.
+%s
+
+    /// @brief The lowercase mapping block for each block of code points.
+%s
+
+    /// @brief Deduplicated blocks of lowercase mappings
+    ///     (the distance to the mapping, within the same plane).
+%s
+
+    /// @brief The uppercase mapping block for each block of code points.
+%s
+
+    /// @brief Deduplicated blocks of uppercase mappings
+    ///     (the distance to the mapping, within the same plane).
+%s
+    } // namespace i18n_string_util::unicode_tables
+// clang-format on
+
+/** @}*/
+
+#endif // UNICODE_TABLES_H
+""" % (unicodedata.unidata_version, SPACE, PUNCTUATION, ALPHA, DIGIT, UPPER, LOWER,
+       BLOCK_SHIFT, props_limit, case_limit,
+       format_array("PROPERTY_INDEX", "uint8_t", props_index, 22),
+       format_array("PROPERTY_BLOCKS", "uint8_t", props_blocks, 22),
+       format_array("LOWER_INDEX", "uint8_t", lower_index, 22),
+       format_array("LOWER_BLOCKS", "uint16_t", lower_blocks, 15),
+       format_array("UPPER_INDEX", "uint8_t", upper_index, 22),
+       format_array("UPPER_BLOCKS", "uint16_t", upper_blocks, 15)))
+
+
+if __name__ == "__main__":
+    main()
@@ -16,9 +16,15 @@
 #include "i18n_string_util.h"
 #include "unicode_extract_text.h"
 #include "utfcpp/source/utf8.h"
+#include <algorithm>
+#include <charconv>
 #include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
 #ifdef wxVERSION_NUMBER
-    #include <wx/file.h>
+    #include <wx/convauto.h>
+    #include <wx/string.h>
 #endif
 
 namespace i18n_check
@@ -117,6 +123,56 @@ namespace i18n_check
         return std::make_pair(true, buffer);
         }
 
+    //------------------------------------------------------
+    std::pair<bool, std::wstring> decode_content(std::string_view content, bool& startsWithBom)
+        {
+        startsWithBom = utf8::starts_with_bom(content.cbegin(), content.cend());
+        if (utf8::is_valid(std::next(content.cbegin(),
+                                     startsWithBom ? std::size(utf8::bom) : 0),
+                           content.cend()))
+            {
+            // the signature is kept (as U+FEFF), the same as when files were read by line
+            std::u16string utf16Text;
+            utf16Text.reserve(content.length());
+            utf8::utf8to16(content.cbegin(), content.cend(), std::back_inserter(utf16Text));
+            std::wstring text;
+            text.reserve(utf16Text.length() + 1);
+            for (const auto& ch : utf16Text)
+                {
+                text += static_cast<wchar_t>(ch);
+                }
+            // files were read by line, so the last line always ends with a newline
+            if (!text.empty() && text.back() != L'\n')
+                {
+                text += L'\n';
+                }
+            return std::make_pair(true, std::move(text));
+            }
+
+        if (content.length() >= 2 &&
+            lily_of_the_valley::unicode_extract_text::is_unicode(content.data()))
+            {
+            lily_of_the_valley::unicode_extract_text uExtract;
+            uExtract(content.data(), content.length(),
+                     lily_of_the_valley::unicode_extract_text::is_little_endian(content.data()));
+            return std::make_pair(false, std::wstring{ uExtract.get_filtered_text() });
+            }
+
+        // ANSI
+#ifdef wxVERSION_NUMBER
+        const wxString text(content.data(), wxConvAuto{}, content.length());
+        return std::make_pair(false, std::wstring{ text.wc_str() });
+#else
+        std::wstring text;
+        text.reserve(content.length());
+        for (const auto& ch : content)
+            {
+            text += static_cast<wchar_t>(static_cast<unsigned char>(ch));
+            }
+        return std::make_pair(false, std::move(text));
+#endif
+        }
+
     //------------------------------------------------------
     void batch_analyze::pseudo_translate(const std::vector<std::filesystem::path>& filesToTranslate,
                                          i18n_check::pseudo_translation_method pseudoMethod,
@@ -215,9 +271,7 @@ namespace i18n_check
         }
 
     //------------------------------------------------------
-    void batch_analyze::analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
-                                const analyze_callback_reset& resetCallback,
-                                const analyze_callback& callback)
+    void batch_analyze::begin_batch(const size_t fileCount)
         {
         m_filesThatShouldBeConvertedToUTF8.clear();
         m_filesThatContainUTF8Signature.clear();
@@ -225,9 +279,140 @@ namespace i18n_check
         m_rc->clear_results();
         m_plist->clear_results();
         m_po->clear_results();
+        m_mo->clear_results();
         m_csharp->clear_results();
         m_quarto->clear_results();
-        m_lastBatchSize = filesToAnalyze.size();
+        m_lastBatchSize = fileCount;
+
+        if (m_catalogResultsCallback)
+            {
+            m_catalogResultsCallback(format_column_headers());
+            m_po->stream_catalog_entries(
+                [this](const auto& catEntry)
+                {
+                    std::wstringstream entryResults;
+                    format_catalog_entry(entryResults, catEntry);
+                    if (const std::wstring results{ entryResults.str() }; !results.empty())
+                        {
+                        m_catalogResultsCallback(results);
+                        }
+                });
+            }
+        else
+            {
+            m_po->stream_catalog_entries(nullptr);
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::load_text(const file_review_type fileType, const std::wstring& text,
+                                  const std::filesystem::path& file)
+        {
+        if (fileType == file_review_type::rc)
+            {
+            (*m_rc)(text, file);
+            }
+        else if (fileType == file_review_type::infoplist)
+            {
+            (*m_plist)(text, file);
+            }
+        else if (fileType == file_review_type::po)
+            {
+            (*m_po)(text, file);
+            }
+        else if (fileType == file_review_type::cs)
+            {
+            (*m_csharp)(text, file);
+            }
+        else if (fileType == file_review_type::quarto)
+            {
+            (*m_quarto)(text, file);
+            }
+        else
+            {
+            (*m_cpp)(text, file);
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::load_content(const file_review_type fileType, std::string_view content,
+                                     const std::filesystem::path& file)
+        {
+        bool startsWithBom{ false };
+        const auto [isUtf8, text] = decode_content(content, startsWithBom);
+        if (isUtf8)
+            {
+            if (startsWithBom && ((m_cpp->get_style() & check_utf8_with_signature) != 0))
+                {
+                m_filesThatContainUTF8Signature.push_back(file);
+                }
+            }
+        // UTF-16 or ANSI may not be supported consistently on
+        // all platforms and compilers.
+        // RC files are usually encoded in ANSI given their age,
+        // so don't check those files.
+        else if (fileType != file_review_type::rc &&
+                 ((m_cpp->get_style() & check_utf8_encoded) != 0))
+            {
+            m_filesThatShouldBeConvertedToUTF8.push_back(file);
+            }
+        load_text(fileType, text, file);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::load_file(const std::filesystem::path& file)
+        {
+        const file_review_type fileType = get_file_type(file);
+
+        try
+            {
+            // compiled catalogs are binary, so they are mapped and read directly
+            if (fileType == file_review_type::mo)
+                {
+                m_mo->load_file(file);
+                return;
+                }
+
+            std::ifstream ifs(file, std::ios::binary);
+            if (!ifs.is_open())
+                {
+                std::wcout << L"Could not open " << file << L"\n";
+                return;
+                }
+            const std::string content((std::istreambuf_iterator<char>(ifs)),
+                                      std::istreambuf_iterator<char>());
+            load_content(fileType, content, file);
+            }
+        catch (const std::exception& expt)
+            {
+            m_logReport.append(i18n_string_util::lazy_string_to_wstring(expt.what())).append(L"\n");
+            std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::review_loaded_files(const analyze_callback_reset& resetCallback,
+                                            const analyze_callback& callback)
+        {
+        try
+            {
+            m_cpp->review_strings(resetCallback, callback);
+            m_po->review_strings(resetCallback, callback);
+            m_mo->review_strings(resetCallback, callback);
+            }
+        catch (const std::exception& expt)
+            {
+            m_logReport.append(i18n_string_util::lazy_string_to_wstring(expt.what())).append(L"\n");
+            std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
+                                const analyze_callback_reset& resetCallback,
+                                const analyze_callback& callback)
+        {
+        begin_batch(filesToAnalyze.size());
 
         size_t currentFileIndex{ 0 };
 
@@ -240,130 +425,94 @@ namespace i18n_check
                 return;
                 }
 
+            load_file(file);
+            }
+
+        // analyze the content
+        review_loaded_files(resetCallback, callback);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::analyze_changes(const std::vector<std::filesystem::path>& changedFiles,
+                                        const std::vector<std::filesystem::path>& removedFiles,
+                                        const analyze_callback_reset& resetCallback,
+                                        const analyze_callback& callback)
+        {
+        for (const auto& file : removedFiles)
+            {
+            clear_file_results(file);
+            }
+        for (const auto& file : changedFiles)
+            {
+            clear_file_results(file);
+            }
+
+        size_t currentFileIndex{ 0 };
+
+        resetCallback(changedFiles.size());
+        // load the changed files' content into analyzers
+        for (const auto& file : changedFiles)
+            {
+            if (!callback(++currentFileIndex, file))
+                {
+                return;
+                }
+
+            load_file(file);
+            }
+
+        // review only the newly loaded content
+        review_loaded_files(resetCallback, callback);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::clear_file_results(const std::filesystem::path& file)
+        {
+        std::erase(m_filesThatShouldBeConvertedToUTF8, file);
+        std::erase(m_filesThatContainUTF8Signature, file);
+        m_cpp->clear_file_results(file);
+        m_rc->clear_file_results(file);
+        m_plist->clear_file_results(file);
+        m_po->clear_file_results(file);
+        m_mo->clear_file_results(file);
+        m_csharp->clear_file_results(file);
+        m_quarto->clear_file_results(file);
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::analyze_buffers(const std::vector<file_buffer>& buffersToAnalyze,
+                                        const analyze_callback_reset& resetCallback,
+                                        const analyze_callback& callback)
+        {
+        begin_batch(buffersToAnalyze.size());
+
+        size_t currentFileIndex{ 0 };
+
+        resetCallback(buffersToAnalyze.size());
+        // load the buffers into the analyzers, decoding them the same way as files
+        for (const auto& [file, content] : buffersToAnalyze)
+            {
+            if (!callback(++currentFileIndex, file))
+                {
+                return;
+                }
+
             const file_review_type fileType = get_file_type(file);
+            // not a file type that can be reviewed (rather than guessing that it's source code)
+            if (fileType == file_review_type::unknown)
+                {
+                continue;
+                }
 
             try
                 {
-                bool startsWithBom{ false };
-                if (const auto [readUtf8Ok, fileUtf8Text] = read_utf8_file(file, startsWithBom);
-                    readUtf8Ok)
+                if (fileType == file_review_type::mo)
                     {
-                    if (startsWithBom && ((m_cpp->get_style() & check_utf8_with_signature) != 0))
-                        {
-                        m_filesThatContainUTF8Signature.push_back(file);
-                        }
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::infoplist)
-                        {
-                        (*m_plist)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(fileUtf8Text, file);
-                        }
-                    else if (fileType == file_review_type::quarto)
-                        {
-                        (*m_quarto)(fileUtf8Text, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(fileUtf8Text, file);
-                        }
-                    }
-                else if (const auto [readUtf16Ok, fileUtf16Text] = read_utf16_file(file);
-                         readUtf16Ok)
-                    {
-                    // UTF-16 or ANSI may not be supported consistently on
-                    // all platforms and compilers.
-                    // RC files are usually encoded in ANSI given their age,
-                    // so don't check those files.
-                    if (fileType != file_review_type::rc &&
-                        ((m_cpp->get_style() & check_utf8_encoded) != 0))
-                        {
-                        m_filesThatShouldBeConvertedToUTF8.push_back(file);
-                        }
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::infoplist)
-                        {
-                        (*m_plist)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(fileUtf16Text, file);
-                        }
-                    else if (fileType == file_review_type::quarto)
-                        {
-                        (*m_quarto)(fileUtf16Text, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(fileUtf16Text, file);
-                        }
+                    m_mo->load_catalog(content, file);
                     }
                 else
                     {
-                    if (fileType != file_review_type::rc &&
-                        ((m_cpp->get_style() & check_utf8_encoded) != 0))
-                        {
-                        m_filesThatShouldBeConvertedToUTF8.push_back(file);
-                        }
-#ifdef wxVERSION_NUMBER
-                    const std::wstring str = [&file]()
-                    {
-                        wxFile ifs(file.wstring());
-                        wxString fileContents;
-                        if (ifs.IsOpened())
-                            {
-                            if (ifs.ReadAll(&fileContents))
-                                {
-                                return std::wstring{ fileContents.wc_str() };
-                                }
-                            }
-                        return std::wstring{};
-                    }();
-#else
-                    std::wifstream ifs(file);
-                    const std::wstring str((std::istreambuf_iterator<wchar_t>(ifs)),
-                                           std::istreambuf_iterator<wchar_t>());
-#endif
-                    if (fileType == file_review_type::rc)
-                        {
-                        (*m_rc)(str, file);
-                        }
-                    else if (fileType == file_review_type::infoplist)
-                        {
-                        (*m_plist)(str, file);
-                        }
-                    else if (fileType == file_review_type::po)
-                        {
-                        (*m_po)(str, file);
-                        }
-                    else if (fileType == file_review_type::cs)
-                        {
-                        (*m_csharp)(str, file);
-                        }
-                    else if (fileType == file_review_type::quarto)
-                        {
-                        (*m_quarto)(str, file);
-                        }
-                    else
-                        {
-                        (*m_cpp)(str, file);
-                        }
+                    load_content(fileType, content, file);
                     }
                 }
             catch (const std::exception& expt)
@@ -375,16 +524,62 @@ namespace i18n_check
             }
 
         // analyze the content
-        try
+        review_loaded_files(resetCallback, callback);
+        }
+
+    //------------------------------------------------------
+    std::vector<batch_analyze::file_buffer>
+    batch_analyze::read_file_buffers(std::string_view records)
+        {
+        std::vector<file_buffer> buffers;
+        while (!records.empty())
             {
-            m_cpp->review_strings(resetCallback, callback);
-            m_po->review_strings(resetCallback, callback);
-            }
-        catch (const std::exception& expt)
+            // the path and the length of the content are each on their own line
+            const size_t pathEnd{ records.find('\n') };
+            const size_t lengthEnd{ pathEnd == std::string_view::npos ?
+                                        std::string_view::npos :
+                                        records.find('\n', pathEnd + 1) };
+            if (lengthEnd == std::string_view::npos)
+                {
+                throw std::runtime_error("File record is missing its path or content length.");
+                }
+            // (either line can end with CRLF, but the content is taken as-is)
+            const auto trimCarriageReturn = [](std::string_view line)
             {
-            m_logReport.append(i18n_string_util::lazy_string_to_wstring(expt.what())).append(L"\n");
-            std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+                if (line.ends_with('\r'))
+                    {
+                    line.remove_suffix(1);
+                    }
+                return line;
+            };
+            const std::string_view pathText{ trimCarriageReturn(records.substr(0, pathEnd)) };
+            const std::string_view lengthText{ trimCarriageReturn(
+                records.substr(pathEnd + 1, lengthEnd - pathEnd - 1)) };
+            size_t contentLength{ 0 };
+            const auto [lengthParseEnd, lengthError] = std::from_chars(
+                lengthText.data(), lengthText.data() + lengthText.length(), contentLength);
+            if (pathText.empty() || lengthError != std::errc{} ||
+                lengthParseEnd != lengthText.data() + lengthText.length() ||
+                contentLength > records.length() - lengthEnd - 1)
+                {
+                throw std::runtime_error("File record has an invalid path or content length.");
+                }
+            buffers.emplace_back(
+                std::filesystem::path{ std::u8string_view{
+                    reinterpret_cast<const char8_t*>(pathText.data()), pathText.length() } },
+                std::string{ records.substr(lengthEnd + 1, contentLength) });
+            records.remove_prefix(lengthEnd + 1 + contentLength);
+            // records can optionally be separated by a newline
+            if (records.starts_with('\n'))
+                {
+                records.remove_prefix(1);
+                }
+            else if (records.starts_with("\r\n"))
+                {
+                records.remove_prefix(2);
+                }
             }
+        return buffers;
         }
 
     //------------------------------------------------------
@@ -473,25 +668,36 @@ namespace i18n_check
                << _(L"String table entries within Windows resource files: ")
                << m_rc->get_localizable_strings().size() << L"\n"
                << _(L"Translation entries within PO message catalog files: ")
-               << m_po->get_catalog_entries().size() << L"\n";
+               << m_po->get_catalog_entries().size() + m_po->get_streamed_entry_count() << L"\n"
+               << _(L"Translation entries within MO message catalog files: ")
+               << m_mo->get_catalog_entries().size() << L"\n";
+
+        // how often a string's check verdicts were reused from an earlier occurrence of it
+        const auto formatCacheHitRate =
+            [&report](const i18n_review& reviewer, const std::wstring_view label)
+        {
+            if (reviewer.is_verbose() && reviewer.get_string_classification_lookups() > 0)
+                {
+                report << label
+                       << (reviewer.get_string_classification_cache_hits() * 100) /
+                              reviewer.get_string_classification_lookups()
+                       << L"% (" << reviewer.get_string_classification_cache_hits() << L"/"
+                       << reviewer.get_string_classification_lookups() << L")\n";
+                }
+        };
+        formatCacheHitRate(
+            *m_cpp, _WXTRANS_WSTR(L"String check cache hit rate within C/C++ source files: "));
+        formatCacheHitRate(
+            *m_csharp, _WXTRANS_WSTR(L"String check cache hit rate within C# source files: "));
 
         return report;
         }
 
     //------------------------------------------------------
-    std::wstringstream batch_analyze::format_results(const bool verbose /*= false*/) const
+    std::wstring batch_analyze::format_column_headers()
         {
-        const auto replaceSpecialSpaces = [](const std::wstring& str)
-        {
-            auto newStr{ str };
-            string_util::replace_all(newStr, L'\t', L' ');
-            string_util::replace_all(newStr, L'\n', L' ');
-            string_util::replace_all(newStr, L'\r', L' ');
-            return newStr;
-        };
-
-        std::wstringstream report;
-        report << // TRANSLATORS: Column header in output
+        std::wstringstream header;
+        header << // TRANSLATORS: Column header in output
             _("File") << L"\t" <<
             // TRANSLATORS: Column header in output
             _(L"Line") << L"\t" <<
@@ -503,6 +709,250 @@ namespace i18n_check
             _(L"Explanation") << L"\t" <<
             // TRANSLATORS: Column header in output
             _(L"Warning ID") << L"\n";
+        return header.str();
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::format_catalog_entry(
+        std::wostream& report,
+        const std::pair<std::filesystem::path, translation_catalog_entry>& catEntry)
+        {
+        for (const auto& issue : catEntry.second.m_issues)
+            {
+            format_catalog_issue(report, catEntry, issue);
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::format_catalog_issue(
+        std::wostream& report,
+        const std::pair<std::filesystem::path, translation_catalog_entry>& catEntry,
+        const std::pair<translation_issue, std::wstring>& issue, const size_t catalogCount /*= 1*/)
+        {
+        std::wstringstream catalogNote;
+        if (catalogCount > 1)
+            {
+            catalogNote << L" (" << _(L"Catalogs with this issue: ") << catalogCount << L")";
+            }
+
+        if (issue.first == translation_issue::printf_issue)
+            {
+            report
+                << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                << issue.second << L"\"\t\""
+                << _(L"Mismatching printf command between source and "
+                     "translation strings.")
+                << catalogNote.str() << "\"\t[printfMismatch]\n";
+            }
+        else if (issue.first == translation_issue::suspect_source_issue)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"String available for translation that probably should "
+                        "not be, or contains a hard-coded URL or email address.")
+                   << catalogNote.str() << "\"\t[suspectL10NString]\n";
+            }
+        else if (issue.first == translation_issue::excessive_nonl10n_content)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"String available for translation that contains a "
+                        "large amount of non-translatable content.")
+                   << catalogNote.str() << "\"\t[excessiveNonL10NContent]\n";
+            }
+        else if (issue.first == translation_issue::malformed_translation)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"String available for translation that is possibly malformed.")
+                   << catalogNote.str() << "\"\t[malformedString]\n";
+            }
+        else if (issue.first == translation_issue::concatenation_issue)
+            {
+            report
+                << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                << issue.second << L"\"\t\""
+                << _(L"String available for translation that may be getting "
+                     "concatenated at runtime with other content.")
+                << catalogNote.str() << "\"\t[concatenatedStrings]\n";
+            }
+        else if (issue.first == translation_issue::source_needing_context_issue)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"Ambiguous string available for translation that is "
+                        "lacking a translator comment.")
+                   << catalogNote.str() << "\"\t[L10NStringNeedsContext]\n";
+            }
+        else if (issue.first == translation_issue::multipart_string)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"String available for translation may contain multiple "
+                        "sections being sliced at runtime. Consider splitting each "
+                        "section into a separate resource.")
+                   << catalogNote.str() << "\"\t[multipartString]\n";
+            }
+        else if (issue.first == translation_issue::article_issue)
+            {
+            report
+                << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                << issue.second << L"\"\t\""
+                << _(L"An article is proceeding dynamic content, or a pronoun is "
+                     "being formatted into a larger message. It is recommended to "
+                     "create multiple versions of this string for all possible "
+                     "contexts instead of using dynamic placeholders.")
+                << catalogNote.str() << "\"\t[articleOrPronoun]\n";
+            }
+        else if (issue.first == translation_issue::pluralization)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"The same string is used for singular and plural situations. "
+                        "Consider using a pluralizing function (if available) or "
+                        "reword the message.")
+                   << catalogNote.str() << "\"\t[pluralization]\n";
+            }
+        else if (issue.first == translation_issue::accelerator_issue)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"Mismatching keyboard accelerators between source "
+                        "and translation strings.")
+                   << catalogNote.str() << "\"\t[acceleratorMismatch]\n";
+            }
+        else if (issue.first == translation_issue::number_issue)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"Mismatching numbers between source "
+                        "and translation strings.")
+                   << catalogNote.str() << "\"\t[numberInconsistency]\n";
+            }
+        else if (issue.first == translation_issue::length_issue)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"Translation is suspiciously longer than the source string.")
+                   << catalogNote.str() << "\"\t[lengthInconsistency]\n";
+            }
+        else if (issue.first == translation_issue::consistency_issue)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\t\""
+                   << issue.second << catalogNote.str() << "\"\t[transInconsistency]\n";
+            }
+        else if (issue.first == translation_issue::halfwidth)
+            {
+            report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
+                   << issue.second << L"\"\t\""
+                   << _(L"Halfwidth characters detected. "
+                        "Fullwidth characters are recommended.")
+                   << catalogNote.str() << "\"\t[halfWidth]\n";
+            }
+        }
+
+    //------------------------------------------------------
+    void batch_analyze::format_catalog_entries_by_message(std::wostream& report) const
+        {
+        using catalog_entry = std::pair<std::filesystem::path, translation_catalog_entry>;
+        using catalog_issue = std::pair<translation_issue, std::wstring>;
+
+        // the entries for each message (across all catalogs),
+        // in the order that the messages were first found
+        std::vector<std::vector<const catalog_entry*>> messages;
+        std::unordered_map<std::wstring, size_t> messageIndices;
+        std::wstring messageKey;
+        for (const translation_catalog_review* catalog :
+             { static_cast<const translation_catalog_review*>(m_po),
+               static_cast<const translation_catalog_review*>(m_mo) })
+            {
+            for (const auto& catEntry : catalog->get_catalog_entries())
+                {
+                // (the same key that the source issues were shared by)
+                translation_catalog_review::get_source_key(catEntry.second, messageKey);
+                const auto [messageIndex, isNewMessage] =
+                    messageIndices.try_emplace(messageKey, messages.size());
+                if (isNewMessage)
+                    {
+                    messages.emplace_back();
+                    }
+                messages[messageIndex->second].push_back(&catEntry);
+                }
+            }
+
+        // the message's source issues, the first entry that has each one,
+        // and the catalogs that have it (a catalog can have the message more than once)
+        std::vector<std::tuple<const catalog_issue*, const catalog_entry*,
+                               std::vector<const std::filesystem::path*>>>
+            sourceIssues;
+        for (const auto& messageEntries : messages)
+            {
+            sourceIssues.clear();
+            for (const auto* catEntry : messageEntries)
+                {
+                for (const auto& issue : catEntry->second.m_issues)
+                    {
+                    if (!translation_catalog_review::is_source_issue(issue.first))
+                        {
+                        continue;
+                        }
+                    const auto sourceIssue =
+                        std::find_if(sourceIssues.begin(), sourceIssues.end(),
+                                     [&issue](const auto& reportedIssue)
+                                     { return *std::get<0>(reportedIssue) == issue; });
+                    if (sourceIssue == sourceIssues.end())
+                        {
+                        sourceIssues.emplace_back(
+                            &issue, catEntry,
+                            std::vector<const std::filesystem::path*>{ &catEntry->first });
+                        }
+                    else if (auto& catalogs = std::get<2>(*sourceIssue);
+                             std::none_of(catalogs.cbegin(), catalogs.cend(),
+                                          [catEntry](const auto* catalog)
+                                          { return *catalog == catEntry->first; }))
+                        {
+                        catalogs.push_back(&catEntry->first);
+                        }
+                    }
+                }
+
+            // report each source issue once...
+            for (const auto& [issue, catEntry, catalogs] : sourceIssues)
+                {
+                format_catalog_issue(report, *catEntry, *issue, catalogs.size());
+                }
+            // ...followed by the issues with each catalog's translations
+            for (const auto* catEntry : messageEntries)
+                {
+                for (const auto& issue : catEntry->second.m_issues)
+                    {
+                    if (!translation_catalog_review::is_source_issue(issue.first))
+                        {
+                        format_catalog_issue(report, *catEntry, issue);
+                        }
+                    }
+                }
+            }
+        }
+
+    //------------------------------------------------------
+    std::wstringstream batch_analyze::format_results(const bool verbose /*= false*/) const
+        {
+        const auto replaceSpecialSpaces = [](const std::wstring& str)
+        {
+            auto newStr{ str };
+            string_util::replace_all(newStr, L'\t', L' ');
+            string_util::replace_all(newStr, L'\n', L' ');
+            string_util::replace_all(newStr, L'\r', L' ');
+            return newStr;
+        };
+
+        std::wstringstream report;
+        // (if streaming, these were already written before the catalog results)
+        if (!m_catalogResultsCallback)
+            {
+            report << format_column_headers();
+            }
 
         // Windows resource file warnings
         for (const auto& val : m_rc->get_unsafe_localizable_strings())
@@ -669,123 +1119,19 @@ namespace i18n_check
             }
 
         // gettext catalogs
-        for (const auto& catEntry : m_po->get_catalog_entries())
+        if (m_groupCatalogResultsByMessage)
+            {
+            format_catalog_entries_by_message(report);
+            }
+        else
             {
-            for (const auto& issue : catEntry.second.m_issues)
+            for (const auto& catEntry : m_po->get_catalog_entries())
                 {
-                if (issue.first == translation_issue::printf_issue)
-                    {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"Mismatching printf command between source and translation strings.")
-                        << "\"\t[printfMismatch]\n";
-                    }
-                else if (issue.first == translation_issue::suspect_source_issue)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that probably should not be, or "
-                                "contains a hard-coded URL or email address.")
-                           << "\"\t[suspectL10NString]\n";
-                    }
-                else if (issue.first == translation_issue::excessive_nonl10n_content)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that contains a "
-                                "large amount of non-translatable content.")
-                           << "\"\t[excessiveNonL10NContent]\n";
-                    }
-                else if (issue.first == translation_issue::malformed_translation)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation that is possibly malformed.")
-                           << "\"\t[malformedString]\n";
-                    }
-                else if (issue.first == translation_issue::concatenation_issue)
-                    {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"String available for translation that may be getting concatenated "
-                             "at runtime with other content.")
-                        << "\"\t[concatenatedStrings]\n";
-                    }
-                else if (issue.first == translation_issue::source_needing_context_issue)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Ambiguous string available for translation that is "
-                                "lacking a translator comment.")
-                           << "\"\t[L10NStringNeedsContext]\n";
-                    }
-                else if (issue.first == translation_issue::multipart_string)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"String available for translation may contain multiple sections "
-                                "being sliced at runtime. Consider splitting each section into "
-                                "a separate resource.")
-                           << "\"\t[multipartString]\n";
-                    }
-                else if (issue.first == translation_issue::article_issue)
-                    {
-                    report
-                        << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                        << issue.second << L"\"\t\""
-                        << _(L"An article is proceeding dynamic content, or a pronoun is being "
-                             "formatted into a larger message. It is recommended to create "
-                             "multiple versions of this string for all possible contexts instead "
-                             "of using dynamic placeholders.")
-                        << "\"\t[articleOrPronoun]\n";
-                    }
-                else if (issue.first == translation_issue::pluralization)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"The same string is used for singular and plural situations. "
-                                "Consider using a pluralizing function (if available) or "
-                                "reword the message.")
-                           << "\"\t[pluralization]\n";
-                    }
-                else if (issue.first == translation_issue::accelerator_issue)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching keyboard accelerators between source "
-                                "and translation strings.")
-                           << "\"\t[acceleratorMismatch]\n";
-                    }
-                else if (issue.first == translation_issue::number_issue)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Mismatching numbers between source "
-                                "and translation strings.")
-                           << "\"\t[numberInconsistency]\n";
-                    }
-                else if (issue.first == translation_issue::length_issue)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Translation is suspiciously longer than the source string.")
-                           << "\"\t[lengthInconsistency]\n";
-                    }
-                else if (issue.first == translation_issue::consistency_issue)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\t\""
-                           << issue.second << "\"\t[transInconsistency]\n";
-                    }
-                else if (issue.first == translation_issue::halfwidth)
-                    {
-                    report << catEntry.first << L"\t" << catEntry.second.m_line << L"\t\t\""
-                           << issue.second << L"\"\t\""
-                           << _(L"Halfwidth characters detected. "
-                                "Fullwidth characters are recommended.")
-                           << "\"\t[halfWidth]\n";
-                    }
+                format_catalog_entry(report, catEntry);
+                }
+            for (const auto& catEntry : m_mo->get_catalog_entries())
+                {
+                format_catalog_entry(report, catEntry);
                 }
             }
 
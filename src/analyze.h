@@ -21,6 +21,7 @@
 #include "cpp_i18n_review.h"
 #include "csharp_i18n_review.h"
 #include "info_plist_review.h"
+#include "mo_file_review.h"
 #include "po_file_review.h"
 #include "pseudo_translate.h"
 #include "quarto_review.h"
@@ -35,8 +36,11 @@
 #endif
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace i18n_check
@@ -48,6 +52,14 @@ namespace i18n_check
     /// @private
     std::pair<bool, std::wstring> read_utf8_file(const std::filesystem::path& filePath,
                                                  bool& startsWithBom);
+    /** @brief Decodes a file's content, which may be UTF-8 (with or without a signature),
+            UTF-16 (with a BOM), or ANSI.
+        @param content The file's raw content.
+        @param[out] startsWithBom Whether the content starts with a UTF-8 signature.
+        @returns Whether the content is UTF-8 and the decoded text.
+            Like files read by read_utf8_file(), the text always ends with a newline.*/
+    [[nodiscard]]
+    std::pair<bool, std::wstring> decode_content(std::string_view content, bool& startsWithBom);
 
     /// @brief Gets the file type based on extension.
     /// @param file The file path.
@@ -72,6 +84,10 @@ namespace i18n_check
             {
             return file_review_type::po;
             }
+        if (file.extension().compare(std::filesystem::path(L".mo")) == 0)
+            {
+            return file_review_type::mo;
+            }
         if (file.extension().compare(std::filesystem::path(L".cs")) == 0)
             {
             return file_review_type::cs;
@@ -105,15 +121,18 @@ namespace i18n_check
             @param[in,out] cpp The C++ analyzer to use.
             @param[in,out] rc The Windows RC file analyzer to use.
             @param[in,out] po The PO file analyzer to use.
+            @param[in,out] mo The MO file analyzer to use.
             @param[in,out] csharp The C# file analyzer to use.
             @param[in,out] infoPlist The Info.plist file analyzer to use.
             @param[in,out] quarto The Quarto file analyzer to use.
         */
         batch_analyze(i18n_check::cpp_i18n_review* cpp, i18n_check::rc_file_review* rc,
-                      i18n_check::po_file_review* po, i18n_check::cpp_i18n_review* csharp,
+                      i18n_check::po_file_review* po, i18n_check::mo_file_review* mo,
+                      i18n_check::cpp_i18n_review* csharp,
                       i18n_check::info_plist_file_review* infoPlist,
                       i18n_check::quarto_review* quarto)
-            : m_cpp(cpp), m_rc(rc), m_po(po), m_csharp(csharp), m_plist(infoPlist), m_quarto(quarto)
+            : m_cpp(cpp), m_rc(rc), m_po(po), m_mo(mo), m_csharp(csharp), m_plist(infoPlist),
+              m_quarto(quarto)
             {
             }
 
@@ -132,6 +151,58 @@ namespace i18n_check
         void analyze(const std::vector<std::filesystem::path>& filesToAnalyze,
                      const analyze_callback_reset& resetCallback, const analyze_callback& callback);
 
+        /** @brief Updates the results from the last call to analyze() for files that
+                were changed, added, or deleted since then.
+            @details Only the changed and added files are read and reviewed again, and the
+                results from the deleted files are dropped. Results that depend on other files
+                (e.g., ID values assigned in multiple files) are updated to match what
+                a full analysis would report.
+            @note This should not be used while stream_catalog_results() is enabled,
+                as the results for the catalogs from the last call to analyze() were
+                already written.
+            @param changedFiles The files that were changed or added.
+            @param removedFiles The files that were deleted.
+            @param resetCallback Callback function to tell the progress system in @c callback
+                how many items to expect to be processed.
+            @param callback Callback function to display the progress.
+                Takes the current file index, overall file count, and the name of the current file.
+                Returning @c false indicates that the user cancelled the analysis.*/
+        void analyze_changes(const std::vector<std::filesystem::path>& changedFiles,
+                             const std::vector<std::filesystem::path>& removedFiles,
+                             const analyze_callback_reset& resetCallback,
+                             const analyze_callback& callback);
+
+        /// @brief A file's path and its content (the bytes as they would be read from the file).
+        using file_buffer = std::pair<std::filesystem::path, std::string>;
+
+        /** @brief Runs all analyzers on file content that is already in memory,
+                rather than reading the files.
+            @details The content is decoded the same way as a file's content
+                (e.g., UTF-8 with or without a signature, UTF-16 with a signature),
+                and the file type is determined by the path's extension
+                (files that aren't a supported type are skipped).
+                The paths do not need to exist.
+            @param buffersToAnalyze The paths and content of the files to analyze.
+            @param resetCallback Callback function to tell the progress system in @c callback
+                how many items to expect to be processed.
+            @param callback Callback function to display the progress.
+                Takes the current file index, overall file count, and the name of the current file.
+                Returning @c false indicates that the user cancelled the analysis.*/
+        void analyze_buffers(const std::vector<file_buffer>& buffersToAnalyze,
+                             const analyze_callback_reset& resetCallback,
+                             const analyze_callback& callback);
+
+        /** @brief Reads file records for analyze_buffers().
+            @details Each record is the file's path (in UTF-8) on its own line,
+                the length of the content in bytes on its own line, and then the content.
+                The path and length lines can end with either LF or CRLF,
+                and a newline between records is optional.
+            @param records The file records.
+            @returns The files' paths and content.
+            @throws std::runtime_error If a record is malformed.*/
+        [[nodiscard]]
+        static std::vector<file_buffer> read_file_buffers(std::string_view records);
+
         /** @brief Pseudo translates a set of files.
             @details Copies of each file are made in the same folder with
                 'pseudo_' prepended to the file name.
@@ -153,6 +224,36 @@ namespace i18n_check
                               const analyze_callback_reset& resetCallback,
                               const analyze_callback& callback);
 
+        /// @brief Callback for a block of formatted results.
+        using results_callback = std::function<void(const std::wstring&)>;
+
+        /** @brief Writes the results for PO catalogs as their entries are reviewed,
+                rather than keeping the catalogs in memory until format_results().
+            @details analyze() will write the column headers through @c callback first,
+                followed by the results for each PO catalog entry that has issues.
+                format_results() will then only include the remaining results, so
+                the two together make up the full report.
+            @param callback The function to write each block of results with.
+                An empty function turns streaming off (the default).*/
+        void stream_catalog_results(results_callback callback)
+            {
+            m_catalogResultsCallback = std::move(callback);
+            }
+
+        /** @brief Whether format_results() should group the results for catalogs
+                by message, rather than listing them by catalog.
+            @details Each source string issue (e.g., a URL in a @c msgid) is then reported
+                once for the message, along with how many catalogs have it, followed by
+                the translation issues from each catalog for that message.\n
+                This is useful when reviewing the catalogs for many languages that
+                share the same messages.
+            @note This does not apply to catalog results written by stream_catalog_results().
+            @param group @c true to group catalog results by message.*/
+        void group_catalog_results_by_message(const bool group) noexcept
+            {
+            m_groupCatalogResultsByMessage = group;
+            }
+
         /** @returns A formatted summary of the results.
             @param verbose @c true to include debug output.*/
         [[nodiscard]]
@@ -193,9 +294,70 @@ namespace i18n_check
             }
 
       private:
+        /** @brief Clears the previous results and prepares the analyzers for a new batch.
+            @param fileCount The number of files in the batch.*/
+        void begin_batch(const size_t fileCount);
+
+        /** @brief Loads a file's decoded text into the analyzer for its file type.
+            @param fileType The file type.
+            @param text The file's text.
+            @param file The file's path.*/
+        void load_text(const file_review_type fileType, const std::wstring& text,
+                       const std::filesystem::path& file);
+
+        /** @brief Decodes a file's content, records any encoding issues,
+                and loads it into the analyzer for its file type.
+            @param fileType The file type.
+            @param content The file's raw content.
+            @param file The file's path.*/
+        void load_content(const file_review_type fileType, std::string_view content,
+                          const std::filesystem::path& file);
+
+        /** @brief Reads a file and loads it into the analyzer for its file type.
+            @param file The file's path.*/
+        void load_file(const std::filesystem::path& file);
+
+        /** @brief Removes a file's results from every analyzer.
+            @param file The file's path.*/
+        void clear_file_results(const std::filesystem::path& file);
+
+        /** @brief Reviews the files loaded by load_text().
+            @param resetCallback Callback function to tell the progress system in @c callback
+                how many items to expect to be processed.
+            @param callback Callback function to display the progress.*/
+        void review_loaded_files(const analyze_callback_reset& resetCallback,
+                                 const analyze_callback& callback);
+
+        /// @returns The column headers of the results.
+        [[nodiscard]]
+        static std::wstring format_column_headers();
+
+        /** @brief Formats the issues in a catalog entry.
+            @param[in,out] report The stream to write the results to.
+            @param catEntry The catalog entry (and the file that it is from).*/
+        static void format_catalog_entry(
+            std::wostream& report,
+            const std::pair<std::filesystem::path, translation_catalog_entry>& catEntry);
+
+        /** @brief Formats an issue from a catalog entry.
+            @param[in,out] report The stream to write the results to.
+            @param catEntry The catalog entry (and the file that it is from).
+            @param issue The issue.
+            @param catalogCount The number of catalogs that have this issue.*/
+        static void format_catalog_issue(
+            std::wostream& report,
+            const std::pair<std::filesystem::path, translation_catalog_entry>& catEntry,
+            const std::pair<translation_issue, std::wstring>& issue,
+            const size_t catalogCount = 1);
+
+        /** @brief Formats the issues from the catalogs, grouped by message.
+            @param[in,out] report The stream to write the results to.*/
+        void format_catalog_entries_by_message(std::wostream& report) const;
+
         i18n_check::cpp_i18n_review* m_cpp{ nullptr };
         i18n_check::rc_file_review* m_rc{ nullptr };
         i18n_check::po_file_review* m_po{ nullptr };
+        i18n_check::mo_file_review* m_mo{ nullptr };
         i18n_check::cpp_i18n_review* m_csharp{ nullptr };
         i18n_check::info_plist_file_review* m_plist{ nullptr };
         i18n_check::quarto_review* m_quarto{ nullptr };
@@ -204,6 +366,9 @@ namespace i18n_check
         std::vector<std::filesystem::path> m_filesThatContainUTF8Signature;
 
         std::wstring m_logReport;
+
+        results_callback m_catalogResultsCallback;
+        bool m_groupCatalogResultsByMessage{ false };
         size_t m_lastBatchSize{ 0 };
         };
     } // namespace i18n_check
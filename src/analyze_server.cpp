@@ -0,0 +1,294 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "analyze_server.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#ifndef _WIN32
+    #include <cerrno>
+    #include <cstring>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+#ifndef _WIN32
+namespace
+    {
+    //------------------------------------------------------
+    /// @returns @c true if the connection is ready for @c events before the deadline.
+    bool wait_for_connection(const int connection, const short events,
+                             const std::chrono::steady_clock::time_point deadline)
+        {
+        while (true)
+            {
+            const auto remaining{ std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()) };
+            if (remaining.count() <= 0)
+                {
+                return false;
+                }
+            pollfd connectionInfo{ connection, events, 0 };
+            const int ready{ ::poll(
+                &connectionInfo, 1,
+                static_cast<int>(std::min<std::chrono::milliseconds::rep>(
+                    remaining.count(), std::numeric_limits<int>::max()))) };
+            if (ready > 0)
+                {
+                return true;
+                }
+            if (ready == 0 || errno != EINTR)
+                {
+                return false;
+                }
+            }
+        }
+    } // namespace
+#endif
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    bool analyze_server::serve(const std::filesystem::path& socketPath)
+        {
+#ifdef _WIN32
+        std::wcout << L"Unix domain sockets are not supported on this platform.\n";
+        return false;
+#else
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        const std::string socketName{ socketPath.string() };
+        if (socketName.empty() || socketName.length() >= sizeof(address.sun_path))
+            {
+            std::wcout << L"Invalid socket path: " << socketPath << L"\n";
+            return false;
+            }
+        std::copy(socketName.cbegin(), socketName.cend(), std::begin(address.sun_path));
+
+        const int listener{ ::socket(AF_UNIX, SOCK_STREAM, 0) };
+        if (listener < 0)
+            {
+            std::wcout << L"Unable to create socket: "
+                       << i18n_string_util::lazy_string_to_wstring(std::strerror(errno)) << L"\n";
+            return false;
+            }
+        // replace the socket from a previous server, but never anything else
+        std::error_code removeError;
+        if (std::filesystem::is_socket(socketPath, removeError))
+            {
+            std::filesystem::remove(socketPath, removeError);
+            }
+        else if (std::filesystem::exists(socketPath, removeError))
+            {
+            std::wcout << L"Unable to listen on " << socketPath
+                       << L": path exists and is not a socket.\n";
+            ::close(listener);
+            return false;
+            }
+        if (::bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(listener, SOMAXCONN) != 0)
+            {
+            std::wcout << L"Unable to listen on " << socketPath << L": "
+                       << i18n_string_util::lazy_string_to_wstring(std::strerror(errno)) << L"\n";
+            ::close(listener);
+            return false;
+            }
+        m_shutdownRequested = false;
+        while (!m_shutdownRequested)
+            {
+            const int connection{ ::accept(listener, nullptr, nullptr) };
+            if (connection < 0)
+                {
+                if (errno == EINTR)
+                    {
+                    continue;
+                    }
+                std::wcout << L"Unable to accept connection: "
+                           << i18n_string_util::lazy_string_to_wstring(std::strerror(errno))
+                           << L"\n";
+                break;
+                }
+
+            // a client disconnecting early shouldn't stop the server
+#ifdef SO_NOSIGPIPE
+            const int noSignal{ 1 };
+            ::setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+#ifdef MSG_NOSIGNAL
+            constexpr int sendFlags{ MSG_NOSIGNAL };
+#else
+            constexpr int sendFlags{ 0 };
+#endif
+
+            // the request is everything until the client stops writing
+            // (a client that stalls is dropped, rather than blocking the others)
+            std::string request;
+            std::array<char, 64 * 1024> buffer{};
+            bool requestReceived{ false };
+            const auto requestDeadline{ std::chrono::steady_clock::now() + m_requestTimeout };
+            while (wait_for_connection(connection, POLLIN, requestDeadline))
+                {
+                const ssize_t bytesRead{ ::recv(connection, buffer.data(), buffer.size(), 0) };
+                if (bytesRead > 0)
+                    {
+                    request.append(buffer.data(), static_cast<size_t>(bytesRead));
+                    }
+                else if (bytesRead == 0)
+                    {
+                    requestReceived = true;
+                    break;
+                    }
+                else if (errno != EINTR)
+                    {
+                    break;
+                    }
+                }
+            if (!requestReceived)
+                {
+                ::close(connection);
+                continue;
+                }
+
+            const std::string response{ handle_request(request) };
+            size_t bytesWritten{ 0 };
+            const auto responseDeadline{ std::chrono::steady_clock::now() + m_requestTimeout };
+            while (bytesWritten < response.length() &&
+                   wait_for_connection(connection, POLLOUT, responseDeadline))
+                {
+                const ssize_t written{ ::send(connection, response.data() + bytesWritten,
+                                              response.length() - bytesWritten, sendFlags) };
+                if (written > 0)
+                    {
+                    bytesWritten += static_cast<size_t>(written);
+                    }
+                else if (errno != EINTR)
+                    {
+                    break;
+                    }
+                }
+            ::close(connection);
+            }
+
+        ::close(listener);
+        if (std::filesystem::is_socket(socketPath, removeError))
+            {
+            std::filesystem::remove(socketPath, removeError);
+            }
+        return true;
+#endif
+        }
+
+    //------------------------------------------------------
+    std::string analyze_server::handle_request(std::string_view request)
+        {
+        const size_t commandEnd{ request.find('\n') };
+        std::string_view command{ request.substr(0, commandEnd) };
+        if (command.ends_with('\r'))
+            {
+            command.remove_suffix(1);
+            }
+        const std::string_view body{ commandEnd == std::string_view::npos ?
+                                         std::string_view{} :
+                                         request.substr(commandEnd + 1) };
+
+        const analyze_callback_reset noReset{ [](const size_t) {} };
+        const analyze_callback noProgress{ [](const size_t, const std::filesystem::path&)
+                                           { return true; } };
+
+        try
+            {
+            m_analyzer.get_log_report().clear();
+            if (command == "analyze")
+                {
+                // one path per line, or every file from the input folder if there are none
+                // (relative paths are relative to the input folder, the same as buffers)
+                std::vector<std::filesystem::path> files;
+                bool pathsListed{ false };
+                std::string_view paths{ body };
+                while (!paths.empty())
+                    {
+                    const size_t lineEnd{ paths.find('\n') };
+                    std::string_view line{ paths.substr(0, lineEnd) };
+                    paths.remove_prefix(lineEnd == std::string_view::npos ? paths.length() :
+                                                                            lineEnd + 1);
+                    if (line.ends_with('\r'))
+                        {
+                        line.remove_suffix(1);
+                        }
+                    if (line.empty())
+                        {
+                        continue;
+                        }
+                    pathsListed = true;
+                    std::filesystem::path file{ std::u8string_view{
+                        reinterpret_cast<const char8_t*>(line.data()), line.length() } };
+                    if (file.is_relative())
+                        {
+                        file = m_filter.get_input_folder() / file;
+                        }
+                    // skip files that wouldn't be analyzed if the input folder was scanned
+                    if (m_filter.is_path_included(file))
+                        {
+                        files.push_back(std::move(file));
+                        }
+                    }
+                m_analyzer.analyze(pathsListed ? files : m_files, noReset, noProgress);
+                return format_results_response();
+                }
+            if (command == "buffers")
+                {
+                auto buffers = batch_analyze::read_file_buffers(body);
+                std::erase_if(buffers, [this](const auto& buffer)
+                              { return !m_filter.is_path_included(buffer.first); });
+                m_analyzer.analyze_buffers(buffers, noReset, noProgress);
+                return format_results_response();
+                }
+            if (command == "rescan")
+                {
+                m_files = m_gatherFiles();
+                return "ok\n";
+                }
+            if (command == "shutdown")
+                {
+                m_shutdownRequested = true;
+                return "ok\n";
+                }
+            return "error\tUnknown request: " + std::string{ command } + "\n";
+            }
+        catch (const std::exception& expt)
+            {
+            return std::string{ "error\t" } + expt.what() + "\n";
+            }
+        }
+
+    //------------------------------------------------------
+    std::string analyze_server::format_results_response() const
+        {
+        const std::wstring results{ m_analyzer.format_results().str() };
+        std::string response{ "ok\n" };
+        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+            {
+            utf8::utf16to8(results.cbegin(), results.cend(), std::back_inserter(response));
+            }
+        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+            {
+            utf8::utf32to8(results.cbegin(), results.cend(), std::back_inserter(response));
+            }
+        return response;
+        }
+    } // namespace i18n_check
@@ -0,0 +1,125 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef I18N_ANALYZE_SERVER_H
+#define I18N_ANALYZE_SERVER_H
+
+#include "analyze.h"
+#include "input.h"
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Answers analysis requests over a Unix domain socket, keeping the
+            analyzers and the list of files to analyze loaded between requests.
+        @details Each connection sends one request and then closes its side of the
+            connection for writing. The response is then written back and the
+            connection is closed. Connections are answered one at a time, so a client that
+            doesn't finish sending its request (or reading the response) within the request
+            timeout is disconnected.\n
+            The first line of a request is the command, which can be:
+            - @c analyze: Analyzes the files listed on the following lines
+              (one path per line), or every file from the input folder if none are listed.
+            - @c buffers: Analyzes the file records that follow
+              (see batch_analyze::read_file_buffers()), without reading anything from disk.
+              This is useful for editors analyzing unsaved content.
+            - @c rescan: Reloads the list of files from the input folder.
+            - @c shutdown: Stops the server.
+
+            For @c analyze and @c buffers, relative paths are relative to the input folder,
+            and files that wouldn't be analyzed if they were in the input folder (e.g., ignored
+            files or unsupported file types) are skipped.\n
+            The first line of a response is either @c ok or @c error followed by a tab and
+            the error message. For the analysis commands, this is followed by the results
+            in the same tab-delimited format as the command line report.*/
+    class analyze_server
+        {
+      public:
+        /// @brief Function that gathers the files to analyze from the input folder.
+        using gather_files_callback = std::function<std::vector<std::filesystem::path>()>;
+
+        /** @brief Constructor.
+            @param[in,out] analyzer The analyzer (with its sub-analyzers already configured)
+                to use for every request.
+            @param filter The input folder, and which of its folders and files are analyzed
+                (the same filter that @c files were gathered with).
+            @param files The files from the input folder.
+            @param gatherFiles Function to reload the files from the input folder with.*/
+        analyze_server(batch_analyze& analyzer, input_filter filter,
+                       std::vector<std::filesystem::path> files, gather_files_callback gatherFiles)
+            : m_analyzer(analyzer), m_filter(std::move(filter)), m_files(std::move(files)),
+              m_gatherFiles(std::move(gatherFiles))
+            {
+            }
+
+        /// @private
+        analyze_server(const analyze_server&) = delete;
+        /// @private
+        analyze_server& operator=(const analyze_server&) = delete;
+
+        /** @brief Listens on a Unix domain socket and answers requests until
+                a @c shutdown request.
+            @param socketPath The path of the socket. An existing socket at this path
+                is replaced, and the socket is removed when the server stops.
+            @returns @c false if the socket could not be created (e.g., something other than
+                a socket is at @c socketPath), or Unix domain sockets aren't supported
+                on this platform.*/
+        bool serve(const std::filesystem::path& socketPath);
+
+        /** @brief Sets how long a client has to send its request, and then to read
+                the response, before it is disconnected.
+            @param timeout The timeout (the default is 30 seconds).*/
+        void set_request_timeout(const std::chrono::milliseconds timeout) noexcept
+            {
+            m_requestTimeout = timeout;
+            }
+
+        /** @brief Answers a request.
+            @param request The request.
+            @returns The response, encoded as UTF-8.*/
+        [[nodiscard]]
+        std::string handle_request(std::string_view request);
+
+        /// @returns @c true if a @c shutdown request was received.
+        [[nodiscard]]
+        bool is_shutdown_requested() const noexcept
+            {
+            return m_shutdownRequested;
+            }
+
+      private:
+        /// @returns The results of the last analysis, as an @c ok response.
+        [[nodiscard]]
+        std::string format_results_response() const;
+
+        batch_analyze& m_analyzer;
+        input_filter m_filter;
+        std::vector<std::filesystem::path> m_files;
+        gather_files_callback m_gatherFiles;
+        std::chrono::milliseconds m_requestTimeout{ std::chrono::seconds{ 30 } };
+        bool m_shutdownRequested{ false };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif // I18N_ANALYZE_SERVER_H
@@ -0,0 +1,433 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "analyze_watcher.h"
+#include <algorithm>
+#include <iostream>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#ifdef __linux__
+    #include <array>
+    #include <cerrno>
+    #include <cstring>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+namespace
+    {
+    //------------------------------------------------
+    template<typename Func>
+    void for_each_row(std::wstring_view results, Func&& func)
+        {
+        while (!results.empty())
+            {
+            const size_t rowEnd{ results.find(L'\n') };
+            const std::wstring_view row{ results.substr(0, rowEnd) };
+            results.remove_prefix(rowEnd == std::wstring_view::npos ? results.length() :
+                                                                      rowEnd + 1);
+            if (!row.empty())
+                {
+                func(row);
+                }
+            }
+        }
+
+    //------------------------------------------------
+    /// @returns The row with its line and column fields emptied.
+    std::wstring remove_row_position(const std::wstring_view row)
+        {
+        // File, Line, Column, Value, Explanation, Warning ID
+        const size_t fileEnd{ row.find(L'\t') };
+        const size_t lineEnd{ (fileEnd == std::wstring_view::npos) ?
+                                  std::wstring_view::npos :
+                                  row.find(L'\t', fileEnd + 1) };
+        const size_t columnEnd{ (lineEnd == std::wstring_view::npos) ?
+                                    std::wstring_view::npos :
+                                    row.find(L'\t', lineEnd + 1) };
+        if (columnEnd == std::wstring_view::npos)
+            {
+            return std::wstring{ row };
+            }
+        return std::wstring{ row.substr(0, fileEnd) }.append(L"\t\t").append(
+            row.substr(columnEnd));
+        }
+
+    //------------------------------------------------
+    /// @returns How many times each row appears, ignoring where in the file it is
+    ///     (so that edits moving an issue to another line don't count as a change).
+    std::unordered_map<std::wstring, size_t> count_rows(std::wstring_view results)
+        {
+        std::unordered_map<std::wstring, size_t> rows;
+        for_each_row(results,
+                     [&rows](const std::wstring_view row) { ++rows[remove_row_position(row)]; });
+        return rows;
+        }
+    } // namespace
+
+namespace i18n_check
+    {
+    //------------------------------------------------------
+    bool analyze_watcher::watch()
+        {
+#ifndef __linux__
+        std::wcout << L"Watching for file changes is not supported on this platform.\n";
+        return false;
+#else
+        const int notifier{ ::inotify_init1(IN_CLOEXEC) };
+        if (notifier < 0)
+            {
+            std::wcout << L"Unable to watch for file changes: "
+                       << i18n_string_util::lazy_string_to_wstring(std::strerror(errno)) << L"\n";
+            return false;
+            }
+
+        constexpr uint32_t WATCHED_EVENTS{ IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                                           IN_MOVED_TO | IN_ONLYDIR };
+        std::unordered_map<int, input_filter::folder> watchedFolders;
+        const auto watchFolder = [notifier, &watchedFolders](input_filter::folder folder)
+        {
+            const int watchId{ ::inotify_add_watch(notifier, folder.m_path.c_str(),
+                                                   WATCHED_EVENTS) };
+            if (watchId >= 0)
+                {
+                watchedFolders[watchId] = std::move(folder);
+                }
+        };
+        // removes the watches for a folder and its subfolders
+        const auto unwatchFolderTree =
+            [notifier, &watchedFolders](const std::filesystem::path& path)
+        {
+            std::erase_if(watchedFolders,
+                          [notifier, &path](const auto& folder)
+                          {
+                              const auto [pathEnd, folderEnd] =
+                                  std::mismatch(path.begin(), path.end(),
+                                                folder.second.m_path.begin(),
+                                                folder.second.m_path.end());
+                              if (pathEnd != path.end())
+                                  {
+                                  return false;
+                                  }
+                              ::inotify_rm_watch(notifier, folder.first);
+                              return true;
+                          });
+        };
+        // inotify isn't recursive, so every subfolder needs its own watch
+        // (other than excluded ones, which are skipped the same way as when gathering files)
+        const auto watchFolderTree = [this, &watchFolder](input_filter::folder rootFolder)
+        {
+            std::vector<input_filter::folder> foldersToWatch{ std::move(rootFolder) };
+            while (!foldersToWatch.empty())
+                {
+                input_filter::folder folder{ std::move(foldersToWatch.back()) };
+                foldersToWatch.pop_back();
+                m_filter.load_ignore_files(folder);
+                std::error_code fileError;
+                for (std::filesystem::directory_iterator
+                         folderIter(folder.m_path,
+                                    std::filesystem::directory_options::skip_permission_denied,
+                                    fileError),
+                     folderEnd;
+                     !fileError && folderIter != folderEnd; folderIter.increment(fileError))
+                    {
+                    std::error_code entryError;
+                    if (!folderIter->is_directory(entryError) || folderIter->is_symlink(entryError))
+                        {
+                        continue;
+                        }
+                    if (auto subfolder = m_filter.get_subfolder(folder, *folderIter);
+                        subfolder.has_value())
+                        {
+                        foldersToWatch.push_back(std::move(subfolder.value()));
+                        }
+                    }
+                watchFolder(std::move(folder));
+                }
+        };
+
+        const std::filesystem::path& inputFolder{ m_filter.get_input_folder() };
+        std::error_code fileError;
+        const bool watchingFolderTree{ std::filesystem::is_directory(inputFolder, fileError) };
+        if (watchingFolderTree)
+            {
+            watchFolderTree(m_filter.get_root_folder());
+            }
+        else
+            {
+            watchFolder(input_filter::folder{ inputFolder.has_parent_path() ?
+                                                  inputFolder.parent_path() :
+                                                  std::filesystem::path{ L"." },
+                                              std::filesystem::path{}, std::wstring{}, nullptr });
+            }
+        if (watchedFolders.empty())
+            {
+            std::wcout << L"Unable to watch " << inputFolder << L": "
+                       << i18n_string_util::lazy_string_to_wstring(std::strerror(errno)) << L"\n";
+            ::close(notifier);
+            return false;
+            }
+
+        // saving a file (or switching branches) can be several events,
+        // so collect them until things are quiet before updating
+        constexpr int QUIET_MILLISECONDS{ 200 };
+        alignas(inotify_event) std::array<char, 64 * 1024> buffer{};
+        while (true)
+            {
+            std::vector<std::filesystem::path> changedFiles;
+            std::set<std::filesystem::path> ignoreFilesChanged;
+            bool rescan{ false };
+            bool reviewAll{ false };
+            int timeout{ -1 };
+            while (true)
+                {
+                pollfd pollInfo{ notifier, POLLIN, 0 };
+                const int ready{ ::poll(&pollInfo, 1, timeout) };
+                if (ready < 0)
+                    {
+                    if (errno == EINTR)
+                        {
+                        continue;
+                        }
+                    std::wcout << L"Unable to watch for file changes: "
+                               << i18n_string_util::lazy_string_to_wstring(std::strerror(errno))
+                               << L"\n";
+                    ::close(notifier);
+                    return false;
+                    }
+                if (ready == 0)
+                    {
+                    break;
+                    }
+                const ssize_t bytesRead{ ::read(notifier, buffer.data(), buffer.size()) };
+                if (bytesRead <= 0)
+                    {
+                    break;
+                    }
+                for (ssize_t offset = 0; offset < bytesRead;)
+                    {
+                    const auto* event = reinterpret_cast<const inotify_event*>(
+                        std::next(buffer.data(), offset));
+                    offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                    // events were dropped, so anything could have changed
+                    if ((event->mask & IN_Q_OVERFLOW) != 0)
+                        {
+                        rescan = reviewAll = true;
+                        continue;
+                        }
+                    const auto watchedFolder = watchedFolders.find(event->wd);
+                    if (watchedFolder == watchedFolders.cend())
+                        {
+                        continue;
+                        }
+                    if ((event->mask & IN_IGNORED) != 0)
+                        {
+                        watchedFolders.erase(watchedFolder);
+                        continue;
+                        }
+                    if (event->len == 0)
+                        {
+                        continue;
+                        }
+
+                    const std::filesystem::path eventPath{ watchedFolder->second.m_path /
+                                                           event->name };
+                    // (a deleted file or folder's entry will just be "not found")
+                    std::error_code entryError;
+                    const std::filesystem::directory_entry eventEntry{ eventPath, entryError };
+                    if ((event->mask & IN_ISDIR) != 0)
+                        {
+                        const auto subfolder =
+                            m_filter.get_subfolder(watchedFolder->second, eventEntry);
+                        if (!subfolder.has_value())
+                            {
+                            continue;
+                            }
+                        if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+                            {
+                            watchFolderTree(subfolder.value());
+                            }
+                        else if ((event->mask & IN_MOVED_FROM) != 0)
+                            {
+                            // the folder's watches would still report its old path
+                            unwatchFolderTree(eventPath);
+                            }
+                        rescan = true;
+                        }
+                    // an ignore file changing can include or exclude anything in its folder,
+                    // so the folder's cached rules are reloaded and its files gathered again
+                    else if (watchingFolderTree && m_filter.is_respecting_ignore_files() &&
+                             (eventPath.filename() == L".gitignore" ||
+                              eventPath.filename() == L".ignore"))
+                        {
+                        ignoreFilesChanged.insert(watchedFolder->second.m_path);
+                        rescan = true;
+                        }
+                    // a file that was removed only matters if it was being analyzed
+                    else if ((event->mask & (IN_DELETE | IN_MOVED_FROM)) != 0)
+                        {
+                        if (std::binary_search(m_files.cbegin(), m_files.cend(), eventPath))
+                            {
+                            rescan = true;
+                            }
+                        }
+                    // and anything else (e.g., editors' swap and lock files or build outputs)
+                    // is skipped if it wouldn't be analyzed
+                    else if (eventEntry.is_regular_file(entryError) &&
+                             (watchingFolderTree ?
+                                  m_filter.is_file_included(watchedFolder->second, eventEntry) :
+                                  eventPath.filename() == inputFolder.filename()))
+                        {
+                        if ((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+                            {
+                            rescan = true;
+                            }
+                        if ((event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) != 0)
+                            {
+                            changedFiles.push_back(eventPath);
+                            }
+                        }
+                    }
+                timeout = QUIET_MILLISECONDS;
+                }
+
+            // (the set is sorted, so a folder comes before its subfolders and
+            // a subfolder that was already watched again is skipped)
+            std::filesystem::path rewatchedFolder;
+            for (const auto& folderPath : ignoreFilesChanged)
+                {
+                if (!rewatchedFolder.empty() &&
+                    std::mismatch(rewatchedFolder.begin(), rewatchedFolder.end(),
+                                  folderPath.begin(), folderPath.end())
+                            .first == rewatchedFolder.end())
+                    {
+                    continue;
+                    }
+                // the folder is reloaded from its parent's rules (which were loaded already)
+                std::optional<input_filter::folder> folder;
+                if (folderPath == inputFolder)
+                    {
+                    folder = m_filter.get_root_folder();
+                    }
+                else if (const auto parentFolder = std::find_if(
+                             watchedFolders.cbegin(), watchedFolders.cend(),
+                             [&folderPath](const auto& watched)
+                             { return watched.second.m_path == folderPath.parent_path(); });
+                         parentFolder != watchedFolders.cend())
+                    {
+                    folder = m_filter.get_subfolder(
+                        parentFolder->second,
+                        std::filesystem::directory_entry{ folderPath, fileError });
+                    }
+                unwatchFolderTree(folderPath);
+                if (folder.has_value())
+                    {
+                    watchFolderTree(std::move(folder.value()));
+                    }
+                rewatchedFolder = folderPath;
+                }
+
+            if (reviewAll)
+                {
+                changedFiles = m_files;
+                }
+            update(std::move(changedFiles), rescan);
+            }
+#endif
+        }
+
+    //------------------------------------------------------
+    void analyze_watcher::update(std::vector<std::filesystem::path> changedFiles,
+                                 const bool rescan)
+        {
+        std::vector<std::filesystem::path> removedFiles;
+        if (rescan)
+            {
+            std::vector<std::filesystem::path> files{ m_gatherFiles() };
+            std::sort(files.begin(), files.end());
+            std::set_difference(m_files.cbegin(), m_files.cend(), files.cbegin(), files.cend(),
+                                std::back_inserter(removedFiles));
+            // new files are analyzed the same as changed ones
+            std::set_difference(files.cbegin(), files.cend(), m_files.cbegin(), m_files.cend(),
+                                std::back_inserter(changedFiles));
+            m_files = std::move(files);
+            }
+
+        // only files from the input folder (that weren't excluded) are analyzed
+        std::sort(changedFiles.begin(), changedFiles.end());
+        changedFiles.erase(std::unique(changedFiles.begin(), changedFiles.end()),
+                           changedFiles.end());
+        std::erase_if(changedFiles, [this](const auto& file)
+                      { return !std::binary_search(m_files.cbegin(), m_files.cend(), file); });
+        if (changedFiles.empty() && removedFiles.empty())
+            {
+            return;
+            }
+
+        m_analyzer.get_log_report().clear();
+        m_analyzer.analyze_changes(
+            changedFiles, removedFiles, [](const size_t) {},
+            [](const size_t, const std::filesystem::path&) { return true; });
+
+        std::wstring results{ m_analyzer.format_results(m_verbose).str() };
+        if (const std::wstring resultsDiff{ format_results_diff(m_lastResults, results) };
+            !resultsDiff.empty())
+            {
+            m_writeResults(resultsDiff);
+            }
+        m_lastResults = std::move(results);
+        }
+
+    //------------------------------------------------------
+    std::wstring analyze_watcher::format_results_diff(std::wstring_view previousResults,
+                                                      std::wstring_view currentResults)
+        {
+        // rows can be repeated (e.g., the same issue in a file twice),
+        // so compare how many times each one appears
+        std::wstring resultsDiff;
+        auto previousRows{ count_rows(previousResults) };
+        for_each_row(currentResults,
+                     [&previousRows, &resultsDiff](const std::wstring_view row)
+                     {
+                         const auto previousRow = previousRows.find(remove_row_position(row));
+                         if (previousRow != previousRows.end() && previousRow->second > 0)
+                             {
+                             --previousRow->second;
+                             }
+                         else
+                             {
+                             resultsDiff.append(L"+\t").append(row).append(L"\n");
+                             }
+                     });
+        // (the position of a removed issue is out of date, so it isn't shown)
+        auto currentRows{ count_rows(currentResults) };
+        for_each_row(previousResults,
+                     [&currentRows, &resultsDiff](const std::wstring_view row)
+                     {
+                         std::wstring rowWithoutPosition{ remove_row_position(row) };
+                         const auto currentRow = currentRows.find(rowWithoutPosition);
+                         if (currentRow != currentRows.end() && currentRow->second > 0)
+                             {
+                             --currentRow->second;
+                             }
+                         else
+                             {
+                             resultsDiff.append(L"-\t").append(rowWithoutPosition).append(L"\n");
+                             }
+                     });
+        return resultsDiff;
+        }
+    } // namespace i18n_check
@@ -0,0 +1,111 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef I18N_ANALYZE_WATCHER_H
+#define I18N_ANALYZE_WATCHER_H
+
+#include "analyze.h"
+#include "input.h"
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief Watches the input folder after a full analysis, and re-analyzes only the
+            files that are changed, added, or deleted.
+        @details After each change, the rows of the report that are new or were resolved
+            are written (rather than the full report again). Each row starts with
+            a @c + (new) or @c - (resolved) column, followed by the same
+            tab-delimited columns as the full report.*/
+    class analyze_watcher
+        {
+      public:
+        /// @brief Function that gathers the files to analyze from the input folder.
+        using gather_files_callback = std::function<std::vector<std::filesystem::path>()>;
+
+        /** @brief Constructor.
+            @param[in,out] analyzer The analyzer, which should have already analyzed @c files.
+            @param filter The folder (or file) to watch, and which of its folders and files
+                are analyzed (the same filter that @c files were gathered with).
+            @param files The files from the input folder.
+            @param gatherFiles Function to reload the files from the input folder with
+                when files are added or deleted.
+            @param writeResults Function to write the changes to the results with.
+            @param verbose @c true to include debug output in the results.*/
+        analyze_watcher(batch_analyze& analyzer, input_filter filter,
+                        std::vector<std::filesystem::path> files,
+                        gather_files_callback gatherFiles,
+                        batch_analyze::results_callback writeResults, const bool verbose)
+            : m_analyzer(analyzer), m_filter(std::move(filter)),
+              m_files(std::move(files)), m_gatherFiles(std::move(gatherFiles)),
+              m_writeResults(std::move(writeResults)), m_verbose(verbose),
+              m_lastResults(m_analyzer.format_results(m_verbose).str())
+            {
+            }
+
+        /// @private
+        analyze_watcher(const analyze_watcher&) = delete;
+        /// @private
+        analyze_watcher& operator=(const analyze_watcher&) = delete;
+
+        /** @brief Watches the input folder and updates the results as files change,
+                until the program is interrupted.
+            @details Excluded folders aren't watched, and only changes to files that
+                would be analyzed are reviewed. If ignore files are respected, then changing
+                a @c .gitignore or @c .ignore file reloads its folder's rules.
+            @returns @c false if the folder could not be watched
+                (or watching files isn't supported on this platform).*/
+        bool watch();
+
+        /** @brief Re-analyzes the files that changed and writes the changes to the results.
+            @param changedFiles The files that were written to (or added).
+                Files that aren't in the input folder's list of files are ignored.
+            @param rescan @c true to reload the list of files from the input folder,
+                because files may have been added or deleted.*/
+        void update(std::vector<std::filesystem::path> changedFiles, const bool rescan);
+
+        /** @returns The rows that are in @c currentResults but not @c previousResults
+                (prefixed with a @c + column), followed by the rows that are in
+                @c previousResults but not @c currentResults (prefixed with a @c - column).
+            @details Rows are compared without their line and column, so an issue that only
+                moved (e.g., from lines being added above it) isn't reported as a change.
+                Removed rows are written with their line and column empty, as those
+                are out of date.
+            @param previousResults The previous results.
+            @param currentResults The current results.*/
+        [[nodiscard]]
+        static std::wstring format_results_diff(std::wstring_view previousResults,
+                                                std::wstring_view currentResults);
+
+      private:
+        batch_analyze& m_analyzer;
+        input_filter m_filter;
+        // sorted, like the files from the gather function
+        std::vector<std::filesystem::path> m_files;
+        gather_files_callback m_gatherFiles;
+        batch_analyze::results_callback m_writeResults;
+        bool m_verbose{ false };
+        std::wstring m_lastResults;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif // I18N_ANALYZE_WATCHER_H
@@ -18,6 +18,7 @@
 #ifndef INSENSITIVE_STRING_H
 #define INSENSITIVE_STRING_H
 
+#include "i18n_string_util.h"
 #include <cassert>
 #include <cstdio>
 #include <cstring>
@@ -52,7 +53,10 @@ namespace string_util
             }
 
         //--------------------------------------------------
-        static char_type tolower(const char_type& ch) noexcept { return std::towlower(ch); }
+        static char_type tolower(const char_type& ch) noexcept
+            {
+            return i18n_string_util::to_lower(ch);
+            }
 
         //--------------------------------------------------
         static int compare(const char_type* s1, const char_type* s2, size_t n) noexcept
@@ -20,21 +20,40 @@ namespace i18n_check
                                      const std::filesystem::path& fileName)
         {
         m_file_name = fileName;
-        m_file_start = nullptr;
+        set_file_start(std::wstring_view{});
 
         if (srcText.empty())
             {
             return;
             }
 
-        std::wstring cppBuffer{ srcText };
-        wchar_t* cppText = cppBuffer.data();
+        load_line_formatting_issues(srcText, fileName);
+        // tabs, trailing spaces, and line widths don't require parsing the code,
+        // so if those are the only checks being performed, then we are done
+        // (note that spaces after comments are found while parsing)
+        if ((m_review_styles &
+             ~(check_trailing_spaces | check_tabs | check_line_width)) == 0)
+            {
+            m_file_name.clear();
+            return;
+            }
 
-        m_file_start = cppText;
+        // Sections that have been processed (e.g., comments and strings) are masked out
+        // of the file's text as the parser goes, rather than being blanked in a copy of it.
+        const wchar_t* cppText = srcText.data();
+
+        set_file_start(srcText);
+        m_scan_trail.reset();
+        m_resolved_function_roles.clear();
         const wchar_t* const endSentinel =
             std::next(cppText, static_cast<ptrdiff_t>(srcText.length()));
 
-        while (cppText != nullptr && std::next(cppText) < endSentinel && *cppText != 0)
+        // Characters that the loop below does something with (comments, preprocessor
+        // directives, assembly blocks, and quotes).
+        // Everything else can be jumped over.
+        constexpr std::wstring_view delimiters{ L"/#\";a_" };
+
+        while (cppText != nullptr && std::next(cppText) < endSentinel)
             {
             while (std::next(cppText) < endSentinel && *cppText == L' ')
                 {
@@ -63,15 +82,17 @@ namespace i18n_check
                     if (isSuppressed)
                         {
                         m_context_comment_active = false;
-                        clear_section(cppText, std::next(cppText, static_cast<ptrdiff_t>(
-                                                                      suppressionEnd + 2)));
+                        mask_section(cppText, std::next(cppText, static_cast<ptrdiff_t>(
+                                                                     suppressionEnd + 2)));
                         std::advance(cppText, suppressionEnd);
                         }
-                    wchar_t* end = std::wcsstr(cppText, L"*/");
-                    if (end != nullptr && end < endSentinel)
+                    if (const size_t endPos =
+                            m_file_text.find(L"*/", static_cast<size_t>(cppText - m_file_start));
+                        endPos != std::wstring_view::npos)
                         {
-                        clear_section(cppText, std::next(end, 2));
-                        cppText = std::next(end, 2);
+                        mask_section(cppText,
+                                     std::next(m_file_start, static_cast<ptrdiff_t>(endPos + 2)));
+                        cppText = std::next(m_file_start, static_cast<ptrdiff_t>(endPos + 2));
                         if (cppText >= endSentinel)
                             {
                             break;
@@ -83,7 +104,7 @@ namespace i18n_check
                         return;
                         }
                     // move to next character
-                    while (std::next(cppText) < endSentinel && (std::iswspace(*cppText) != 0))
+                    while (std::next(cppText) < endSentinel && i18n_string_util::is_space(*cppText))
                         {
                         std::advance(cppText, 1);
                         }
@@ -105,14 +126,14 @@ namespace i18n_check
                     if (isSuppressed)
                         {
                         m_context_comment_active = false;
-                        clear_section(cppText, std::next(cppText, static_cast<ptrdiff_t>(
-                                                                      suppressionEnd + 2)));
+                        mask_section(cppText, std::next(cppText, static_cast<ptrdiff_t>(
+                                                                     suppressionEnd + 2)));
                         std::advance(cppText, suppressionEnd);
                         }
 
                     if (static_cast<bool>(m_review_styles & check_space_after_comment) &&
                         std::next(cppText, 2) < endSentinel &&
-                        static_cast<bool>(std::iswalnum(*std::next(cppText, 2))) &&
+                        i18n_string_util::is_alnum(*std::next(cppText, 2)) &&
                         // something like "//--------" is OK
                         *std::next(cppText, 2) != L'-')
                         {
@@ -120,16 +141,17 @@ namespace i18n_check
                             std::wstring{}, string_info::usage_info{}, m_file_name,
                             get_line_and_column((cppText - m_file_start)));
                         }
-                    // move to the end of the line
-                    if (const size_t endOfLine = std::wcscspn(cppText, L"\n\r");
-                        std::next(cppText, static_cast<ptrdiff_t>(endOfLine)) < endSentinel)
+                    // move to the end of the line (or of the text, if the comment is at the end)
+                    const wchar_t* const endOfLine =
+                        i18n_string_util::find_first_of_chars(cppText, endSentinel, L"\n\r");
+                    mask_section(cppText, endOfLine);
+                    cppText = endOfLine;
+                    if (cppText >= endSentinel)
                         {
-                        clear_section(cppText,
-                                      std::next(cppText, static_cast<ptrdiff_t>(endOfLine)));
-                        std::advance(cppText, endOfLine);
+                        break;
                         }
                     // move to next character
-                    while (std::next(cppText) < endSentinel && (std::iswspace(*cppText) != 0))
+                    while (std::next(cppText) < endSentinel && i18n_string_util::is_space(*cppText))
                         {
                         std::advance(cppText, 1);
                         }
@@ -144,7 +166,7 @@ namespace i18n_check
                             {
                             if (static_cast<bool>(m_review_styles & check_space_after_comment) &&
                                 std::next(cppText, 2) < endSentinel &&
-                                static_cast<bool>(std::iswalnum(*std::next(cppText, 2))) &&
+                                i18n_string_util::is_alnum(*std::next(cppText, 2)) &&
                                 // something like "//--------" is OK
                                 *std::next(cppText, 2) != L'-')
                                 {
@@ -152,16 +174,13 @@ namespace i18n_check
                                     std::wstring{}, string_info::usage_info{}, m_file_name,
                                     get_line_and_column((cppText - m_file_start)));
                                 }
-                            // move to the end of the line
-                            if (const size_t endOfLine = std::wcscspn(cppText, L"\n\r");
-                                std::next(cppText, static_cast<ptrdiff_t>(endOfLine)) < endSentinel)
-                                {
-                                clear_section(
-                                    cppText, std::next(cppText, static_cast<ptrdiff_t>(endOfLine)));
-                                std::advance(cppText, endOfLine);
-                                }
+                            // move to the end of the line (or of the text)
+                            const wchar_t* const nextLine = i18n_string_util::find_first_of_chars(
+                                cppText, endSentinel, L"\n\r");
+                            mask_section(cppText, nextLine);
+                            cppText = nextLine;
                             while (std::next(cppText) < endSentinel &&
-                                   (std::iswspace(*cppText) != 0))
+                                   i18n_string_util::is_space(*cppText))
                                 {
                                 std::advance(cppText, 1);
                                 }
@@ -176,16 +195,19 @@ namespace i18n_check
                 }
             else if (*cppText == L'#')
                 {
-                cppText = process_preprocessor_directive(cppText, cppText - m_file_start);
+                cppText =
+                    process_preprocessor_directive(cppText, cppText - m_file_start, endSentinel);
                 if (cppText == nullptr || cppText >= endSentinel)
                     {
                     break;
                     }
                 }
-            else if (((cppText == m_file_start) || !is_valid_name_char(*std::prev(cppText))) &&
-                     is_assembly_block(cppText))
+            else if (((cppText == m_file_start) ||
+                      !is_valid_name_char(char_at(std::prev(cppText)))) &&
+                     is_assembly_block(
+                         { cppText, static_cast<size_t>(endSentinel - cppText) }))
                 {
-                cppText = process_assembly_block(cppText);
+                cppText = process_assembly_block(cppText, endSentinel);
                 if (cppText == nullptr || cppText >= endSentinel)
                     {
                     break;
@@ -195,14 +217,14 @@ namespace i18n_check
             else if (*cppText == L'\"')
                 {
                 // skip escaped quotes
-                if (cppText > std::next(m_file_start) && *std::prev(cppText) == L'\\' &&
-                    *std::prev(cppText, 2) != L'\\')
+                if (cppText > std::next(m_file_start) && char_at(std::prev(cppText)) == L'\\' &&
+                    char_at(std::prev(cppText, 2)) != L'\\')
                     {
                     std::advance(cppText, 1);
                     continue;
                     }
                 // skip quote symbol that is actually inside of single quote
-                if (cppText > std::next(m_file_start) && *std::prev(cppText) == L'\'' &&
+                if (cppText > std::next(m_file_start) && char_at(std::prev(cppText)) == L'\'' &&
                     *std::next(cppText) == L'\'')
                     {
                     std::advance(cppText, 1);
@@ -219,42 +241,45 @@ namespace i18n_check
                 bool isRawString{ false };
                 wchar_t currentRawStringMarker{ L'R' };
                 // if a raw string, step over 'R'
-                if (is_raw_string_marker(*startPos))
+                if (is_raw_string_marker(char_at(startPos)))
                     {
-                    currentRawStringMarker = *startPos;
+                    currentRawStringMarker = char_at(startPos);
                     isRawString = true;
                     std::advance(startPos, -1);
                     }
                 // special case for triple quote (supported by languages like C#)
-                if (std::wcsncmp(cppText, LR"(""")", 3) == 0)
+                if (std::wstring_view{ cppText, static_cast<size_t>(endSentinel - cppText) }
+                        .starts_with(LR"(""")"))
                     {
                     currentRawStringMarker = *cppText;
                     isRawString = true;
                     std::advance(startPos, -1);
                     }
                 // step back over double-byte, u16, or u32 prefixes
-                if (*startPos == L'L' || *startPos == L'u' || *startPos == L'U')
+                if (char_at(startPos) == L'L' || char_at(startPos) == L'u' ||
+                    char_at(startPos) == L'U')
                     {
                     std::advance(startPos, -1);
                     }
                 // step back over UTF-8 'u8' symbol
-                if (startPos > std::next(m_file_start) && *startPos == L'8' &&
-                    *std::prev(startPos) != L'u')
+                if (startPos > std::next(m_file_start) && char_at(startPos) == L'8' &&
+                    char_at(std::prev(startPos)) != L'u')
                     {
                     std::advance(startPos, -2);
                     }
                 // ...and spaces in front of quote
-                while (startPos > m_file_start && static_cast<bool>(std::iswspace(*startPos)))
+                while (startPos > m_file_start && i18n_string_util::is_space(char_at(startPos)))
                     {
                     std::advance(startPos, -1);
                     }
                 // if we are on a character that can be part of a variable
                 // (and not punctuation) at this point,
                 // then this might be a #defined variable
-                if (is_valid_name_char(*startPos))
+                if (is_valid_name_char(char_at(startPos)))
                     {
                     const wchar_t* directiveStart = startPos;
-                    while (directiveStart > m_file_start && is_valid_name_char(*directiveStart))
+                    while (directiveStart > m_file_start &&
+                           is_valid_name_char(char_at(directiveStart)))
                         {
                         std::advance(directiveStart, -1);
                         }
@@ -269,18 +294,18 @@ namespace i18n_check
                     }
                 // find the end of the string now and feed it into the system
                 std::advance(cppText, 1);
-                wchar_t* end = cppText;
+                const wchar_t* end = cppText;
                 if (isRawString)
                     {
                     cppText = raw_step_into_string(cppText, currentRawStringMarker);
-                    end = find_raw_string_end(cppText, currentRawStringMarker);
+                    end = find_raw_string_end(cppText, endSentinel, currentRawStringMarker);
                     }
                 else
                     {
                     while (end != nullptr && end < endSentinel)
                         {
-                        end = std::wcschr(end, L'\"');
-                        if (end != nullptr)
+                        end = std::find(end, endSentinel, L'\"');
+                        if (end < endSentinel)
                             {
                             // Watch out for escaped quotes.
                             // Note that we could have escaped slashes in front of a quote, so
@@ -288,7 +313,8 @@ namespace i18n_check
                             // is intended for it.
                             size_t proceedingSlashCount{ 0 };
                             const wchar_t* proceedingSlashes = std::prev(end);
-                            while (proceedingSlashes >= m_file_start && *proceedingSlashes == L'\\')
+                            while (proceedingSlashes >= m_file_start &&
+                                   char_at(proceedingSlashes) == L'\\')
                                 {
                                 std::advance(proceedingSlashes, -1);
                                 ++proceedingSlashCount;
@@ -301,9 +327,9 @@ namespace i18n_check
                                 }
 
                             // see if there is more to this string on another line
-                            wchar_t* connectedQuote = std::next(end);
+                            const wchar_t* connectedQuote = std::next(end);
                             while (connectedQuote < endSentinel &&
-                                   static_cast<bool>(std::iswspace(*connectedQuote)))
+                                   i18n_string_util::is_space(char_at(connectedQuote)))
                                 {
                                 std::advance(connectedQuote, 1);
                                 }
@@ -314,10 +340,10 @@ namespace i18n_check
                                 (*std::next(connectedQuote) == L'\r' ||
                                  *std::next(connectedQuote) == L'\n'))
                                 {
-                                clear_section(connectedQuote, std::next(connectedQuote));
+                                mask_section(connectedQuote, std::next(connectedQuote));
                                 end = std::next(connectedQuote, 2);
                                 while (connectedQuote < endSentinel &&
-                                       static_cast<bool>(std::iswspace(*connectedQuote)))
+                                       i18n_string_util::is_space(char_at(connectedQuote)))
                                     {
                                     std::advance(connectedQuote, 1);
                                     }
@@ -327,16 +353,15 @@ namespace i18n_check
                                      *connectedQuote == L'/' && *std::next(connectedQuote) == L'/')
                                 {
                                 // move to the end of the line
-                                if (const size_t endOfLine = std::wcscspn(connectedQuote, L"\n\r");
-                                    std::next(connectedQuote, static_cast<ptrdiff_t>(endOfLine)) <
-                                    endSentinel)
+                                if (const wchar_t* const endOfLine =
+                                        i18n_string_util::find_first_of_chars(
+                                            connectedQuote, endSentinel, L"\n\r");
+                                    endOfLine < endSentinel)
                                     {
-                                    clear_section(connectedQuote,
-                                                  std::next(connectedQuote,
-                                                            static_cast<ptrdiff_t>(endOfLine)));
-                                    std::advance(connectedQuote, endOfLine);
+                                    mask_section(connectedQuote, endOfLine);
+                                    connectedQuote = endOfLine;
                                     while (connectedQuote < endSentinel &&
-                                           static_cast<bool>(std::iswspace(*connectedQuote)))
+                                           i18n_string_util::is_space(char_at(connectedQuote)))
                                         {
                                         std::advance(connectedQuote, 1);
                                         }
@@ -346,13 +371,16 @@ namespace i18n_check
                                      *connectedQuote == L'/' && *std::next(connectedQuote) == L'*')
                                 {
                                 // move to the end of the line
-                                wchar_t* endOfLine = std::wcsstr(connectedQuote, L"*/");
-                                if (endOfLine != nullptr && endOfLine < endSentinel)
+                                if (const size_t endPos = m_file_text.find(
+                                        L"*/", static_cast<size_t>(connectedQuote - m_file_start));
+                                    endPos != std::wstring_view::npos)
                                     {
-                                    clear_section(connectedQuote, std::next(endOfLine, 2));
+                                    const wchar_t* const endOfLine =
+                                        std::next(m_file_start, static_cast<ptrdiff_t>(endPos));
+                                    mask_section(connectedQuote, std::next(endOfLine, 2));
                                     connectedQuote = std::next(endOfLine, 2);
                                     while (connectedQuote < endSentinel &&
-                                           static_cast<bool>(std::iswspace(*connectedQuote)))
+                                           i18n_string_util::is_space(char_at(connectedQuote)))
                                         {
                                         std::advance(connectedQuote, 1);
                                         }
@@ -383,11 +411,11 @@ namespace i18n_check
                                     std::wstring{ connectedQuote, INT64_PRINTF_MACRO_LENGTH },
                                     intPrintfMacro))
                                 {
-                                clear_section(connectedQuote,
-                                              std::next(connectedQuote, INT64_PRINTF_MACRO_LENGTH));
+                                mask_section(connectedQuote,
+                                             std::next(connectedQuote, INT64_PRINTF_MACRO_LENGTH));
                                 std::advance(connectedQuote, INT64_PRINTF_MACRO_LENGTH);
                                 while (connectedQuote < endSentinel &&
-                                       static_cast<bool>(std::iswspace(*connectedQuote)))
+                                       i18n_string_util::is_space(char_at(connectedQuote)))
                                     {
                                     std::advance(connectedQuote, 1);
                                     }
@@ -399,7 +427,7 @@ namespace i18n_check
                                 }
                             else if (connectedQuote < endSentinel && *connectedQuote == L'\\')
                                 {
-                                wchar_t* scanAhead{ std::next(connectedQuote) };
+                                const wchar_t* scanAhead{ std::next(connectedQuote) };
                                 while (scanAhead < endSentinel &&
                                        string_util::is_either(*scanAhead, L'\n', L'\r'))
                                     {
@@ -407,7 +435,7 @@ namespace i18n_check
                                     }
                                 if (scanAhead < endSentinel && *scanAhead == L'\"')
                                     {
-                                    clear_section(connectedQuote, std::next(connectedQuote, 1));
+                                    mask_section(connectedQuote, std::next(connectedQuote, 1));
                                     end = std::next(scanAhead);
                                     continue;
                                     }
@@ -423,22 +451,23 @@ namespace i18n_check
                     {
                     const wchar_t* nextChar = std::next(
                         end, (isRawString ? get_raw_step_size(currentRawStringMarker) + 1 : 1));
-                    while (std::next(nextChar) < endSentinel && (std::iswspace(*nextChar) != 0))
+                    while (std::next(nextChar) < endSentinel &&
+                           i18n_string_util::is_space(*nextChar))
                         {
                         ++nextChar;
                         }
                     process_quote(cppText, end, functionVarNamePos, functionName, variableInfo,
-                                  deprecatedMacroEncountered, parameterPosition, *nextChar == L',');
-                    // closing quote was just cleared; now, clear the opening one
+                                  deprecatedMacroEncountered, parameterPosition,
+                                  nextChar < endSentinel && *nextChar == L',');
+                    // closing quote was just masked; now, mask the opening one
                     if (isRawString && std::prev(cppText, 2) >= m_file_start &&
                         *std::prev(cppText) == L'(' && *std::prev(cppText, 2) == L'\"')
                         {
-                        *std::prev(cppText, 2) = L' ';
-                        *std::prev(cppText) = L' ';
+                        mask_section(std::prev(cppText, 2), cppText);
                         }
                     else if (std::prev(cppText) >= m_file_start && *std::prev(cppText) == L'\"')
                         {
-                        *std::prev(cppText) = L' ';
+                        mask_section(std::prev(cppText), cppText);
                         }
                     cppText = std::next(
                         end, (isRawString ? get_raw_step_size(currentRawStringMarker) + 1 : 1));
@@ -458,80 +487,18 @@ namespace i18n_check
                 }
             else
                 {
-                if (static_cast<bool>(m_review_styles & check_tabs) && *cppText == L'\t')
-                    {
-                    m_tabs.emplace_back(std::wstring{}, string_info::usage_info{}, m_file_name,
-                                        get_line_and_column((cppText - m_file_start)));
-                    }
-                else if (static_cast<bool>(m_review_styles & check_trailing_spaces) &&
-                         *cppText == L' ' && std::next(cppText) < endSentinel &&
-                         (*std::next(cppText) == L'\n' || *std::next(cppText) == L'\r'))
-                    {
-                    assert(cppText >= m_file_start);
-                    auto prevLineStart = std::wstring_view{ m_file_start }.find_last_of(
-                        L"\n\r", cppText - m_file_start);
-                    if (prevLineStart == std::wstring::npos)
-                        {
-                        prevLineStart = 0;
-                        }
-                    // step forward to original line
-                    ++prevLineStart;
-                    std::wstring codeLine(
-                        std::next(m_file_start, static_cast<ptrdiff_t>(prevLineStart)),
-                        (cppText - std::next(m_file_start, static_cast<ptrdiff_t>(prevLineStart))));
-                    string_util::ltrim(codeLine);
-                    m_trailing_spaces.emplace_back(codeLine, string_info::usage_info{}, m_file_name,
-                                                   get_line_and_column((cppText - m_file_start)));
-                    }
-                else if (static_cast<bool>(m_review_styles & check_line_width) &&
-                         (*cppText == L'\n' || *cppText == L'\r') && cppText > m_file_start)
-                    {
-                    const auto currentPos{ (cppText - m_file_start) };
-                    auto previousNewLine =
-                        std::wstring_view{ m_file_start }.find_last_of(L"\n\r", currentPos - 1);
-                    if (previousNewLine == std::wstring::npos)
-                        {
-                        previousNewLine = 0;
-                        }
-                    const size_t currentLineLength{ currentPos - (++previousNewLine) };
-                    if (currentLineLength > MAX_LINE_LENGTH)
-                        {
-                        // ...also, only warn if the current line doesn't have a raw
-                        // string in it--those can make it complicated to break a line
-                        // into smaller lines.
-                        // We will also ignore the line if it appears to be a long bitmask.
-                        const std::wstring_view currentLine{
-                            std::next(m_file_start, static_cast<ptrdiff_t>(previousNewLine)),
-                            currentLineLength
-                        };
-                        if (currentLine.find(L"LR") == std::wstring::npos &&
-                            currentLine.find(L'|') == std::wstring::npos)
-                            {
-                            // quneiform-suppress-begin
-                            m_wide_lines.emplace_back(
-                                // truncate and add ellipsis
-                                std::wstring{ currentLine.substr(
-                                                  0, std::min<size_t>(32, currentLine.length())) }
-                                    // NOLINT
-                                    .append(L"..."),
-                                string_info::usage_info{
-                                    string_info::usage_info::usage_type::orphan,
-                                    std::to_wstring(currentLineLength), std::wstring{},
-                                    std::wstring{} },
-                                m_file_name, get_line_and_column(currentPos));
-                            // quneiform-suppress-end
-                            }
-                        }
-                    }
-                std::advance(cppText, 1);
+                // jump to the next character that the loop needs to look at
+                const wchar_t* const nextDelimiter = i18n_string_util::find_first_of_chars(
+                    std::next(cppText), endSentinel, delimiters);
+                std::advance(cppText, nextDelimiter - cppText);
                 }
             }
 
-        // review full content again once comments and preprocessor blocks are cleared
+        // review full content again, skipping the masked comments and preprocessor blocks
         if (m_wx_info.m_app_init_info.m_file_name.empty())
             {
-            const size_t foundImplAppPos = cppBuffer.find(L"wxIMPLEMENT_APP");
-            const size_t foundPos = cppBuffer.find(L"::OnInit()");
+            const size_t foundImplAppPos = m_file_text.find(L"wxIMPLEMENT_APP");
+            const size_t foundPos = m_file_text.find(L"::OnInit()");
             if (foundImplAppPos != std::wstring::npos && foundPos != std::wstring::npos)
                 {
                 m_wx_info.m_app_init_info = string_info{
@@ -542,21 +509,21 @@ namespace i18n_check
                 };
                 }
             }
-        if (cppBuffer.find(L"wxUILocale::UseDefault()") != std::wstring::npos)
+        if (m_file_text.find(L"wxUILocale::UseDefault()") != std::wstring_view::npos)
             {
-            m_wx_info.m_wxuilocale_initialized = true;
+            m_wx_info.m_wxuilocale_initialized_files.insert(fileName);
             }
-        if (cppBuffer.find(L"wxLocale") != std::wstring::npos)
+        if (m_file_text.find(L"wxLocale") != std::wstring_view::npos)
             {
-            m_wx_info.m_wxlocale_initialized = true;
+            m_wx_info.m_wxlocale_initialized_files.insert(fileName);
             }
 
-        load_id_assignments(cppBuffer, fileName);
-        load_deprecated_functions(cppBuffer, fileName);
-        load_suspect_i18n_usage(cppBuffer, fileName);
+        load_id_assignments(m_file_text, fileName);
+        load_deprecated_functions(m_file_text, fileName);
+        load_suspect_i18n_usage(m_file_text, fileName);
 
         m_file_name.clear();
-        m_file_start = nullptr;
+        set_file_start(std::wstring_view{});
         }
 
     //--------------------------------------------------
@@ -604,95 +571,98 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    wchar_t* cpp_i18n_review::process_assembly_block(wchar_t* asmStart) const
+    const wchar_t* cpp_i18n_review::process_assembly_block(const wchar_t* asmStart,
+                                                           const wchar_t* const endSentinel)
         {
         assert(asmStart);
+        const auto remainingText = [&asmStart, endSentinel]()
+        { return std::wstring_view{ asmStart, static_cast<size_t>(endSentinel - asmStart) }; };
         constexpr std::wstring_view ASM_COMMAND1{ L"asm" };
         constexpr std::wstring_view ASM_COMMAND2{ L"__asm__" };
         constexpr std::wstring_view ASM_COMMAND3{ L"__asm" };
-        wchar_t* const originalStart = asmStart;
+        const wchar_t* const originalStart = asmStart;
         // GCC
-        if (std::wcsncmp(asmStart, ASM_COMMAND1.data(), ASM_COMMAND1.length()) == 0 ||
-            std::wcsncmp(asmStart, ASM_COMMAND2.data(), ASM_COMMAND2.length()) == 0)
+        if (remainingText().starts_with(ASM_COMMAND1) || remainingText().starts_with(ASM_COMMAND2))
             {
-            std::advance(asmStart,
-                         (std::wcsncmp(asmStart, ASM_COMMAND1.data(), ASM_COMMAND1.length()) == 0) ?
-                             ASM_COMMAND1.length() :
-                             ASM_COMMAND2.length());
+            std::advance(asmStart, remainingText().starts_with(ASM_COMMAND1) ?
+                                       ASM_COMMAND1.length() :
+                                       ASM_COMMAND2.length());
             // step over spaces between __asm and its content
-            while (*asmStart != 0 && static_cast<bool>(std::iswspace(*asmStart)))
+            while (asmStart < endSentinel && i18n_string_util::is_space(*asmStart))
                 {
                 std::advance(asmStart, 1);
                 }
             constexpr std::wstring_view VOLATILE_COMMAND1{ L"volatile" };
             constexpr std::wstring_view VOLATILE_COMMAND2{ L"__volatile__" };
             // skip (optional) volatile modifier
-            if (std::wcsncmp(asmStart, VOLATILE_COMMAND1.data(), VOLATILE_COMMAND1.length()) == 0)
+            if (remainingText().starts_with(VOLATILE_COMMAND1))
                 {
                 std::advance(asmStart, VOLATILE_COMMAND1.length());
-                while (*asmStart != 0 && static_cast<bool>(std::iswspace(*asmStart)))
+                while (asmStart < endSentinel && i18n_string_util::is_space(*asmStart))
                     {
                     std::advance(asmStart, 1);
                     }
                 }
-            else if (std::wcsncmp(asmStart, VOLATILE_COMMAND2.data(), VOLATILE_COMMAND2.length()) ==
-                     0)
+            else if (remainingText().starts_with(VOLATILE_COMMAND2))
                 {
                 std::advance(asmStart, VOLATILE_COMMAND2.length());
-                while (*asmStart != 0 && static_cast<bool>(std::iswspace(*asmStart)))
+                while (asmStart < endSentinel && i18n_string_util::is_space(*asmStart))
                     {
                     std::advance(asmStart, 1);
                     }
                 }
-            if (*asmStart == L'(')
+            if (asmStart < endSentinel && *asmStart == L'(')
                 {
-                const auto* end =
-                    string_util::find_matching_close_tag(std::next(asmStart), L'(', L')', false);
+                const auto* end = string_util::find_matching_close_tag(
+                    remainingText().substr(1), L"(", L")");
                 if (end == nullptr)
                     {
                     log_message(L"asm", L"Missing closing ')' in asm block.",
                                 (asmStart - m_file_start));
                     return std::next(asmStart, 1);
                     }
-                clear_section(originalStart, std::next(end));
-                return std::next(const_cast<wchar_t*>(end));
+                mask_section(originalStart, std::next(end));
+                return std::next(end);
                 }
-            if (*asmStart != 0)
+            if (asmStart < endSentinel)
                 {
-                const size_t end = std::wcscspn(asmStart, L"\n\r");
-                clear_section(originalStart, std::next(asmStart, static_cast<ptrdiff_t>(end + 1)));
-                return std::next(asmStart, static_cast<ptrdiff_t>(end + 1));
+                const wchar_t* const end =
+                    i18n_string_util::find_first_of_chars(asmStart, endSentinel, L"\n\r");
+                const wchar_t* const blockEnd = (end < endSentinel) ? std::next(end) : end;
+                mask_section(originalStart, blockEnd);
+                return blockEnd;
                 }
             return nullptr;
             }
         // MSVC
-        if (std::wcsncmp(asmStart, ASM_COMMAND3.data(), ASM_COMMAND3.length()) == 0)
+        if (remainingText().starts_with(ASM_COMMAND3))
             {
             std::advance(asmStart, ASM_COMMAND3.length());
             // step over spaces between __asm and its content
-            while (*asmStart != 0 && static_cast<bool>(std::iswspace(*asmStart)))
+            while (asmStart < endSentinel && i18n_string_util::is_space(*asmStart))
                 {
                 std::advance(asmStart, 1);
                 }
-            if (*asmStart == L'{')
+            if (asmStart < endSentinel && *asmStart == L'{')
                 {
-                const auto* end =
-                    string_util::find_matching_close_tag(std::next(asmStart), L'{', L'}', false);
+                const auto* end = string_util::find_matching_close_tag(
+                    remainingText().substr(1), L"{", L"}");
                 if (end == nullptr)
                     {
                     log_message(L"__asm", L"Missing closing '}' in __asm block.",
                                 (asmStart - m_file_start));
                     return std::next(asmStart);
                     }
-                clear_section(originalStart, std::next(end));
-                return std::next(const_cast<wchar_t*>(end));
+                mask_section(originalStart, std::next(end));
+                return std::next(end);
                 }
-            if (*asmStart != 0)
+            if (asmStart < endSentinel)
                 {
-                const size_t endPos = std::wcscspn(asmStart, L"\n\r");
-                clear_section(originalStart,
-                              std::next(asmStart, static_cast<ptrdiff_t>(endPos + 1)));
-                return std::next(asmStart, static_cast<ptrdiff_t>(endPos + 1));
+                const wchar_t* const endPos =
+                    i18n_string_util::find_first_of_chars(asmStart, endSentinel, L"\n\r");
+                const wchar_t* const blockEnd = (endPos < endSentinel) ? std::next(endPos) : endPos;
+                mask_section(originalStart, blockEnd);
+                return blockEnd;
                 }
             return nullptr;
             }
@@ -700,19 +670,28 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    wchar_t* cpp_i18n_review::skip_preprocessor_define_block(wchar_t* directiveStart)
+    const wchar_t*
+    cpp_i18n_review::skip_preprocessor_define_block(const wchar_t* directiveStart,
+                                                    const wchar_t* const endSentinel)
         {
         const std::wregex debugRE{ L"[_]*DEBUG[_]*" };
         const std::wregex debugLevelRE{ L"([a-zA-Z_]*DEBUG_LEVEL|0)" };
         const std::wregex releaseRE{ L"[_]*RELEASE[_]*" };
-        const auto findSectionEnd = [](wchar_t* sectionStart) -> wchar_t*
+        const auto remainingText = [&directiveStart, endSentinel]()
+        {
+            return std::wstring_view{ directiveStart,
+                                      static_cast<size_t>(endSentinel - directiveStart) };
+        };
+        const auto findSectionEnd = [endSentinel](const wchar_t* sectionStart) -> const wchar_t*
         {
             constexpr std::wstring_view ELIF_COMMAND{ L"#elif" };
             constexpr std::wstring_view ENDIF_COMMAND{ L"#endif" };
+            const std::wstring_view section{ sectionStart,
+                                             static_cast<size_t>(endSentinel - sectionStart) };
             const auto* closingElIf =
-                string_util::find_matching_close_tag(sectionStart, L"#if", ELIF_COMMAND);
+                string_util::find_matching_close_tag(section, L"#if", ELIF_COMMAND);
             const auto* closingEndIf =
-                string_util::find_matching_close_tag(sectionStart, L"#if", ENDIF_COMMAND);
+                string_util::find_matching_close_tag(section, L"#if", ENDIF_COMMAND);
             if (closingElIf != nullptr && closingEndIf != nullptr)
                 {
                 if (closingElIf < closingEndIf)
@@ -741,15 +720,15 @@ namespace i18n_check
         };
 
         constexpr std::wstring_view IFNDEF_COMMAND{ L"ifndef" };
-        if (std::wstring_view{ directiveStart }.starts_with(IFNDEF_COMMAND))
+        if (remainingText().starts_with(IFNDEF_COMMAND))
             {
             std::advance(directiveStart, IFNDEF_COMMAND.length());
-            while (static_cast<bool>(std::iswspace(*directiveStart)))
+            while (directiveStart < endSentinel && i18n_string_util::is_space(*directiveStart))
                 {
                 std::advance(directiveStart, 1);
                 }
             auto* defSymbolEnd{ directiveStart };
-            while (is_valid_name_char(*defSymbolEnd))
+            while (defSymbolEnd < endSentinel && is_valid_name_char(*defSymbolEnd))
                 {
                 std::advance(defSymbolEnd, 1);
                 }
@@ -762,15 +741,15 @@ namespace i18n_check
                        nullptr;
             }
         constexpr std::wstring_view IFDEF_COMMAND{ L"ifdef" };
-        if (std::wstring_view{ directiveStart }.starts_with(IFDEF_COMMAND))
+        if (remainingText().starts_with(IFDEF_COMMAND))
             {
             std::advance(directiveStart, IFDEF_COMMAND.length());
-            while (static_cast<bool>(std::iswspace(*directiveStart)))
+            while (directiveStart < endSentinel && i18n_string_util::is_space(*directiveStart))
                 {
                 std::advance(directiveStart, 1);
                 }
             auto* defSymbolEnd{ directiveStart };
-            while (is_valid_name_char(*defSymbolEnd))
+            while (defSymbolEnd < endSentinel && is_valid_name_char(*defSymbolEnd))
                 {
                 std::advance(defSymbolEnd, 1);
                 }
@@ -779,15 +758,15 @@ namespace i18n_check
             return (std::regex_match(defSymbol, debugRE)) ? findSectionEnd(defSymbolEnd) : nullptr;
             }
         constexpr std::wstring_view IFDEFINED_COMMAND{ _DT(L"if defined") };
-        if (std::wstring_view{ directiveStart }.starts_with(IFDEFINED_COMMAND))
+        if (remainingText().starts_with(IFDEFINED_COMMAND))
             {
             std::advance(directiveStart, IFDEFINED_COMMAND.length());
-            while (static_cast<bool>(std::iswspace(*directiveStart)))
+            while (directiveStart < endSentinel && i18n_string_util::is_space(*directiveStart))
                 {
                 std::advance(directiveStart, 1);
                 }
             auto* defSymbolEnd{ directiveStart };
-            while (is_valid_name_char(*defSymbolEnd))
+            while (defSymbolEnd < endSentinel && is_valid_name_char(*defSymbolEnd))
                 {
                 std::advance(defSymbolEnd, 1);
                 }
@@ -796,15 +775,15 @@ namespace i18n_check
             return (std::regex_match(defSymbol, debugRE)) ? findSectionEnd(defSymbolEnd) : nullptr;
             }
         constexpr std::wstring_view IF_COMMAND{ L"if" };
-        if (std::wstring_view{ directiveStart }.starts_with(IF_COMMAND))
+        if (remainingText().starts_with(IF_COMMAND))
             {
             std::advance(directiveStart, IF_COMMAND.length());
-            while (static_cast<bool>(std::iswspace(*directiveStart)))
+            while (directiveStart < endSentinel && i18n_string_util::is_space(*directiveStart))
                 {
                 std::advance(directiveStart, 1);
                 }
             auto* defSymbolEnd{ directiveStart };
-            while (is_valid_name_char(*defSymbolEnd))
+            while (defSymbolEnd < endSentinel && is_valid_name_char(*defSymbolEnd))
                 {
                 std::advance(defSymbolEnd, 1);
                 }
@@ -817,35 +796,37 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    wchar_t* cpp_i18n_review::process_preprocessor_directive(wchar_t* directiveStart,
-                                                             const size_t directivePos)
+    const wchar_t* cpp_i18n_review::process_preprocessor_directive(const wchar_t* directiveStart,
+                                                                   const size_t directivePos,
+                                                                   const wchar_t* const endSentinel)
         {
         assert(directiveStart);
         if (directiveStart == nullptr)
             {
             return nullptr;
             }
-        wchar_t* const originalStart = directiveStart;
+        const wchar_t* const originalStart = directiveStart;
 
         if (*directiveStart == L'#')
             {
             std::advance(directiveStart, 1);
             }
         // step over spaces between '#' and its directive (e.g., pragma)
-        while (string_util::is_either(*directiveStart, L' ', L'\t'))
+        while (directiveStart < endSentinel && string_util::is_either(*directiveStart, L' ', L'\t'))
             {
             std::advance(directiveStart, 1);
             }
 
-        auto* blockEnd = skip_preprocessor_define_block(directiveStart);
+        auto* blockEnd = skip_preprocessor_define_block(directiveStart, endSentinel);
         if (blockEnd != nullptr)
             {
-            clear_section(directiveStart, blockEnd);
+            mask_section(directiveStart, blockEnd);
             return blockEnd;
             }
 
         // skip directives
-        const std::wstring_view directive{ directiveStart };
+        const std::wstring_view directive{ directiveStart,
+                                           static_cast<size_t>(endSentinel - directiveStart) };
         if (directive.starts_with(L"include") || directive.starts_with(L"if") ||
             directive.starts_with(L"ifdef") || directive.starts_with(L"ifndef") ||
             directive.starts_with(L"else") || directive.starts_with(L"elif") ||
@@ -853,8 +834,8 @@ namespace i18n_check
             directive.starts_with(L"define") || directive.starts_with(L"error") ||
             directive.starts_with(L"warning") || directive.starts_with(L"pragma"))
             {
-            wchar_t* end = directiveStart;
-            while (*end != 0)
+            const wchar_t* end = directiveStart;
+            while (end < endSentinel)
                 {
                 if (*end == L'\n' || *end == L'\r')
                     {
@@ -864,7 +845,7 @@ namespace i18n_check
                     const wchar_t* backTrace = end;
                     while (backTrace > directiveStart)
                         {
-                        if (static_cast<bool>(std::iswspace(*backTrace)))
+                        if (i18n_string_util::is_space(*backTrace))
                             {
                             std::advance(backTrace, -1);
                             continue;
@@ -889,54 +870,56 @@ namespace i18n_check
             // special parsing logic for #define sections
             // (try to review strings in here as best we can)
             constexpr std::wstring_view DEFINE_COMMAND{ L"define" };
-            if (std::wstring_view{ directiveStart }.starts_with(DEFINE_COMMAND))
+            if (directive.starts_with(DEFINE_COMMAND))
                 {
                 std::advance(directiveStart, DEFINE_COMMAND.length());
-                while (*directiveStart != 0 && string_util::is_either(*directiveStart, L' ', L'\t'))
+                while (directiveStart < endSentinel &&
+                       string_util::is_either(*directiveStart, L' ', L'\t'))
                     {
                     std::advance(directiveStart, 1);
                     }
-                if (*directiveStart == 0)
+                if (directiveStart >= endSentinel)
                     {
-                    return directiveStart;
+                    return endSentinel;
                     }
-                wchar_t* endOfDefinedTerm = directiveStart;
-                while (endOfDefinedTerm < end && *endOfDefinedTerm != 0 &&
-                       is_valid_name_char(*endOfDefinedTerm))
+                const wchar_t* endOfDefinedTerm = directiveStart;
+                while (endOfDefinedTerm < end && is_valid_name_char(*endOfDefinedTerm))
                     {
                     std::advance(endOfDefinedTerm, 1);
                     }
                 const std::wstring definedTerm =
                     std::wstring(directiveStart, endOfDefinedTerm - directiveStart);
 
-                directiveStart = std::next(endOfDefinedTerm);
-                while (*directiveStart != 0 &&
+                directiveStart =
+                    (endOfDefinedTerm < endSentinel) ? std::next(endOfDefinedTerm) : endSentinel;
+                while (directiveStart < endSentinel &&
                        (*directiveStart == L' ' || *directiveStart == L'\t' ||
                         *directiveStart == L'('))
                     {
                     std::advance(directiveStart, 1);
                     }
-                if (*directiveStart == 0)
+                if (directiveStart >= endSentinel)
                     {
-                    return directiveStart;
+                    return endSentinel;
                     }
                 auto* endOfPossibleFuncName = directiveStart;
-                while (is_valid_name_char(*endOfPossibleFuncName))
+                while (endOfPossibleFuncName < endSentinel &&
+                       is_valid_name_char(*endOfPossibleFuncName))
                     {
                     std::advance(endOfPossibleFuncName, 1);
                     }
-                if (*endOfPossibleFuncName == L'(' && *directiveStart != 0 &&
+                if (endOfPossibleFuncName < endSentinel && *endOfPossibleFuncName == L'(' &&
                     m_ctors_to_ignore.contains(
                         std::wstring(directiveStart, endOfPossibleFuncName - directiveStart)))
                     {
                     directiveStart = std::next(endOfPossibleFuncName);
                     }
                 // #define'd variable followed by a quote? Process as a string variable then.
-                if (*directiveStart != 0 &&
+                if (std::next(directiveStart) < endSentinel &&
                     (*directiveStart == L'\"' || (*std::next(directiveStart) == L'\"')))
                     {
-                    const auto* quoteEnd =
-                        string_util::find_unescaped_char(std::next(directiveStart), L'\"');
+                    const auto* quoteEnd = string_util::find_unescaped_char_n(
+                        std::next(directiveStart), L'\"', endSentinel - std::next(directiveStart));
                     if (quoteEnd != nullptr && (quoteEnd - directiveStart) > 0)
                         {
                         const std::wstring definedValue = std::wstring(
@@ -966,7 +949,7 @@ namespace i18n_check
                 }
             if (shouldClearSection)
                 {
-                clear_section(originalStart, end);
+                mask_section(originalStart, end);
                 }
             return end;
             }
@@ -19,6 +19,7 @@
 #define CPP_I18N_REVIEW_H
 
 #include "i18n_review.h"
+#include <algorithm>
 #include <map>
 #include <span>
 #include <string>
@@ -35,7 +36,8 @@ namespace i18n_check
         explicit cpp_i18n_review(const bool verbose) : i18n_review(verbose) {}
 
         /** @brief Main interface for extracting resource text from C++ source code.
-            @param srcText The C++ code text to extract text from.
+            @param srcText The C++ code text to extract text from.\n
+                This is read in place.
             @param fileName The (optional) name of source file being analyzed.*/
         void operator()(std::wstring_view srcText, const std::filesystem::path& fileName) final;
 
@@ -53,14 +55,24 @@ namespace i18n_check
             return variableType == L"const";
             }
 
-        /// @returns The end of a raw string.
+        /// @returns The end of a raw string, or @c nullptr if not found.
         /// @param text The current string to parse.
+        /// @param endSentinel The end of the text being parsed.
         /// @param chr The tag indicating what type of raw string this is.
         [[nodiscard]]
-        virtual wchar_t* find_raw_string_end(wchar_t* text,
-                                             [[maybe_unused]] const wchar_t chr) const
+        virtual const wchar_t* find_raw_string_end(const wchar_t* text,
+                                                   const wchar_t* const endSentinel,
+                                                   [[maybe_unused]] const wchar_t chr) const
             {
-            return std::wcsstr(text, L")\"");
+            if (text >= endSentinel)
+                {
+                return nullptr;
+                }
+            const size_t endPos =
+                std::wstring_view{ text, static_cast<size_t>(endSentinel - text) }.find(L")\"");
+            return (endPos == std::wstring_view::npos) ?
+                       nullptr :
+                       std::next(text, static_cast<ptrdiff_t>(endPos));
             }
 
         /// @returns How many characters to step into/out of a raw string.
@@ -86,7 +98,7 @@ namespace i18n_check
         /// @param text The current string to parse.
         /// @param chr The tag indicating what type of raw string this is.
         [[nodiscard]]
-        wchar_t* raw_step_into_string(wchar_t* text, const wchar_t chr) const
+        const wchar_t* raw_step_into_string(const wchar_t* text, const wchar_t chr) const
             {
             return std::next(text, get_raw_step_size(chr));
             }
@@ -94,22 +106,29 @@ namespace i18n_check
         /// @brief Parses and processes a preprocessor directive.
         /// @param directiveStart The start of the preprocessor section.
         /// @param directivePos The position in the overall text that the preprocessor block is at.
+        /// @param endSentinel The end of the text being parsed.
         /// @returns The end of the current preprocessor block.
         [[nodiscard]]
-        wchar_t* process_preprocessor_directive(wchar_t* directiveStart, const size_t directivePos);
+        const wchar_t* process_preprocessor_directive(const wchar_t* directiveStart,
+                                                      const size_t directivePos,
+                                                      const wchar_t* const endSentinel);
 
         /// @brief Skips a preprocessor define section.
         /// @details These will be debug preprocessor sections that we won't want to analyze.
         /// @param directiveStart The start of the preprocessor section.
+        /// @param endSentinel The end of the text being parsed.
         /// @returns The end of the current preprocessor block.
         [[nodiscard]]
-        static wchar_t* skip_preprocessor_define_block(wchar_t* directiveStart);
+        static const wchar_t* skip_preprocessor_define_block(const wchar_t* directiveStart,
+                                                             const wchar_t* const endSentinel);
 
         /// @brief Parses and processes an inline assembly block.
         /// @param asmStart The start of the asm section.
+        /// @param endSentinel The end of the text being parsed.
         /// @returns The end of the current asm block.
         [[nodiscard]]
-        wchar_t* process_assembly_block(wchar_t* asmStart) const;
+        const wchar_t* process_assembly_block(const wchar_t* asmStart,
+                                              const wchar_t* const endSentinel);
 
         /// @returns @c true if text is an inline assembly block.
         [[nodiscard]]
@@ -122,7 +141,7 @@ namespace i18n_check
                 }
             return (text.starts_with(L"asm ") || text.starts_with(L"__asm ") ||
                     (text.length() >= 7 && text.starts_with(L"__asm__") &&
-                     ((std::iswspace(text[7]) != 0) || text[7] == L'(')));
+                     (i18n_string_util::is_space(text[7]) || text[7] == L'(')));
             }
         };
     } // namespace i18n_check
@@ -33,10 +33,11 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    wchar_t* csharp_i18n_review::find_raw_string_end(wchar_t* text,
-                                                     [[maybe_unused]] const wchar_t chr) const
+    const wchar_t* csharp_i18n_review::find_raw_string_end(const wchar_t* text,
+                                                           const wchar_t* const endSentinel,
+                                                           [[maybe_unused]] const wchar_t chr) const
         {
-        while (*text != 0)
+        while (text < endSentinel)
             {
             if (*text != '\"')
                 {
@@ -46,14 +47,14 @@ namespace i18n_check
                 {
                 std::advance(text, 1);
                 // next character after the stepped-over quote is not a quote, so return
-                if (*text != '\"')
+                if (text >= endSentinel || *text != '\"')
                     {
                     return std::prev(text);
                     }
                 // step over the second quote
                 std::advance(text, 1);
-                // if on a third quote (or null terminator), then this is the end
-                if (*text == 0 || *text == '\"')
+                // if on a third quote (or the end of the text), then this is the end
+                if (text >= endSentinel || *text == '\"')
                     {
                     return std::prev(text, 2);
                     }
@@ -39,9 +39,11 @@ namespace i18n_check
 
         /// @returns The end of a raw string.
         /// @param text The current string to parse.
+        /// @param endSentinel The end of the text being parsed.
         /// @param chr The tag indicating what type of raw string this is.
         [[nodiscard]]
-        wchar_t* find_raw_string_end(wchar_t* text, [[maybe_unused]] const wchar_t chr) const final;
+        const wchar_t* find_raw_string_end(const wchar_t* text, const wchar_t* const endSentinel,
+                                           [[maybe_unused]] const wchar_t chr) const final;
 
         /// @returns How many characters to step into/out of a raw string.
         ///     In other words, how many characters are inside the string marking the
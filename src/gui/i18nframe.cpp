@@ -1542,7 +1542,7 @@ void I18NFrame::Process()
             {
             try
                 {
-                parser.add_variable_name_pattern_to_ignore(std::wregex{ pattern.wc_string() });
+                parser.add_variable_name_pattern_to_ignore(pattern.ToStdWstring());
                 }
             catch (...)
                 {
@@ -1567,6 +1567,10 @@ void I18NFrame::Process()
     po.review_fuzzy_translations(m_activeProjectOptions.m_fuzzyTranslations);
     po.set_translation_length_threshold(m_activeProjectOptions.m_maxTranslationLongerThreshold);
 
+    i18n_check::mo_file_review mo(m_activeProjectOptions.m_verbose);
+    mo.set_style(static_cast<i18n_check::review_style>(m_activeProjectOptions.m_options));
+    mo.set_translation_length_threshold(m_activeProjectOptions.m_maxTranslationLongerThreshold);
+
     for (const auto& untransName : m_activeProjectOptions.m_untranslatableNames)
         {
         if (std::find(i18n_check::translation_catalog_review::get_untranslatable_names().cbegin(),
@@ -1582,7 +1586,7 @@ void I18NFrame::Process()
     i18n_check::info_plist_file_review infoPlist(m_activeProjectOptions.m_verbose);
     i18n_check::quarto_review quartoReview;
 
-    i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &csharp, &infoPlist, &quartoReview);
+    i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quartoReview);
 
     if (m_activeProjectOptions.m_pseudoTranslationMethod !=
         i18n_check::pseudo_translation_method::none)
@@ -74,9 +74,9 @@ class NewProjectDialog final : public wxDialog
     [[nodiscard]]
     static wxString GetFileFilter()
         {
-        return _(L"All Supported Files|*.cpp;*.c;*.h;*.hpp;*.po;*.pot;*.rc;*.plist;*.qmd|"
+        return _(L"All Supported Files|*.cpp;*.c;*.h;*.hpp;*.po;*.pot;*.mo;*.rc;*.plist;*.qmd|"
                  "Source Files (*.cpp; *.c; *.h; *.hpp)|*.cpp;*.c;*.h;*.hpp|"
-                 "gettext Catalogs (*.po; *.pot)|*.po;*.pot|"
+                 "gettext Catalogs (*.po; *.pot; *.mo)|*.po;*.pot;*.mo|"
                  "macOS Info.plist (Info.plist)|Info.plist|"
                  "Quarto Files (*.qmd)|*.qmd|"
                  "Windows Resource Files (*.rc)|*.rc");
@@ -13,7 +13,10 @@
 
 #include "i18n_review.h"
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <format>
+#include <span>
 
 namespace i18n_check
     {
@@ -43,11 +46,6 @@ namespace i18n_check
         std::regex_constants::icase
     };
 
-    // UINT MENU_ID_PRINT = 1'000;
-    const std::wregex i18n_review::m_id_assignment_regex{
-        LR"((int|uint32_t|uint64_t|INT|UINT|wxWindowID|#define)( |\t|const)*([a-zA-Z0-9_]*ID[a-zA-Z0-9_]*)[ \t]*[=\({]?[ \t\({]*([a-zA-Z0-9_ \+\-\'<>:\.]+){1}(.?))"
-    };
-
     const std::wregex i18n_review::m_diagnostic_function_regex{
         LR"(([a-zA-Z0-9_]*|^)(ASSERT|VERIFY|PROFILE|CHECK)([a-zA-Z0-9_]*|$))"
     };
@@ -140,7 +138,7 @@ namespace i18n_check
     const std::wregex i18n_review::m_positional_command_regex{ LR"([%](n|[L]?[0-9]+|Ln))" };
 
     // common font faces that we would usually ignore (client can add to this)
-    std::set<string_util::case_insensitive_wstring> i18n_review::m_font_names = { // NOLINT
+    string_util::case_folded_wstring_set i18n_review::m_font_names = { // NOLINT
         L"Arial",
         L"Seaford",
         L"Skeena",
@@ -206,7 +204,7 @@ namespace i18n_check
     };
 
     // documents
-    std::set<string_util::case_insensitive_wstring> i18n_review::m_file_extensions = { // NOLINT
+    string_util::case_folded_wstring_set i18n_review::m_file_extensions = { // NOLINT
         L"xml", L"html", L"htm", L"xhtml", L"rtf", L"doc", L"docx", L"docm", L"txt", L"ppt",
         L"pptx", L"pdf", L"ps", L"odt", L"ott", L"odp", L"otp", L"pptm", L"md", L"xaml", L"tex",
         L"pango",
@@ -245,6 +243,8 @@ namespace i18n_check
     std::set<std::wstring> i18n_review::m_untranslatable_exceptions = { L"PhD" };
 
     std::vector<std::wregex> i18n_review::m_variable_name_patterns_to_ignore;
+    std::vector<i18n_review::variable_name_pattern_info> i18n_review::m_variable_name_pattern_info;
+    size_t i18n_review::m_variable_name_patterns_version{ 0 };
 
     // variables whose CTORs take a string that should never be translated
     std::set<std::wstring> i18n_review::m_variable_types_to_ignore = {
@@ -1089,24 +1089,197 @@ namespace i18n_check
         // keywords in the language that can appear in front of a string only
         m_keywords = { L"return", L"else", L"if", L"goto", L"new", L"delete", L"throw" };
 
+        // (these are only added by the first analyzer, as the patterns are shared)
+        add_variable_name_pattern_to_ignore(LR"(^debug.*)", std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(^stacktrace.*)", std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"((?:[[:alnum:]_\-])*xpm)",
+                                            std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(xpm(?:[[:alnum:]_\-])*)",
+                                            std::regex_constants::icase);
         add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(^debug.*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(^stacktrace.*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"((?:[[:alnum:]_\-])*xpm)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(
-            std::wregex(LR"(xpm(?:[[:alnum:]_\-])*)", std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(std::wregex(
             LR"((?:sql|db|database)(?:Table|Update|Query|Command|Upgrade)?[[:alnum:]_\-]*)",
-            std::regex_constants::icase));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(log)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"([Cc]ommand(_)?[Ss]tring)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(wxColourDialogNames)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(wxColourTable)"));
-        add_variable_name_pattern_to_ignore(std::wregex(LR"(QT_MESSAGE_PATTERN)"));
+            std::regex_constants::icase);
+        add_variable_name_pattern_to_ignore(LR"(log)");
+        add_variable_name_pattern_to_ignore(LR"([Cc]ommand(_)?[Ss]tring)");
+        add_variable_name_pattern_to_ignore(LR"(wxColourDialogNames)");
+        add_variable_name_pattern_to_ignore(LR"(wxColourTable)");
+        add_variable_name_pattern_to_ignore(LR"(QT_MESSAGE_PATTERN)");
         // console objects
-        add_variable_name_pattern_to_ignore(std::wregex(LR"((std::)?[w]?(?:cout|cerr|qout|qerr))"));
+        add_variable_name_pattern_to_ignore(LR"((std::)?[w]?(?:cout|cerr|qout|qerr))");
+
+        load_function_roles();
+        }
+
+    //--------------------------------------------------
+    void i18n_review::load_function_roles()
+        {
+        m_function_roles.clear();
+        m_resolved_function_roles.clear();
+        const auto addRoles = [this](const auto& functionNames, const function_role role)
+        {
+            for (const auto& functionName : functionNames)
+                {
+                m_function_roles[functionName] |= static_cast<uint8_t>(role);
+                }
+        };
+        addRoles(m_localization_functions, function_role::i18n);
+        addRoles(m_localization_with_context_functions, function_role::i18n_with_context);
+        addRoles(m_non_localizable_functions, function_role::non_i18n);
+        addRoles(m_internal_functions, function_role::internal);
+        addRoles(m_log_functions, function_role::log);
+        addRoles(m_keywords, function_role::keyword);
+        }
+
+    //--------------------------------------------------
+    void i18n_review::add_variable_name_pattern_to_ignore(
+        std::wstring_view pattern,
+        const std::regex_constants::syntax_option_type flags /*= std::regex_constants::ECMAScript*/)
+        {
+        if (!pattern.empty() && std::any_of(m_variable_name_pattern_info.cbegin(),
+                                            m_variable_name_pattern_info.cend(),
+                                            [pattern, flags](const auto& info) {
+                                                return info.m_pattern == pattern &&
+                                                       info.m_flags == flags;
+                                            }))
+            {
+            return;
+            }
+        // (throws if the pattern is invalid, before anything is added)
+        std::wregex patternRegex(pattern.cbegin(), pattern.cend(), flags);
+
+        variable_name_pattern_info info{ std::wstring{ pattern }, flags, std::wstring{},
+                                         std::wstring{},
+                                         (flags & std::regex_constants::icase) != 0 };
+        // Only letters, digits, and underscores are read as literal text, and a pattern with
+        // alternatives may not need any of its literal text to match.
+        constexpr auto otherGrammars{ std::regex_constants::basic | std::regex_constants::extended |
+                                      std::regex_constants::awk | std::regex_constants::grep |
+                                      std::regex_constants::egrep };
+        if ((flags & otherGrammars) == 0 && pattern.find(L'|') == std::wstring_view::npos)
+            {
+            const auto isLiteral = [](const wchar_t ch)
+            {
+                return (ch >= L'a' && ch <= L'z') || (ch >= L'A' && ch <= L'Z') ||
+                       (ch >= L'0' && ch <= L'9') || ch == L'_';
+            };
+            // the whole name is matched, so anchors don't change anything
+            if (pattern.starts_with(L'^'))
+                {
+                pattern.remove_prefix(1);
+                }
+            if (pattern.ends_with(L'$') && !pattern.ends_with(LR"(\$)"))
+                {
+                pattern.remove_suffix(1);
+                }
+
+            size_t prefixEnd{ 0 };
+            while (prefixEnd < pattern.length() && isLiteral(pattern[prefixEnd]))
+                {
+                ++prefixEnd;
+                }
+            // a quantifier (other than '+') makes the last character optional
+            if (prefixEnd > 0 && prefixEnd < pattern.length() &&
+                (pattern[prefixEnd] == L'*' || pattern[prefixEnd] == L'?' ||
+                 pattern[prefixEnd] == L'{'))
+                {
+                --prefixEnd;
+                }
+            size_t suffixStart{ pattern.length() };
+            while (suffixStart > 0 && isLiteral(pattern[suffixStart - 1]))
+                {
+                --suffixStart;
+                }
+            // part of an escape sequence (e.g., "\d"), rather than literal text
+            if (suffixStart > 0 && pattern[suffixStart - 1] == L'\\')
+                {
+                suffixStart = pattern.length();
+                }
+            info.m_prefix = pattern.substr(0, prefixEnd);
+            info.m_suffix = pattern.substr(suffixStart);
+            if (info.m_ignoreCase)
+                {
+                const auto toLower = [](const wchar_t ch) { return string_util::tolower(ch); };
+                std::transform(info.m_prefix.cbegin(), info.m_prefix.cend(),
+                               info.m_prefix.begin(), toLower);
+                std::transform(info.m_suffix.cbegin(), info.m_suffix.cend(),
+                               info.m_suffix.begin(), toLower);
+                }
+            }
+
+        m_variable_name_patterns_to_ignore.push_back(std::move(patternRegex));
+        m_variable_name_pattern_info.push_back(std::move(info));
+        ++m_variable_name_patterns_version;
+        }
+
+    //--------------------------------------------------
+    bool i18n_review::is_ignored_variable_name(const std::wstring& variableName) const
+        {
+        if (m_ignored_variable_names_version != m_variable_name_patterns_version)
+            {
+            m_ignored_variable_names.clear();
+            m_ignored_variable_names_version = m_variable_name_patterns_version;
+            }
+        if (const auto verdict = m_ignored_variable_names.find(variableName);
+            verdict != m_ignored_variable_names.cend())
+            {
+            return verdict->second;
+            }
+
+        // checks a pattern's literal text before running its regex
+        const auto hasLiteral = [](std::wstring_view text, std::wstring_view literal,
+                                   const bool ignoreCase)
+        {
+            return std::equal(text.cbegin(), text.cend(), literal.cbegin(), literal.cend(),
+                              [ignoreCase](const wchar_t lhs, const wchar_t rhs)
+                              { return (ignoreCase ? string_util::tolower(lhs) : lhs) == rhs; });
+        };
+        bool isIgnored{ false };
+        for (size_t i = 0; i < m_variable_name_patterns_to_ignore.size(); ++i)
+            {
+            const variable_name_pattern_info& info{ m_variable_name_pattern_info[i] };
+            if (variableName.length() >= info.m_prefix.length() &&
+                variableName.length() >= info.m_suffix.length() &&
+                hasLiteral(std::wstring_view{ variableName }.substr(0, info.m_prefix.length()),
+                           info.m_prefix, info.m_ignoreCase) &&
+                hasLiteral(std::wstring_view{ variableName }.substr(variableName.length() -
+                                                                    info.m_suffix.length()),
+                           info.m_suffix, info.m_ignoreCase) &&
+                std::regex_match(variableName, m_variable_name_patterns_to_ignore[i]))
+                {
+                isIgnored = true;
+                break;
+                }
+            }
+        m_ignored_variable_names.emplace(variableName, isIgnored);
+        return isIgnored;
+        }
+
+    //--------------------------------------------------
+    i18n_review::resolved_function_roles&
+    i18n_review::resolve_function(std::wstring_view functionName) const
+        {
+        if (auto resolved = m_resolved_function_roles.find(functionName);
+            resolved != m_resolved_function_roles.end())
+            {
+            return resolved->second;
+            }
+
+        const auto getRoles = [this](std::wstring_view name) -> uint8_t
+        {
+            const auto roles = m_function_roles.find(name);
+            return (roles != m_function_roles.cend()) ? roles->second : 0;
+        };
+
+        resolved_function_roles resolved;
+        resolved.m_nameRoles = getRoles(functionName);
+        resolved.m_nameOrBaseNameRoles = resolved.m_nameRoles;
+        const std::wstring_view baseName = extract_base_function(functionName);
+        if (baseName.length() != functionName.length())
+            {
+            resolved.m_nameOrBaseNameRoles |= getRoles(baseName);
+            }
+        return m_resolved_function_roles.emplace(std::wstring{ functionName }, resolved)
+            .first->second;
         }
 
     //--------------------------------------------------
@@ -1162,11 +1335,28 @@ namespace i18n_check
         {
         process_strings();
 
-        std::wsmatch results;
-        for (const auto& str : m_localizable_strings)
+        // only the strings loaded since the last review need to be reviewed
+        const auto unreviewedStrings = [](const std::vector<string_info>& strings,
+                                          const size_t reviewedCount)
+        { return std::span<const string_info>{ strings }.subspan(reviewedCount); };
+        const auto localizableStrings =
+            unreviewedStrings(m_localizable_strings, m_reviewed_string_counts.m_localizable);
+        const auto localizableStringsInInternalCall =
+            unreviewedStrings(m_localizable_strings_in_internal_call,
+                              m_reviewed_string_counts.m_localizable_in_internal_call);
+        const auto notAvailableForLocalizationStrings =
+            unreviewedStrings(m_not_available_for_localization_strings,
+                              m_reviewed_string_counts.m_not_available_for_localization);
+        const auto markedAsNonLocalizableStrings =
+            unreviewedStrings(m_marked_as_non_localizable_strings,
+                              m_reviewed_string_counts.m_marked_as_non_localizable);
+        const auto internalStrings =
+            unreviewedStrings(m_internal_strings, m_reviewed_string_counts.m_internal);
+
+        for (const auto& str : localizableStrings)
             {
             const auto [isunTranslatable, translatableContentLength] =
-                is_untranslatable_string(str.m_string, false);
+                classify_untranslatable_string(str.m_string, false);
             if (((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0) &&
                 !isunTranslatable && str.m_string.length() > (translatableContentLength * 3) &&
                 !str.m_usage.m_hasContext)
@@ -1179,29 +1369,42 @@ namespace i18n_check
                 m_unsafe_localizable_strings.push_back(str);
                 }
             if (((m_review_styles & check_multipart_strings) != 0) &&
-                is_string_multipart(str.m_string))
+                is_string_classified(str.m_string, string_check::multipart,
+                                     [](const auto& val) { return is_string_multipart(val); }))
                 {
                 m_multipart_strings.push_back(str);
                 }
-            if (((m_review_styles & check_pluralization) != 0) &&
-                is_string_resource_faux_plural(str))
+            // same as is_string_resource_faux_plural(), but with the string's verdict memoized
+            if (((m_review_styles & check_pluralization) != 0) && !str.m_usage.m_hasContext &&
+                is_string_classified(str.m_string, string_check::faux_plural,
+                                     [](const auto& val) { return is_string_faux_plural(val); }))
                 {
                 m_faux_plural_strings.push_back(str);
                 }
             if (((m_review_styles & check_articles_proceeding_placeholder) != 0) &&
-                (is_string_article_issue(str.m_string) || is_string_pronoun(str.m_string)))
+                is_string_classified(str.m_string, string_check::article_or_pronoun,
+                                     [](const auto& val)
+                                     {
+                                         return is_string_article_issue(val) ||
+                                                is_string_pronoun(val);
+                                     }))
                 {
                 m_article_issue_strings.push_back(str);
                 }
             if (((m_review_styles & check_l10n_contains_url) != 0) &&
-                (std::regex_search(str.m_string, results, m_url_email_regex) ||
-                 std::regex_search(str.m_string, results, m_us_phone_number_regex) ||
-                 std::regex_search(str.m_string, results, m_non_us_phone_number_regex)))
+                is_string_classified(str.m_string, string_check::contains_url,
+                                     [](const auto& val)
+                                     {
+                                         return std::regex_search(val, m_url_email_regex) ||
+                                                std::regex_search(val, m_us_phone_number_regex) ||
+                                                std::regex_search(val, m_non_us_phone_number_regex);
+                                     }))
                 {
                 m_localizable_strings_with_urls.push_back(str);
                 }
             if (((m_review_styles & check_needing_context) != 0) && !str.m_usage.m_hasContext &&
-                is_string_ambiguous(str.m_string))
+                is_string_classified(str.m_string, string_check::ambiguous,
+                                     [](const auto& val) { return is_string_ambiguous(val); }))
                 {
                 m_localizable_strings_ambiguous_needing_context.push_back(str);
                 }
@@ -1215,16 +1418,11 @@ namespace i18n_check
                 {
                 m_literal_localizable_strings_being_compared.push_back(str);
                 }
-            if (((m_review_styles & check_halfwidth) != 0) &&
-                !load_matches(str.m_string, m_halfwidth_range_regex).empty())
-                {
-                m_localizable_strings_with_halfwidths.push_back(str);
-                }
             }
 
         if ((m_review_styles & check_l10n_concatenated_strings) != 0)
             {
-            for (const auto& str : m_internal_strings)
+            for (const auto& str : internalStrings)
                 {
                 // Hard coding a percent to a number at runtime should be avoided,
                 // as some locales put the % at the front of the string.
@@ -1243,60 +1441,58 @@ namespace i18n_check
             {
                 for (const auto& str : strings)
                     {
-                    if (std::regex_search(str.m_string, m_malformed_html_tag) ||
-                        std::regex_search(str.m_string, m_malformed_html_tag_bad_amp))
+                    if (is_string_classified(
+                            str.m_string, string_check::malformed,
+                            [](const auto& val)
+                            {
+                                return std::regex_search(val, m_malformed_html_tag) ||
+                                       std::regex_search(val, m_malformed_html_tag_bad_amp);
+                            }))
                         {
                         m_malformed_strings.push_back(str);
                         }
                     }
             };
 
-            classifyMalformedStrings(m_localizable_strings);
-            classifyMalformedStrings(m_marked_as_non_localizable_strings);
-            classifyMalformedStrings(m_internal_strings);
-            classifyMalformedStrings(m_not_available_for_localization_strings);
+            classifyMalformedStrings(localizableStrings);
+            classifyMalformedStrings(markedAsNonLocalizableStrings);
+            classifyMalformedStrings(internalStrings);
+            classifyMalformedStrings(notAvailableForLocalizationStrings);
             }
 
-        if ((m_review_styles & check_unencoded_ext_ascii) != 0)
-            {
-            const auto& classifyUnencodedStrings = [this](const auto& strings)
-            {
-                for (const auto& str : strings)
+        // The character-based checks (halfwidth characters, unencoded extended ASCII,
+        // and escaped Unicode values) share one scan of each string.
+        const auto& classifyCharClasses = [this](const auto& strings, const bool isLocalizable)
+        {
+            const bool reviewHalfwidth{ isLocalizable &&
+                                        ((m_review_styles & check_halfwidth) != 0) };
+            const bool reviewUnencoded{ (m_review_styles & check_unencoded_ext_ascii) != 0 };
+            for (const auto& str : strings)
+                {
+                const auto charClasses = i18n_string_util::get_char_classes(str.m_string);
+                if (reviewHalfwidth && (charClasses & i18n_string_util::char_class_halfwidth) != 0)
                     {
-                    for (const auto& ch : str.m_string)
-                        {
-                        if (ch >= 128)
-                            {
-                            m_unencoded_strings.push_back(str);
-                            break;
-                            }
-                        }
+                    m_localizable_strings_with_halfwidths.push_back(str);
                     }
-            };
-
-            classifyUnencodedStrings(m_localizable_strings);
-            classifyUnencodedStrings(m_marked_as_non_localizable_strings);
-            classifyUnencodedStrings(m_internal_strings);
-            classifyUnencodedStrings(m_not_available_for_localization_strings);
-            }
-        else
-            {
-            const auto& classifyEscapedUnicodeStrings = [this](const auto& strings)
-            {
-                for (const auto& str : strings)
+                if (reviewUnencoded)
                     {
-                    if (i18n_string_util::contains_escaped_unicode_value(str.m_string))
+                    if ((charClasses & i18n_string_util::char_class_extended) != 0)
                         {
-                        m_escaped_unicode_strings.push_back(str);
+                        m_unencoded_strings.push_back(str);
                         }
                     }
-            };
+                else if ((charClasses & i18n_string_util::char_class_backslash) != 0 &&
+                         i18n_string_util::contains_escaped_unicode_value(str.m_string))
+                    {
+                    m_escaped_unicode_strings.push_back(str);
+                    }
+                }
+        };
 
-            classifyEscapedUnicodeStrings(m_localizable_strings);
-            classifyEscapedUnicodeStrings(m_marked_as_non_localizable_strings);
-            classifyEscapedUnicodeStrings(m_internal_strings);
-            classifyEscapedUnicodeStrings(m_not_available_for_localization_strings);
-            }
+        classifyCharClasses(localizableStrings, true);
+        classifyCharClasses(markedAsNonLocalizableStrings, false);
+        classifyCharClasses(internalStrings, false);
+        classifyCharClasses(notAvailableForLocalizationStrings, false);
 
         if ((m_review_styles & check_printf_single_number) != 0)
             {
@@ -1307,15 +1503,19 @@ namespace i18n_check
             {
                 for (const auto& str : strings)
                     {
-                    if (std::regex_match(str.m_string, intPrintf) ||
-                        std::regex_match(str.m_string, floatPrintf))
+                    if (is_string_classified(str.m_string, string_check::printf_single_number,
+                                             [&intPrintf, &floatPrintf](const auto& val)
+                                             {
+                                                 return std::regex_match(val, intPrintf) ||
+                                                        std::regex_match(val, floatPrintf);
+                                             }))
                         {
                         m_printf_single_numbers.push_back(str);
                         }
                     }
             };
-            classifyPrintfIntStrings(m_internal_strings);
-            classifyPrintfIntStrings(m_localizable_strings_in_internal_call);
+            classifyPrintfIntStrings(internalStrings);
+            classifyPrintfIntStrings(localizableStringsInInternalCall);
             }
 
         if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage))
@@ -1342,33 +1542,50 @@ namespace i18n_check
                     // quneiform-suppress-end
                     }
             };
-            classifyYearIssueStrings(m_localizable_strings);
-            classifyYearIssueStrings(m_not_available_for_localization_strings);
-            classifyYearIssueStrings(m_internal_strings);
+            classifyYearIssueStrings(localizableStrings);
+            classifyYearIssueStrings(notAvailableForLocalizationStrings);
+            classifyYearIssueStrings(internalStrings);
             }
 
         // if this is wxWidgets code, see if they initialized the locale framework
+        // (which can be from any of the files, so replace the results from the last review)
+        const std::wstring uiLocaleMessage{ _WXTRANS_WSTR(L"wxUILocale::UseDefault() should be "
+                                                          "called from your OnInit() function.") };
+        const std::wstring localeMessage{ _WXTRANS_WSTR(
+            L"A wxLocale object should be constructed from your OnInit() "
+            "function if you rely on C runtime functions to be localized.") };
+        std::erase_if(m_suspect_i18n_usage,
+                      [&uiLocaleMessage, &localeMessage](const auto& str)
+                      {
+                          return str.m_usage.m_value == uiLocaleMessage ||
+                                 str.m_usage.m_value == localeMessage;
+                      });
         if (static_cast<bool>(m_review_styles & check_suspect_i18n_usage) &&
             !m_wx_info.m_app_init_info.m_file_name.empty())
             {
-            if (!m_wx_info.m_wxuilocale_initialized)
+            if (m_wx_info.m_wxuilocale_initialized_files.empty())
                 {
-                m_wx_info.m_app_init_info.m_usage.m_value =
-                    _WXTRANS_WSTR(L"wxUILocale::UseDefault() should be called "
-                                  "from your OnInit() function.");
+                m_wx_info.m_app_init_info.m_usage.m_value = uiLocaleMessage;
                 m_suspect_i18n_usage.push_back(m_wx_info.m_app_init_info);
                 }
-            if (is_verbose() && !m_wx_info.m_wxlocale_initialized)
+            if (is_verbose() && m_wx_info.m_wxlocale_initialized_files.empty())
                 {
-                m_wx_info.m_app_init_info.m_usage.m_value =
-                    _WXTRANS_WSTR(L"A wxLocale object should be constructed from your OnInit() "
-                                  "function if you rely on C runtime functions to be localized.");
+                m_wx_info.m_app_init_info.m_usage.m_value = localeMessage;
                 m_suspect_i18n_usage.push_back(m_wx_info.m_app_init_info);
                 }
             }
 
         // log any parsing errors
         run_diagnostics();
+
+        m_reviewed_string_counts = reviewed_string_counts{
+            m_localizable_strings.size(),
+            m_localizable_strings_in_internal_call.size(),
+            m_not_available_for_localization_strings.size(),
+            m_marked_as_non_localizable_strings.size(),
+            m_internal_strings.size(),
+            m_unsafe_localizable_strings.size()
+        };
         }
 
     //--------------------------------------------------
@@ -1387,7 +1604,7 @@ namespace i18n_check
                 return;
                 }
 
-            if (is_untranslatable_string(str.m_string, true).first)
+            if (classify_untranslatable_string(str.m_string, true).first)
                 {
                 m_internal_strings.push_back(str);
                 }
@@ -1420,7 +1637,7 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    void i18n_review::load_deprecated_functions(const std::wstring_view fileText,
+    void i18n_review::load_deprecated_functions(const masked_text_view& fileText,
                                                 const std::filesystem::path& fileName)
         {
         if (!static_cast<bool>(m_review_styles & check_deprecated_macros))
@@ -1430,9 +1647,14 @@ namespace i18n_check
 
         for (size_t i = 0; i < fileText.length(); /* in loop*/)
             {
+            if (fileText.is_masked(i))
+                {
+                i = fileText.get_masked_end(i);
+                continue;
+                }
             for (const auto& func : m_deprecated_string_functions)
                 {
-                if (fileText.substr(i, func.first.length()).compare(func.first) == 0 &&
+                if (fileText.starts_with(i, func.first) &&
                     // ensure function is a whole-word match and has something after it
                     (i + func.first.length() < fileText.length() &&
                      !is_valid_name_char(fileText[i + func.first.length()])) &&
@@ -1443,7 +1665,7 @@ namespace i18n_check
                         string_info::usage_info(string_info::usage_info::usage_type::function,
                                                 std::wstring(func.second), std::wstring{},
                                                 std::wstring{}),
-                        fileName, get_line_and_column(i, fileText.data()));
+                        fileName, get_line_and_column(i));
                     i += func.first.length();
                     continue;
                     }
@@ -1453,7 +1675,7 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    void i18n_review::load_suspect_i18n_usage(const std::wstring_view fileText,
+    void i18n_review::load_suspect_i18n_usage(const masked_text_view& fileText,
                                               const std::filesystem::path& fileName)
         {
         if (!static_cast<bool>(m_review_styles & check_suspect_i18n_usage))
@@ -1461,306 +1683,746 @@ namespace i18n_check
             return;
             }
 
-            // ::LoadString() being called
+        // The rules, in the order that their results are reported.
+        // To add a rule, add its reviewer here and map its triggering identifiers to it below.
+        const std::array<suspect_usage_reviewer, 2> reviewers{
+            &i18n_review::review_load_string_call, &i18n_review::review_l10n_function_argument
+        };
+        // the identifiers that trigger each rule
+        static const std::unordered_map<std::wstring_view, size_t> ruleTriggers{
+            { L"LoadString", 0 }, { L"LoadStringA", 0 }, { L"LoadStringW", 0 },
+            { L"_", 1 },          { L"wxPLURAL", 1 }
+        };
+        // the first characters of the above, which the scanner jumps between
+        static const std::wstring triggerStarts = []()
+        {
+            std::wstring starts;
+            for (const auto& trigger : ruleTriggers)
+                {
+                if (starts.find(trigger.first.front()) == std::wstring::npos)
+                    {
+                    starts += trigger.first.front();
+                    }
+                }
+            return starts;
+        }();
+
+        std::array<std::vector<string_info>, reviewers.size()> ruleResults;
+        // where each rule's last match ended, as a rule's matches don't overlap
+        std::array<size_t, reviewers.size()> ruleResumePositions{};
+
+        const wchar_t* const textStart = fileText.get_text().data();
+        const wchar_t* const textEnd =
+            std::next(textStart, static_cast<ptrdiff_t>(fileText.length()));
+        size_t position{ 0 };
+        while (position < fileText.length())
             {
-            const std::wregex loadStringRegEx{
-                LR"(([:]{2,2})?LoadString(A|W)?[(](\s*[a-zA-Z0-9_]+\s*,){3}\s*[a-zA-Z0-9_]+[)])"
-            };
-            auto currentTextBlock{ fileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, loadStringRegEx))
-                {
-                currentTextBlock = currentTextBlock.substr(stPositions.position());
-                currentBlockOffset += stPositions.position();
-                if (currentBlockOffset == 0 ||
-                    (!i18n_string_util::is_alpha_7bit(fileText[currentBlockOffset - 1]) &&
-                     fileText[currentBlockOffset - 1] != L'.'))
+            position = static_cast<size_t>(
+                i18n_string_util::find_first_of_chars(
+                    std::next(textStart, static_cast<ptrdiff_t>(position)), textEnd,
+                    triggerStarts) -
+                textStart);
+            if (position >= fileText.length())
+                {
+                break;
+                }
+            if (fileText.is_masked(position))
+                {
+                position = fileText.get_masked_end(position);
+                continue;
+                }
+            // only look at whole identifiers
+            if (position > 0 && is_valid_name_char(fileText[position - 1]))
+                {
+                ++position;
+                continue;
+                }
+            size_t identifierEnd{ position };
+            while (identifierEnd < fileText.length() &&
+                   is_valid_name_char(fileText[identifierEnd]))
+                {
+                ++identifierEnd;
+                }
+            const auto rule =
+                ruleTriggers.find(fileText.get_text().substr(position, identifierEnd - position));
+            if (rule != ruleTriggers.cend() && position >= ruleResumePositions[rule->second])
+                {
+                const size_t reviewEnd = (this->*reviewers[rule->second])(
+                    fileText, position, identifierEnd - position, ruleResults[rule->second],
+                    fileName);
+                if (reviewEnd != std::wstring_view::npos)
                     {
-                    m_suspect_i18n_usage.emplace_back(
-                        std::wstring{ currentTextBlock.substr(0, stPositions.length()) },
-                        string_info::usage_info(
-                            string_info::usage_info::usage_type::function,
-                            _(L"Prefer using CString::LoadString() (if using MFC) "
-                              "or a different framework's string "
-                              "loading function. Calling ::LoadString() requires a "
-                              "fixed-size buffer and may result "
-                              "in truncating translated strings.")
-#ifdef wxVERSION_NUMBER
+                    ruleResumePositions[rule->second] = reviewEnd;
+                    }
+                }
+            position = identifierEnd;
+            }
+
+        for (auto& results : ruleResults)
+            {
+            std::move(results.begin(), results.end(), std::back_inserter(m_suspect_i18n_usage));
+            }
+        }
+
+    //--------------------------------------------------
+    size_t i18n_review::review_load_string_call(const masked_text_view& fileText,
+                                                const size_t position, const size_t length,
+                                                std::vector<string_info>& results,
+                                                const std::filesystem::path& fileName) const
+        {
+        // ::LoadString() being called, with four arguments:
+        // ([:]{2,2})?LoadString(A|W)?[(](\s*[a-zA-Z0-9_]+\s*,){3}\s*[a-zA-Z0-9_]+[)]
+        size_t callEnd{ position + length };
+        if (callEnd >= fileText.length() || fileText[callEnd] != L'(')
+            {
+            return std::wstring_view::npos;
+            }
+        ++callEnd;
+        constexpr size_t LOAD_STRING_ARG_COUNT{ 4 };
+        for (size_t argument = 0; argument < LOAD_STRING_ARG_COUNT; ++argument)
+            {
+            while (callEnd < fileText.length() && i18n_string_util::is_space(fileText[callEnd]))
+                {
+                ++callEnd;
+                }
+            const size_t argumentStart{ callEnd };
+            while (callEnd < fileText.length() && is_valid_name_char(fileText[callEnd]))
+                {
+                ++callEnd;
+                }
+            if (callEnd == argumentStart)
+                {
+                return std::wstring_view::npos;
+                }
+            const bool isLastArgument{ argument + 1 == LOAD_STRING_ARG_COUNT };
+            // spaces are allowed before the commas, but not before the closing parenthesis
+            while (!isLastArgument && callEnd < fileText.length() &&
+                   i18n_string_util::is_space(fileText[callEnd]))
+                {
+                ++callEnd;
+                }
+            if (callEnd >= fileText.length() || fileText[callEnd] != (isLastArgument ? L')' : L','))
+                {
+                return std::wstring_view::npos;
+                }
+            ++callEnd;
+            }
 
-                                .wc_string(),
+        const size_t callStart =
+            (position >= 2 && fileText.starts_with(position - 2, L"::")) ? position - 2 : position;
+        // member functions (e.g., CString::LoadString()) are OK
+        if (callStart == 0 ||
+            (!i18n_string_util::is_alpha_7bit(fileText[callStart - 1]) &&
+             fileText[callStart - 1] != L'.'))
+            {
+            results.emplace_back(
+                fileText.substr(callStart, callEnd - callStart),
+                string_info::usage_info(string_info::usage_info::usage_type::function,
+                                        _(L"Prefer using CString::LoadString() (if using MFC) "
+                                          "or a different framework's string "
+                                          "loading function. Calling ::LoadString() requires a "
+                                          "fixed-size buffer and may result "
+                                          "in truncating translated strings.")
+#ifdef wxVERSION_NUMBER
+                                            .wc_string(),
 #else
-                                ,
+                                            ,
 #endif
-                            std::wstring{}, std::wstring{}),
-                        fileName, get_line_and_column(currentBlockOffset, fileText.data()));
-                    }
-                currentTextBlock = currentTextBlock.substr(stPositions.length());
-                currentBlockOffset += stPositions.length();
-                }
+                                        std::wstring{}, std::wstring{}),
+                fileName, get_line_and_column(callStart));
             }
+        return callEnd;
+        }
 
-            // _(), wxPLURAL() not taking a literal string
+    //--------------------------------------------------
+    size_t i18n_review::review_l10n_function_argument(const masked_text_view& fileText,
+                                                      const size_t position, const size_t length,
+                                                      std::vector<string_info>& results,
+                                                      const std::filesystem::path& fileName) const
+        {
+        // _(), wxPLURAL() not taking a literal string:
+        // \b(_|wxPLURAL)\([\(\s]*([a-zA-Z0-9]+)([[:punct:]])
+        size_t argumentStart{ position + length };
+        if (argumentStart >= fileText.length() || fileText[argumentStart] != L'(')
             {
-            const std::wregex l10nStringNonStringLiteralArgRegEx{
-                LR"(\b(_|wxPLURAL)\([\(\s]*([a-zA-Z0-9]+)([[:punct:]]))"
-            };
-            auto currentTextBlock{ fileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, l10nStringNonStringLiteralArgRegEx))
-                {
-                currentTextBlock = currentTextBlock.substr(stPositions.position(1));
-                currentBlockOffset += stPositions.position(1);
-                if (stPositions.size() >= 3 &&
-                    // only something like LR, L, u8, etc. can be in front of a quote
-                    stPositions[2].length() > 2 && stPositions[3].str() != L"\"")
-                    {
-                    m_suspect_i18n_usage.emplace_back(
-                        stPositions[2].str(),
-                        string_info::usage_info(string_info::usage_info::usage_type::function,
-                                                _(L"Only string literals should be passed to _() "
-                                                  "and wxPLURAL() functions.")
+            return std::wstring_view::npos;
+            }
+        ++argumentStart;
+        while (argumentStart < fileText.length() &&
+               (fileText[argumentStart] == L'(' ||
+                i18n_string_util::is_space(fileText[argumentStart])))
+            {
+            ++argumentStart;
+            }
+        size_t argumentEnd{ argumentStart };
+        while (argumentEnd < fileText.length() &&
+               (i18n_string_util::is_alpha_7bit(fileText[argumentEnd]) ||
+                i18n_string_util::is_numeric_7bit(fileText[argumentEnd])))
+            {
+            ++argumentEnd;
+            }
+        if (argumentEnd == argumentStart || argumentEnd >= fileText.length() ||
+            !i18n_string_util::is_punctuation(fileText[argumentEnd]))
+            {
+            return std::wstring_view::npos;
+            }
+
+        // only something like LR, L, u8, etc. can be in front of a quote
+        if (argumentEnd - argumentStart > 2 && fileText[argumentEnd] != L'"')
+            {
+            results.emplace_back(
+                fileText.substr(argumentStart, argumentEnd - argumentStart),
+                string_info::usage_info(string_info::usage_info::usage_type::function,
+                                        _(L"Only string literals should be passed to _() "
+                                          "and wxPLURAL() functions.")
 #ifdef wxVERSION_NUMBER
-                                                    .wc_string(),
+                                            .wc_string(),
 #else
-                                                    ,
+                                            ,
 #endif
-                                                std::wstring{}, std::wstring{}),
-                        fileName, get_line_and_column(currentBlockOffset, fileText.data()));
-                    }
-                currentTextBlock = currentTextBlock.substr(stPositions.length());
-                currentBlockOffset += stPositions.length();
-                }
+                                        std::wstring{}, std::wstring{}),
+                fileName, get_line_and_column(position));
             }
+        return argumentEnd + 1;
         }
 
     //--------------------------------------------------
-    void i18n_review::load_id_assignments(const std::wstring_view fileText,
-                                          const std::filesystem::path& fileName)
+    void i18n_review::load_line_formatting_issues(const std::wstring_view fileText,
+                                                  const std::filesystem::path& fileName)
         {
-        if (!(static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) ||
-              static_cast<bool>(m_review_styles & check_number_assigned_to_id)))
+        const bool reviewTabs{ static_cast<bool>(m_review_styles & check_tabs) };
+        const bool reviewTrailingSpaces{ static_cast<bool>(m_review_styles &
+                                                           check_trailing_spaces) };
+        const bool reviewLineWidth{ static_cast<bool>(m_review_styles & check_line_width) };
+        if (!reviewTabs && !reviewTrailingSpaces && !reviewLineWidth)
             {
             return;
             }
-        std::vector<std::pair<size_t, std::wstring>> matches;
-
-        auto currentTextBlock{ fileText };
-        std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-        size_t currentBlockOffset{ 0 };
-        while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(), stPositions,
-                                 m_id_assignment_regex))
-            {
-            currentBlockOffset += stPositions.position();
-            currentTextBlock = currentTextBlock.substr(stPositions.position());
-
-            matches.emplace_back(currentBlockOffset,
-                                 currentTextBlock.substr(0, stPositions.length()));
-
-            currentBlockOffset += stPositions.length();
-
-            currentTextBlock = currentTextBlock.substr(stPositions.length());
-            }
-
-        const std::wregex varNamePartsRE{ L"([a-zA-Z0-9_]*)(ID)([a-zA-Z0-9_]*)" };
-        const std::wregex varNameIDPartsRE{ L"([a-zA-Z0-9_]*)(ID[A-Z]?[_]?)([a-zA-Z0-9_]*)" };
-        // no std::from_chars for wchar_t :(
-        const std::wregex numRE{ LR"(^[\-0-9']+$)" };
-        if (!matches.empty())
-            {
-            std::vector<std::tuple<size_t, std::wstring, std::wstring>> idAssignments;
-            idAssignments.reserve(matches.size());
-            std::vector<std::wstring> subMatches;
-            std::vector<std::wstring> idNameParts;
-            // ID and variable name assigned to
-            std::map<std::wstring, std::wstring> assignedIds;
-            for (const auto& match : matches)
-                {
-                subMatches.clear();
-                idNameParts.clear();
-                auto varAssignment{ match.second };
-                // get the var name and ID
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(varAssignment)>::const_iterator>(
-                              varAssignment.cbegin(), varAssignment.cend(), m_id_assignment_regex,
-                              { 3, 4, 5 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(varAssignment)>::const_iterator>{},
-                          std::back_inserter(subMatches));
-                // ignore function calls or constructed objects assigning an ID
-                if (subMatches[2] == L"(" || subMatches[2] == L"{")
+
+        size_t lineStart{ 0 };
+        size_t lineNumber{ 1 };
+        const auto reviewLine = [&](const size_t lineEnd)
+        {
+            const std::wstring_view currentLine{ fileText.substr(lineStart, lineEnd - lineStart) };
+            if (reviewTrailingSpaces && !currentLine.empty() &&
+                (currentLine.back() == L' ' || currentLine.back() == L'\t'))
+                {
+                std::wstring codeLine{ currentLine.substr(
+                    0, currentLine.find_last_not_of(L" \t") + 1) };
+                string_util::ltrim(codeLine);
+                m_trailing_spaces.emplace_back(codeLine, string_info::usage_info{}, fileName,
+                                               std::make_pair(lineNumber, currentLine.length()));
+                }
+            // Only warn if the current line doesn't have a raw string in it--those can make
+            // it complicated to break a line into smaller lines.
+            // We will also ignore the line if it appears to be a long bitmask.
+            if (reviewLineWidth && currentLine.length() > MAX_LINE_LENGTH &&
+                currentLine.find(L"R\"") == std::wstring::npos &&
+                currentLine.find(L'|') == std::wstring::npos)
+                {
+                // quneiform-suppress-begin
+                m_wide_lines.emplace_back(
+                    // truncate and add ellipsis
+                    std::wstring{ currentLine.substr(0, 32) }.append(L"..."),
+                    string_info::usage_info{ string_info::usage_info::usage_type::orphan,
+                                             std::to_wstring(currentLine.length()),
+                                             std::wstring{}, std::wstring{} },
+                    fileName, std::make_pair(lineNumber, currentLine.length() + 1));
+                // quneiform-suppress-end
+                }
+        };
+        const auto reviewChar = [&](const size_t position)
+        {
+            if (fileText[position] == L'\t')
+                {
+                m_tabs.emplace_back(std::wstring{}, string_info::usage_info{}, fileName,
+                                    std::make_pair(lineNumber, position - lineStart + 1));
+                }
+            // second half of a CRLF, the line was already reviewed at the CR
+            else if (fileText[position] == L'\n' && position > 0 &&
+                     fileText[position - 1] == L'\r')
+                {
+                lineStart = position + 1;
+                }
+            else
+                {
+                reviewLine(position);
+                lineStart = position + 1;
+                ++lineNumber;
+                }
+        };
+
+        // review blocks of characters at once, and then the remainder one at a time
+        size_t blockStart{ 0 };
+        for (; blockStart + i18n_string_util::LINE_SCAN_BLOCK_SIZE <= fileText.length();
+             blockStart += i18n_string_util::LINE_SCAN_BLOCK_SIZE)
+            {
+            for (auto found = i18n_string_util::scan_line_block(
+                     std::next(fileText.data(), static_cast<ptrdiff_t>(blockStart)), reviewTabs);
+                 found != 0; found &= (found - 1))
+                {
+                reviewChar(blockStart + static_cast<size_t>(std::countr_zero(found)));
+                }
+            }
+        for (; blockStart < fileText.length(); ++blockStart)
+            {
+            if (fileText[blockStart] == L'\n' || fileText[blockStart] == L'\r' ||
+                (reviewTabs && fileText[blockStart] == L'\t'))
+                {
+                reviewChar(blockStart);
+                }
+            }
+        // last line (if not ending with a newline)
+        if (lineStart < fileText.length())
+            {
+            reviewLine(fileText.length());
+            }
+        }
+
+    //--------------------------------------------------
+    std::vector<i18n_review::id_assignment>
+    i18n_review::find_id_assignments(const masked_text_view& fileText)
+        {
+        // The grammar (which was originally a regex) for something like
+        // "UINT MENU_ID_PRINT = 1'000;" is:
+        //
+        // (int|uint32_t|uint64_t|INT|UINT|wxWindowID|#define)( |\t|const)*
+        // ([a-zA-Z0-9_]*ID[a-zA-Z0-9_]*)[ \t]*[=\({]?[ \t\({]*([a-zA-Z0-9_ \+\-\'<>:\.]+)(.?)
+        //
+        // The lexer below matches the same text that the regex's backtracking would
+        // (with masked sections of the text read as spaces).
+        constexpr std::array<std::wstring_view, 7> ID_DECLARATIONS{
+            L"int", L"uint32_t", L"uint64_t", L"INT", L"UINT", L"wxWindowID", L"#define"
+        };
+        // the characters that the above start with
+        constexpr std::wstring_view ID_DECLARATION_STARTS{ L"iuIUw#" };
+
+        const auto isValueChar = [](const wchar_t chr)
+        {
+            return is_valid_name_char(chr) || chr == L' ' || chr == L'+' || chr == L'-' ||
+                   chr == L'\'' || chr == L'<' || chr == L'>' || chr == L':' || chr == L'.';
+        };
+        const auto isSpaceOrOpener = [](const wchar_t chr)
+        { return chr == L' ' || chr == L'\t' || chr == L'(' || chr == L'{'; };
+        const auto skipWhile = [&fileText](size_t position, const auto& predicate)
+        {
+            while (position < fileText.length() && predicate(fileText[position]))
+                {
+                ++position;
+                }
+            return position;
+        };
+        // (names are only made of unmasked characters, so they can be read as written)
+        const auto containsId = [&fileText](const size_t start, const size_t end)
+        {
+            return end > start && fileText.get_text().substr(start, end - start).find(L"ID") !=
+                                      std::wstring_view::npos;
+        };
+
+        // Finds where the value starts after a name ending at the given position
+        // (i.e., "[ \t]*[=\({]?[ \t\({]*" followed by a value character), trying the
+        // longest runs of spaces and openers first.
+        const auto findValueStart = [&](const size_t nameEnd)
+        {
+            const size_t spacesEnd =
+                skipWhile(nameEnd, [](const wchar_t chr) { return chr == L' ' || chr == L'\t'; });
+            for (size_t spaceEnd = spacesEnd + 1; spaceEnd-- > nameEnd; /* in loop*/)
+                {
+                const bool hasOpener =
+                    (spaceEnd < fileText.length() &&
+                     (fileText[spaceEnd] == L'=' || fileText[spaceEnd] == L'(' ||
+                      fileText[spaceEnd] == L'{'));
+                for (size_t openerEnd = hasOpener ? spaceEnd + 1 : spaceEnd;
+                     openerEnd >= spaceEnd; --openerEnd)
                     {
-                    continue;
+                    const size_t prefixEnd = skipWhile(openerEnd, isSpaceOrOpener);
+                    for (size_t valueStart = prefixEnd + 1; valueStart-- > openerEnd; /* in loop*/)
+                        {
+                        if (valueStart < fileText.length() && isValueChar(fileText[valueStart]))
+                            {
+                            return valueStart;
+                            }
+                        }
+                    if (openerEnd == spaceEnd)
+                        {
+                        break;
+                        }
                     }
-                // clean up ID (e.g., 1'000 -> 1000)
-                string_util::remove_all(subMatches[1], L'\'');
-                string_util::trim(subMatches[1]);
-                string_util::remove_all(subMatches[1], L' ');
-                // break the ID into parts and see what's around "ID";
-                // we don't want "ID" if it is part of a word like "WIDTH"
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(subMatches[0])>::const_iterator>(
-                              subMatches[0].cbegin(), subMatches[0].cend(), varNamePartsRE,
-                              { 1, 2, 3, 4, 5 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(subMatches[0])>::const_iterator>{},
-                          std::back_inserter(idNameParts));
-                // MFC IDs
-                if ((idNameParts[0].empty() ||
-                     (!idNameParts[0].empty() &&
-                      !static_cast<bool>(std::iswupper(idNameParts[0].back())))) &&
-                    (idNameParts[2].starts_with(L"R_") || idNameParts[2].starts_with(L"D_") ||
-                     idNameParts[2].starts_with(L"C_") || idNameParts[2].starts_with(L"I_") ||
-                     idNameParts[2].starts_with(L"B_") || idNameParts[2].starts_with(L"S_") ||
-                     idNameParts[2].starts_with(L"M_") || idNameParts[2].starts_with(L"P_")))
+                }
+            return std::wstring_view::npos;
+        };
+
+        // Reads an ID assignment from after its declaration, trying the most
+        // "( |\t|const)" tokens between the declaration and ID name first.
+        std::vector<size_t> nameStarts;
+        const auto readIdAssignment =
+            [&](const size_t position, const size_t declarationEnd) -> std::optional<id_assignment>
+        {
+            nameStarts.clear();
+            size_t nameStart{ declarationEnd };
+            nameStarts.push_back(nameStart);
+            while (nameStart < fileText.length())
+                {
+                if (fileText[nameStart] == L' ' || fileText[nameStart] == L'\t')
+                    {
+                    ++nameStart;
+                    }
+                else if (fileText.starts_with(nameStart, L"const"))
+                    {
+                    nameStart += 5;
+                    }
+                else
+                    {
+                    break;
+                    }
+                nameStarts.push_back(nameStart);
+                }
+
+            for (auto start = nameStarts.crbegin(); start != nameStarts.crend(); ++start)
+                {
+                // the name includes "ID" and is followed by a value, unless nothing
+                // follows it, in which case its last character is used as the value
+                size_t nameEnd = skipWhile(*start, is_valid_name_char);
+                if (!containsId(*start, nameEnd))
                     {
-                    idAssignments.emplace_back(match.first, subMatches[0], subMatches[1]);
                     continue;
                     }
-                if ((!idNameParts[0].empty() &&
-                     static_cast<bool>(std::iswupper(idNameParts[0].back()))) ||
-                    (!idNameParts[2].empty() &&
-                     static_cast<bool>(std::iswupper(idNameParts[2].front()))))
+                size_t valueStart = findValueStart(nameEnd);
+                if (valueStart == std::wstring_view::npos)
+                    {
+                    if (!containsId(*start, nameEnd - 1))
+                        {
+                        continue;
+                        }
+                    valueStart = --nameEnd;
+                    }
+                const size_t valueEnd = skipWhile(valueStart, isValueChar);
+                const size_t followingLength =
+                    (valueEnd < fileText.length() && fileText[valueEnd] != L'\n' &&
+                     fileText[valueEnd] != L'\r' && fileText[valueEnd] != 0x2028 &&
+                     fileText[valueEnd] != 0x2029) ?
+                        1 :
+                        0;
+                return id_assignment{ position, valueEnd + followingLength - position,
+                                      fileText.get_text().substr(*start, nameEnd - *start),
+                                      fileText.substr(valueStart, valueEnd - valueStart),
+                                      fileText.get_text().substr(valueEnd, followingLength) };
+                }
+            return std::nullopt;
+        };
+
+        std::vector<id_assignment> assignments;
+        const wchar_t* const textStart = fileText.get_text().data();
+        size_t position{ 0 };
+        while (position < fileText.length())
+            {
+            position = static_cast<size_t>(
+                i18n_string_util::find_first_of_chars(
+                    std::next(textStart, static_cast<ptrdiff_t>(position)),
+                    std::next(textStart, static_cast<ptrdiff_t>(fileText.length())),
+                    ID_DECLARATION_STARTS) -
+                textStart);
+            if (position >= fileText.length())
+                {
+                break;
+                }
+            // skip over comments, strings, etc.
+            if (fileText.is_masked(position))
+                {
+                position = fileText.get_masked_end(position);
+                continue;
+                }
+            const auto declaration =
+                std::find_if(ID_DECLARATIONS.cbegin(), ID_DECLARATIONS.cend(),
+                             [&fileText, position](const auto& decl)
+                             { return fileText.starts_with(position, decl); });
+            if (declaration != ID_DECLARATIONS.cend())
+                {
+                if (const auto assignment =
+                        readIdAssignment(position, position + declaration->length()))
                     {
+                    assignments.push_back(assignment.value());
+                    position += assignment->m_length;
                     continue;
                     }
+                }
+            ++position;
+            }
+
+        return assignments;
+        }
+
+    //--------------------------------------------------
+    void i18n_review::load_id_assignments(const masked_text_view& fileText,
+                                          const std::filesystem::path& fileName)
+        {
+        if (!(static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) ||
+              static_cast<bool>(m_review_styles & check_number_assigned_to_id)))
+            {
+            return;
+            }
+
+        const std::vector<id_assignment> matches = find_id_assignments(fileText);
+        if (matches.empty())
+            {
+            return;
+            }
 
-                idAssignments.emplace_back(match.first, subMatches[0], subMatches[1]);
+        // position, ID variable name, and ID (value)
+        std::vector<std::tuple<size_t, std::wstring, std::wstring>> idAssignments;
+        idAssignments.reserve(matches.size());
+        for (const auto& match : matches)
+            {
+            // ignore function calls or constructed objects assigning an ID
+            if (match.m_following == L"(" || match.m_following == L"{")
+                {
+                continue;
                 }
-            for (const auto& [position, string1, string2] : idAssignments)
+            // clean up ID (e.g., 1'000 -> 1000)
+            std::wstring idValue{ match.m_value };
+            string_util::remove_all(idValue, L'\'');
+            string_util::trim(idValue);
+            string_util::remove_all(idValue, L' ');
+            // break the ID into parts and see what's around (the last) "ID";
+            // we don't want "ID" if it is part of a word like "WIDTH"
+            const size_t idPos = match.m_name.rfind(L"ID");
+            const std::wstring_view beforeId = match.m_name.substr(0, idPos);
+            const std::wstring_view afterId = match.m_name.substr(idPos + 2);
+            // MFC IDs
+            if ((beforeId.empty() || !i18n_string_util::is_upper(beforeId.back())) &&
+                (afterId.starts_with(L"R_") || afterId.starts_with(L"D_") ||
+                 afterId.starts_with(L"C_") || afterId.starts_with(L"I_") ||
+                 afterId.starts_with(L"B_") || afterId.starts_with(L"S_") ||
+                 afterId.starts_with(L"M_") || afterId.starts_with(L"P_")))
                 {
-                idNameParts.clear();
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(string1)>::const_iterator>(
-                              string1.cbegin(), string1.cend(), varNameIDPartsRE, { 1, 2, 3 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(string1)>::const_iterator>(),
-                          std::back_inserter(idNameParts));
-                const auto idVal = [&theString = string2]()
+                idAssignments.emplace_back(match.m_position, match.m_name, std::move(idValue));
+                continue;
+                }
+            if ((!beforeId.empty() && i18n_string_util::is_upper(beforeId.back())) ||
+                (!afterId.empty() && i18n_string_util::is_upper(afterId.front())))
                 {
-                    try
-                        {
-                        if (theString.starts_with(L"0x"))
-                            {
-                            return std::optional<int32_t>(std::stol(theString, nullptr, 16));
-                            }
-                        return std::optional<int32_t>(std::stol(theString));
-                        }
-                    catch (...)
+                continue;
+                }
+
+            idAssignments.emplace_back(match.m_position, match.m_name, std::move(idValue));
+            }
+
+        // ID and variable name assigned to
+        std::unordered_map<std::wstring, std::wstring> fileAssignedIds;
+        for (const auto& [position, string1, string2] : idAssignments)
+            {
+            // the "ID" (at the end of the name), along with an uppercase letter
+            // and underscore that follow it (e.g., "IDC_")
+            const size_t idPos = string1.rfind(L"ID");
+            size_t idPrefixLength{ 2 };
+            if (idPos + idPrefixLength < string1.length() &&
+                string1[idPos + idPrefixLength] >= L'A' && string1[idPos + idPrefixLength] <= L'Z')
+                {
+                ++idPrefixLength;
+                }
+            if (idPos + idPrefixLength < string1.length() &&
+                string1[idPos + idPrefixLength] == L'_')
+                {
+                ++idPrefixLength;
+                }
+            const std::wstring_view idPrefix =
+                std::wstring_view{ string1 }.substr(idPos, idPrefixLength);
+            const auto idVal = [&theString = string2]()
+            {
+                try
+                    {
+                    if (theString.starts_with(L"0x"))
                         {
-                        return std::optional<int32_t>{ std::nullopt };
+                        return std::optional<int32_t>(std::stol(theString, nullptr, 16));
                         }
-                }();
-                constexpr int32_t ID_RANGE_START{ 1 };
-                constexpr int32_t MENU_ID_RANGE_END{ 0x6FFF };
-                constexpr int32_t STRING_ID_RANGE_END{ 0x7FFF };
-                constexpr int32_t DIALOG_ID_RANGE_START{ 8 };
-                constexpr int32_t DIALOG_ID_RANGE_END{ 0xDFFF };
-                if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) && idVal &&
-                    (idVal.value() < ID_RANGE_START || idVal.value() > MENU_ID_RANGE_END) &&
-                    (idNameParts[1] == L"IDR_" || idNameParts[1] == L"IDD_" ||
-                     idNameParts[1] == L"IDM_" || idNameParts[1] == L"IDC_" ||
-                     idNameParts[1] == L"IDI_" || idNameParts[1] == L"IDB_"))
+                    return std::optional<int32_t>(std::stol(theString));
+                    }
+                catch (...)
                     {
-                    m_ids_assigned_number.emplace_back(
+                    return std::optional<int32_t>{ std::nullopt };
+                    }
+            }();
+            // no std::from_chars for wchar_t :(
+            const auto isNumber = [&theString = string2]()
+            {
+                return !theString.empty() &&
+                       std::all_of(theString.cbegin(), theString.cend(),
+                                   [](const wchar_t chr)
+                                   {
+                                       return i18n_string_util::is_numeric_7bit(chr) ||
+                                              chr == L'-' || chr == L'\'';
+                                   });
+            };
+            constexpr int32_t ID_RANGE_START{ 1 };
+            constexpr int32_t MENU_ID_RANGE_END{ 0x6FFF };
+            constexpr int32_t STRING_ID_RANGE_END{ 0x7FFF };
+            constexpr int32_t DIALOG_ID_RANGE_START{ 8 };
+            constexpr int32_t DIALOG_ID_RANGE_END{ 0xDFFF };
+            if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) && idVal &&
+                (idVal.value() < ID_RANGE_START || idVal.value() > MENU_ID_RANGE_END) &&
+                (idPrefix == L"IDR_" || idPrefix == L"IDD_" || idPrefix == L"IDM_" ||
+                 idPrefix == L"IDC_" || idPrefix == L"IDI_" || idPrefix == L"IDB_"))
+                {
+                m_ids_assigned_number.emplace_back(
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
-                                           "0x6FFF if this is an MFC project."),
-                                         string2, string1)
-                            .wc_string(),
+                    wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
+                                       "0x6FFF if this is an MFC project."),
+                                     string2, string1)
+                        .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1 +
-                            _DT(L"; value should be between 1 and 0x6FFF if "
-                                "this is an MFC project."),
+                    string2 + _DT(L" assigned to ") + string1 +
+                        _DT(L"; value should be between 1 and 0x6FFF if "
+                            "this is an MFC project."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
-                    }
-                else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
-                         idVal &&
-                         (idVal.value() < ID_RANGE_START || idVal.value() > STRING_ID_RANGE_END) &&
-                         (idNameParts[1] == L"IDS_" || idNameParts[1] == L"IDP_"))
-                    {
-                    m_ids_assigned_number.emplace_back(
+                    string_info::usage_info{}, fileName,
+                    std::make_pair(get_line_and_column(position).first, std::wstring::npos));
+                }
+            else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) && idVal &&
+                     (idVal.value() < ID_RANGE_START || idVal.value() > STRING_ID_RANGE_END) &&
+                     (idPrefix == L"IDS_" || idPrefix == L"IDP_"))
+                {
+                m_ids_assigned_number.emplace_back(
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
-                                           "0x7FFF if this is an MFC project."),
-                                         string2, string1)
-                            .wc_string(),
+                    wxString::Format(_(L"%s assigned to %s; value should be between 1 and "
+                                       "0x7FFF if this is an MFC project."),
+                                     string2, string1)
+                        .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1 +
-                            _DT(L"; value should be between 1 and 0x7FFF if "
-                                "this is an MFC project."),
+                    string2 + _DT(L" assigned to ") + string1 +
+                        _DT(L"; value should be between 1 and 0x7FFF if "
+                            "this is an MFC project."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
-                    }
-                else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
-                         idVal &&
-                         (idVal.value() < DIALOG_ID_RANGE_START ||
-                          idVal.value() > DIALOG_ID_RANGE_END) &&
-                         idNameParts[1] == L"IDC_")
-                    {
-                    m_ids_assigned_number.emplace_back(
+                    string_info::usage_info{}, fileName,
+                    std::make_pair(get_line_and_column(position).first, std::wstring::npos));
+                }
+            else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) && idVal &&
+                     (idVal.value() < DIALOG_ID_RANGE_START ||
+                      idVal.value() > DIALOG_ID_RANGE_END) &&
+                     idPrefix == L"IDC_")
+                {
+                m_ids_assigned_number.emplace_back(
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s; value should be between 8 and "
-                                           "0xDFFF if this is an MFC project."),
-                                         string2, string1)
-                            .wc_string(),
+                    wxString::Format(_(L"%s assigned to %s; value should be between 8 and "
+                                       "0xDFFF if this is an MFC project."),
+                                     string2, string1)
+                        .wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1 +
-                            _DT(L"; value should be between 8 and 0xDFFF if "
-                                "this is an MFC project."),
+                    string2 + _DT(L" assigned to ") + string1 +
+                        _DT(L"; value should be between 8 and 0xDFFF if "
+                            "this is an MFC project."),
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
-                    }
-                else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
-                         idNameParts[1].length() <= 3 && // ignore MFC IDs (handled above)
-                         std::regex_match(string2, numRE) &&
-                         // -1 or 0 are usually generic IDs for the framework or
-                         // temporary init values
-                         string2 != L"-1" && string2 != L"0")
-                    {
-                    m_ids_assigned_number.emplace_back(
+                    string_info::usage_info{}, fileName,
+                    std::make_pair(get_line_and_column(position).first, std::wstring::npos));
+                }
+            else if (static_cast<bool>(m_review_styles & check_number_assigned_to_id) &&
+                     idPrefix.length() <= 3 && // ignore MFC IDs (handled above)
+                     isNumber() &&
+                     // -1 or 0 are usually generic IDs for the framework or
+                     // temporary init values
+                     string2 != L"-1" && string2 != L"0")
+                {
+                m_ids_assigned_number.emplace_back(
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s assigned to %s"), string2, string1).wc_string(),
+                    wxString::Format(_(L"%s assigned to %s"), string2, string1).wc_string(),
 #else
-                        string2 + _DT(L" assigned to ") + string1,
+                    string2 + _DT(L" assigned to ") + string1,
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
-                    }
+                    string_info::usage_info{}, fileName,
+                    std::make_pair(get_line_and_column(position).first, std::wstring::npos));
+                }
 
-                const auto [pos, inserted] = assignedIds.insert(std::make_pair(string2, string1));
+            if (m_review_duplicate_ids_across_files)
+                {
+                add_assigned_id(string2,
+                                assigned_id{ string1, fileName,
+                                             std::make_pair(get_line_and_column(position).first,
+                                                            std::wstring::npos) });
+                }
+            else if (const auto [pos, inserted] = fileAssignedIds.try_emplace(string2, string1);
+                     !inserted && is_duplicate_id_assignment(string2, string1, pos->second))
+                {
+                m_duplicates_value_assigned_to_ids.emplace_back(
+                    format_duplicate_id_message(string2), string_info::usage_info{}, fileName,
+                    std::make_pair(get_line_and_column(position).first, std::wstring::npos));
+                }
+            }
+        }
 
-                if (static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) &&
-                    !inserted && !string2.empty() &&
-                    // ignore if same ID is assigned to variables with the same name
-                    string1 != pos->second && string2 != L"wxID_ANY" && string2 != L"wxID_NONE" &&
-                    string2 != L"-1" && string2 != L"0")
-                    {
-                    m_duplicates_value_assigned_to_ids.emplace_back(
+    //--------------------------------------------------
+    void i18n_review::add_assigned_id(const std::wstring& idValue, assigned_id assignment)
+        {
+        auto& assignments = m_assigned_ids[idValue];
+        const auto insertPos =
+            std::upper_bound(assignments.begin(), assignments.end(), assignment.m_file_name,
+                             [](const auto& fileName, const auto& assigned)
+                             { return fileName < assigned.m_file_name; });
+        if (insertPos != assignments.end())
+            {
+            // a reloaded file can come before files that were already loaded,
+            // which changes which variable the value was first assigned to
+            assignments.insert(insertPos, std::move(assignment));
+            review_assigned_id(idValue);
+            return;
+            }
+
+        if (!assignments.empty() &&
+            is_duplicate_id_assignment(idValue, assignment.m_variable,
+                                       assignments.front().m_variable))
+            {
+            m_duplicates_value_assigned_to_ids.emplace_back(format_duplicate_id_message(idValue),
+                                                            string_info::usage_info{},
+                                                            assignment.m_file_name,
+                                                            assignment.m_position);
+            }
+        assignments.push_back(std::move(assignment));
+        }
+
+    //--------------------------------------------------
+    void i18n_review::review_assigned_id(const std::wstring& idValue)
+        {
+        const std::wstring message{ format_duplicate_id_message(idValue) };
+        std::erase_if(m_duplicates_value_assigned_to_ids,
+                      [&message](const auto& str) { return str.m_string == message; });
+
+        const auto assignments = m_assigned_ids.find(idValue);
+        if (assignments == m_assigned_ids.cend() || assignments->second.empty())
+            {
+            return;
+            }
+        const auto& firstVariable = assignments->second.front().m_variable;
+        for (auto assignment = std::next(assignments->second.cbegin());
+             assignment != assignments->second.cend(); ++assignment)
+            {
+            if (is_duplicate_id_assignment(idValue, assignment->m_variable, firstVariable))
+                {
+                m_duplicates_value_assigned_to_ids.emplace_back(
+                    message, string_info::usage_info{}, assignment->m_file_name,
+                    assignment->m_position);
+                }
+            }
+        }
+
+    //--------------------------------------------------
+    bool i18n_review::is_duplicate_id_assignment(const std::wstring& idValue,
+                                                 const std::wstring& variable,
+                                                 const std::wstring& firstVariable) const
+        {
+        return static_cast<bool>(m_review_styles & check_duplicate_value_assigned_to_ids) &&
+               !idValue.empty() &&
+               // ignore if same ID is assigned to variables with the same name
+               variable != firstVariable && idValue != L"wxID_ANY" && idValue != L"wxID_NONE" &&
+               idValue != L"-1" && idValue != L"0";
+        }
+
+    //--------------------------------------------------
+    std::wstring i18n_review::format_duplicate_id_message(const std::wstring& idValue)
+        {
 #ifdef wxVERSION_NUMBER
-                        wxString::Format(_(L"%s has been assigned to multiple ID variables."),
-                                         string2)
-                            .wc_string(),
+        return wxString::Format(_(L"%s has been assigned to multiple ID variables."), idValue)
+            .wc_string();
 #else
-                        string2 + _DT(L" has been assigned to multiple ID variables."),
+        return idValue + _DT(L" has been assigned to multiple ID variables.");
 #endif
-                        string_info::usage_info{}, fileName,
-                        std::make_pair(get_line_and_column(position, fileText).first,
-                                       std::wstring::npos));
-                    }
-                }
-            }
         }
 
     //--------------------------------------------------
@@ -1896,21 +2558,26 @@ namespace i18n_check
                 return false;
                 }
             // Single word with multiple punctuation marks?
-            const size_t punctCount = std::count_if(str.cbegin(), str.cend(),
-                                                    [](const auto chr)
-                                                    {
-                                                        return std::iswpunct(chr) && chr != L'-' &&
-                                                               chr != L'/' && chr != L'\\' &&
-                                                               chr != L'&' && chr != L'.';
-                                                    });
+            const size_t punctCount =
+                std::count_if(str.cbegin(), str.cend(),
+                              [](const auto chr)
+                              {
+                                  return i18n_string_util::is_punctuation(chr) && chr != L'-' &&
+                                         chr != L'/' && chr != L'\\' && chr != L'&' &&
+                                         chr != L'.';
+                              });
             if (punctCount > 1)
                 {
                 return true;
                 }
             // All CAPS and/or punctuation?
             const size_t cappedOrPunctCount =
-                std::count_if(str.cbegin(), str.cend(), [](const auto chr)
-                              { return std::iswupper(chr) || std::iswpunct(chr); });
+                std::count_if(str.cbegin(), str.cend(),
+                              [](const auto chr)
+                              {
+                                  return i18n_string_util::is_upper(chr) ||
+                                         i18n_string_util::is_punctuation(chr);
+                              });
             return cappedOrPunctCount == str.length();
             }
 
@@ -1964,7 +2631,7 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    void i18n_review::process_quote(wchar_t* currentTextPos, const wchar_t* quoteEnd,
+    void i18n_review::process_quote(const wchar_t* currentTextPos, const wchar_t* quoteEnd,
                                     const wchar_t* functionVarNamePos,
                                     const std::wstring& functionName,
                                     const variable_info& variableInfo,
@@ -1975,6 +2642,9 @@ namespace i18n_check
         // quote is really being sent to a function. This will pick up any + or ?: operations in
         // front of this quote (inside the arguments to the parent function) that may be relevant
         // later.
+        // Also, note that the quote may have sections masked within it (e.g., comments between
+        // the parts of a multipart string), which are read as spaces.
+        const std::wstring quoteText{ get_section(currentTextPos, quoteEnd) };
         if (!deprecatedMacroEncountered.empty() &&
             static_cast<bool>(m_review_styles & check_deprecated_macros))
             {
@@ -1991,17 +2661,14 @@ namespace i18n_check
 
         if (!variableInfo.m_name.empty())
             {
-            process_variable(
-                variableInfo,
-                std::wstring_view{ currentTextPos, static_cast<size_t>(quoteEnd - currentTextPos) },
-                (currentTextPos - m_file_start));
+            process_variable(variableInfo, quoteText, (currentTextPos - m_file_start));
             }
         else if (!functionName.empty())
             {
             if (is_diagnostic_function(functionName))
                 {
                 m_internal_strings.emplace_back(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    quoteText,
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
                     m_file_name, get_line_and_column(currentTextPos - m_file_start));
@@ -2034,7 +2701,7 @@ namespace i18n_check
                     (functionName == L"wxGetTranslation" && parameterPosition >= 1))
                     {
                     m_internal_strings.emplace_back(
-                        std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                        quoteText,
                         string_info::usage_info(string_info::usage_info::usage_type::function,
                                                 functionName, std::wstring{},
                                                 variableInfo.m_operator),
@@ -2048,8 +2715,7 @@ namespace i18n_check
                         !functionName.starts_with(L"i18n") && !functionName.starts_with(L"ki18n"))
                         {
                         m_suspect_i18n_usage.emplace_back(
-                            std::wstring{ currentTextPos,
-                                          static_cast<size_t>(quoteEnd - currentTextPos) },
+                            quoteText,
                             string_info::usage_info(
                                 string_info::usage_info::usage_type::function,
 #ifdef wxVERSION_NUMBER
@@ -2095,7 +2761,7 @@ namespace i18n_check
                 else
                     {
                     m_localizable_strings.emplace_back(
-                        std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                        quoteText,
                         string_info::usage_info(
                             string_info::usage_info::usage_type::function, functionName,
                             std::wstring{}, variableInfo.m_operator,
@@ -2132,7 +2798,7 @@ namespace i18n_check
                             m_variable_types_to_ignore.contains(functionNameOuter))
                             {
                             m_localizable_strings_in_internal_call.emplace_back(
-                                std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                                quoteText,
                                 string_info::usage_info(
                                     string_info::usage_info::usage_type::function,
                                     functionNameOuter, std::wstring{}, variableInfo.m_operator),
@@ -2142,7 +2808,7 @@ namespace i18n_check
                         else if (m_variable_types_to_ignore.contains(outerVariable.m_type))
                             {
                             m_localizable_strings_in_internal_call.emplace_back(
-                                std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                                quoteText,
                                 string_info::usage_info(
                                     string_info::usage_info::usage_type::variable,
                                     outerVariable.m_name, outerVariable.m_type,
@@ -2154,20 +2820,16 @@ namespace i18n_check
                             {
                             try
                                 {
-                                for (const auto& reg : get_ignored_variable_patterns())
+                                if (is_ignored_variable_name(outerVariable.m_name))
                                     {
-                                    if (std::regex_match(outerVariable.m_name, reg))
-                                        {
-                                        m_localizable_strings_in_internal_call.emplace_back(
-                                            std::wstring(currentTextPos, quoteEnd - currentTextPos),
-                                            string_info::usage_info(
-                                                string_info::usage_info::usage_type::variable,
-                                                outerVariable.m_name, outerVariable.m_type,
-                                                outerVariable.m_operator),
-                                            m_file_name,
-                                            get_line_and_column(currentTextPos - m_file_start));
-                                        break;
-                                        }
+                                    m_localizable_strings_in_internal_call.emplace_back(
+                                        quoteText,
+                                        string_info::usage_info(
+                                            string_info::usage_info::usage_type::variable,
+                                            outerVariable.m_name, outerVariable.m_type,
+                                            outerVariable.m_operator),
+                                        m_file_name,
+                                        get_line_and_column(currentTextPos - m_file_start));
                                     }
                                 }
                             catch (const std::exception& exp)
@@ -2185,7 +2847,7 @@ namespace i18n_check
             else if (is_non_i18n_function(functionName))
                 {
                 m_marked_as_non_localizable_strings.emplace_back(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    quoteText,
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
                     m_file_name, get_line_and_column(currentTextPos - m_file_start));
@@ -2193,7 +2855,7 @@ namespace i18n_check
             else if (m_variable_types_to_ignore.contains(functionName))
                 {
                 m_internal_strings.emplace_back(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    quoteText,
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
                     m_file_name, get_line_and_column(currentTextPos - m_file_start));
@@ -2201,7 +2863,7 @@ namespace i18n_check
             else if (is_keyword(functionName))
                 {
                 classify_non_localizable_string(
-                    string_info(std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    string_info(quoteText,
                                 string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                         std::wstring{}, std::wstring{},
                                                         variableInfo.m_operator),
@@ -2210,7 +2872,7 @@ namespace i18n_check
             else
                 {
                 classify_non_localizable_string(string_info(
-                    std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                    quoteText,
                     string_info::usage_info(string_info::usage_info::usage_type::function,
                                             functionName, std::wstring{}, variableInfo.m_operator),
                     m_file_name, get_line_and_column(currentTextPos - m_file_start)));
@@ -2219,12 +2881,12 @@ namespace i18n_check
         else
             {
             classify_non_localizable_string(string_info(
-                std::wstring(currentTextPos, quoteEnd - currentTextPos),
+                quoteText,
                 string_info::usage_info(string_info::usage_info::usage_type::orphan, std::wstring{},
                                         std::wstring{}, variableInfo.m_operator),
                 m_file_name, get_line_and_column(currentTextPos - m_file_start)));
             }
-        clear_section(currentTextPos, std::next(quoteEnd));
+        mask_section(currentTextPos, std::next(quoteEnd));
         }
 
     //--------------------------------------------------
@@ -2275,30 +2937,23 @@ namespace i18n_check
                 m_file_name, get_line_and_column(quotePosition));
             return;
             }
-        if (!get_ignored_variable_patterns().empty())
+        if (!m_variable_name_patterns_to_ignore.empty())
             {
             try
                 {
-                bool matchedInternalVar(false);
-                for (const auto& reg : get_ignored_variable_patterns())
+                if (is_ignored_variable_name(variableInfo.m_name))
                     {
-                    if (std::regex_match(variableInfo.m_name, reg))
-                        {
-                        m_internal_strings.emplace_back(
-                            std::move(clippedValue),
-                            string_info::usage_info(string_info::usage_info::usage_type::variable,
-                                                    variableInfo.m_name, variableInfo.m_type,
-                                                    variableInfo.m_operator),
-                            m_file_name, get_line_and_column(quotePosition));
-                        matchedInternalVar = true;
-                        break;
-                        }
+                    m_internal_strings.emplace_back(
+                        std::move(clippedValue),
+                        string_info::usage_info(string_info::usage_info::usage_type::variable,
+                                                variableInfo.m_name, variableInfo.m_type,
+                                                variableInfo.m_operator),
+                        m_file_name, get_line_and_column(quotePosition));
                     }
-                // didn't match any known internal variable name provided by user?
-                if (!matchedInternalVar)
+                // didn't match any known internal variable name provided by user
+                else
                     {
                     classify_non_localizable_string(string_info(
-                        // NOLINTNEXTLINE(bugprone-use-after-move, hicpp-invalid-access-moved)
                         std::move(clippedValue),
                         string_info::usage_info(string_info::usage_info::usage_type::variable,
                                                 variableInfo.m_name, variableInfo.m_type,
@@ -2371,21 +3026,111 @@ namespace i18n_check
         m_wide_lines.clear();
         m_comments_missing_space.clear();
         m_suspect_i18n_usage.clear();
+        m_ignored_variable_names.clear();
 
         m_wx_info = wx_project_info{};
+        m_assigned_ids.clear();
+        m_reviewed_string_counts = reviewed_string_counts{};
+
+        m_string_classifications.clear();
+        m_string_classification_lookups = 0;
+        m_string_classification_cache_hits = 0;
+        m_backward_scan_steps = 0;
+        }
+
+    //--------------------------------------------------
+    void i18n_review::clear_file_results(const std::filesystem::path& file)
+        {
+        const auto isFromFile = [&file](const auto& str) { return str.m_file_name == file; };
+        // the strings that were already reviewed stay at the front,
+        // so only count how many of those are removed
+        const auto clearLoadedStrings = [&isFromFile](std::vector<string_info>& strings,
+                                                      size_t& reviewedCount)
+        {
+            reviewedCount -= static_cast<size_t>(
+                std::count_if(strings.cbegin(),
+                              std::next(strings.cbegin(), static_cast<ptrdiff_t>(reviewedCount)),
+                              isFromFile));
+            std::erase_if(strings, isFromFile);
+        };
+
+        clearLoadedStrings(m_localizable_strings, m_reviewed_string_counts.m_localizable);
+        clearLoadedStrings(m_localizable_strings_in_internal_call,
+                           m_reviewed_string_counts.m_localizable_in_internal_call);
+        clearLoadedStrings(m_not_available_for_localization_strings,
+                           m_reviewed_string_counts.m_not_available_for_localization);
+        clearLoadedStrings(m_marked_as_non_localizable_strings,
+                           m_reviewed_string_counts.m_marked_as_non_localizable);
+        clearLoadedStrings(m_internal_strings, m_reviewed_string_counts.m_internal);
+        clearLoadedStrings(m_unsafe_localizable_strings,
+                           m_reviewed_string_counts.m_unsafe_localizable);
+
+        std::erase_if(m_localizable_strings_with_unlocalizable_content, isFromFile);
+        std::erase_if(m_localizable_strings_with_urls, isFromFile);
+        std::erase_if(m_localizable_strings_ambiguous_needing_context, isFromFile);
+        std::erase_if(m_localizable_strings_being_concatenated, isFromFile);
+        std::erase_if(m_literal_localizable_strings_being_compared, isFromFile);
+        std::erase_if(m_localizable_strings_with_halfwidths, isFromFile);
+        std::erase_if(m_multipart_strings, isFromFile);
+        std::erase_if(m_faux_plural_strings, isFromFile);
+        std::erase_if(m_article_issue_strings, isFromFile);
+        std::erase_if(m_deprecated_macros, isFromFile);
+        std::erase_if(m_unencoded_strings, isFromFile);
+        std::erase_if(m_escaped_unicode_strings, isFromFile);
+        std::erase_if(m_printf_single_numbers, isFromFile);
+        std::erase_if(m_ids_assigned_number, isFromFile);
+        std::erase_if(m_duplicates_value_assigned_to_ids, isFromFile);
+        std::erase_if(m_malformed_strings, isFromFile);
+        std::erase_if(m_trailing_spaces, isFromFile);
+        std::erase_if(m_tabs, isFromFile);
+        std::erase_if(m_wide_lines, isFromFile);
+        std::erase_if(m_comments_missing_space, isFromFile);
+        std::erase_if(m_suspect_i18n_usage, isFromFile);
+        std::erase_if(m_error_log, isFromFile);
+
+        if (m_wx_info.m_app_init_info.m_file_name == file)
+            {
+            m_wx_info.m_app_init_info = string_info{};
+            }
+        m_wx_info.m_wxuilocale_initialized_files.erase(file);
+        m_wx_info.m_wxlocale_initialized_files.erase(file);
+
+        // values that were also assigned in other files may no longer be duplicates
+        for (auto assignments = m_assigned_ids.begin(); assignments != m_assigned_ids.end();)
+            {
+            if (std::erase_if(assignments->second, isFromFile) == 0)
+                {
+                ++assignments;
+                }
+            else if (assignments->second.empty())
+                {
+                assignments = m_assigned_ids.erase(assignments);
+                }
+            else
+                {
+                review_assigned_id(assignments->first);
+                ++assignments;
+                }
+            }
         }
 
     //--------------------------------------------------
     bool i18n_review::is_diagnostic_function(const std::wstring& functionName) const
         {
+        auto& resolved = resolve_function(functionName);
+        if (resolved.m_isDiagnostic.has_value())
+            {
+            return resolved.m_isDiagnostic.value();
+            }
         try
             {
-            return (
-                std::regex_match(functionName, m_diagnostic_function_regex) ||
-                (m_internal_functions.contains(functionName)) ||
-                (m_internal_functions.contains(extract_base_function(functionName))) ||
-                functionName.ends_with(L"_TRACE") || functionName.ends_with(L"_DEBUG") ||
-                (!can_log_messages_be_translatable() && m_log_functions.contains(functionName)));
+            resolved.m_isDiagnostic =
+                (std::regex_match(functionName, m_diagnostic_function_regex) ||
+                 resolved.has_role(function_role::internal) ||
+                 functionName.ends_with(L"_TRACE") || functionName.ends_with(L"_DEBUG") ||
+                 (!can_log_messages_be_translatable() &&
+                  resolved.has_name_role(function_role::log)));
+            return resolved.m_isDiagnostic.value();
             }
         catch (const std::exception& exp)
             {
@@ -2395,6 +3140,41 @@ namespace i18n_check
             }
         }
 
+    //--------------------------------------------------
+    std::pair<bool, size_t> i18n_review::classify_untranslatable_string(const std::wstring& str,
+                                                                        const bool limitWordCount)
+        {
+        const auto checkFlag = static_cast<uint16_t>(
+            limitWordCount ? string_check::untranslatable_limited_word_count :
+                             string_check::untranslatable);
+        ++m_string_classification_lookups;
+        auto& classification = m_string_classifications[str];
+        auto& translatableContentLength =
+            limitWordCount ? classification.m_translatableContentLengths.second :
+                             classification.m_translatableContentLengths.first;
+        if ((classification.m_checked & checkFlag) != 0)
+            {
+            ++m_string_classification_cache_hits;
+            return std::make_pair((classification.m_verdicts & checkFlag) != 0,
+                                  translatableContentLength);
+            }
+
+        const size_t errorCount{ m_error_log.size() };
+        const auto result = is_untranslatable_string(str, limitWordCount);
+        // if the review logged an error, then don't keep its verdict so that
+        // the error is logged again for the next occurrence of the string
+        if (m_error_log.size() == errorCount)
+            {
+            classification.m_checked |= checkFlag;
+            if (result.first)
+                {
+                classification.m_verdicts |= checkFlag;
+                }
+            translatableContentLength = result.second;
+            }
+        return result;
+        }
+
     //--------------------------------------------------
     std::pair<bool, size_t> i18n_review::is_untranslatable_string(std::wstring strToReview,
                                                                   const bool limitWordCount) const
@@ -2441,8 +3221,8 @@ namespace i18n_check
                 {
                 chr = L' ';
                 }
-            if (allPunctOrSpaces && (std::iswdigit(chr) == 0) && (std::iswpunct(chr) == 0) &&
-                (std::iswspace(chr) == 0))
+            if (allPunctOrSpaces && (std::iswdigit(chr) == 0) &&
+                !i18n_string_util::is_punctuation(chr) && !i18n_string_util::is_space(chr))
                 {
                 allPunctOrSpaces = false;
                 }
@@ -2579,7 +3359,7 @@ namespace i18n_check
                  strToReview.find(L"\\n") == std::wstring::npos &&
                  strToReview.find(L"\\r") == std::wstring::npos &&
                  strToReview.find(L"\\t") == std::wstring::npos) ||
-                m_known_internal_strings.contains(strToReview.c_str()) ||
+                m_known_internal_strings.contains(strToReview) ||
                 // a string like "_tcscoll" be odd to be in string, but just in case it
                 // should not be localized
                 m_deprecated_string_functions.contains(strToReview.c_str()) ||
@@ -2638,8 +3418,8 @@ namespace i18n_check
                     return std::make_pair(true, strToReview.length());
                     }
                 }
-            return std::make_pair((is_font_name(strToReview.c_str()) ||
-                                   is_file_extension(strToReview.c_str()) ||
+            return std::make_pair((is_font_name(strToReview) ||
+                                   is_file_extension(strToReview) ||
                                    i18n_string_util::is_file_address(strToReview)),
                                   strToReview.length());
             }
@@ -2671,72 +3451,50 @@ namespace i18n_check
     //--------------------------------------------------
     void i18n_review::process_strings()
         {
-        const auto processStrings = [this](auto& strings)
+        // (the strings from before the last review were already processed)
+        const auto processStrings = [this](auto& strings, const size_t reviewedCount)
         {
-            std::for_each(strings.begin(), strings.end(), [this](auto& val)
+            std::for_each(std::next(strings.begin(), static_cast<ptrdiff_t>(reviewedCount)),
+                          strings.end(), [this](auto& val)
                           { val.m_string = i18n_review::collapse_multipart_string(val.m_string); });
         };
-        processStrings(m_localizable_strings);
-        processStrings(m_localizable_strings_in_internal_call);
-        processStrings(m_not_available_for_localization_strings);
-        processStrings(m_marked_as_non_localizable_strings);
-        processStrings(m_internal_strings);
-        processStrings(m_unsafe_localizable_strings);
+        processStrings(m_localizable_strings, m_reviewed_string_counts.m_localizable);
+        processStrings(m_localizable_strings_in_internal_call,
+                       m_reviewed_string_counts.m_localizable_in_internal_call);
+        processStrings(m_not_available_for_localization_strings,
+                       m_reviewed_string_counts.m_not_available_for_localization);
+        processStrings(m_marked_as_non_localizable_strings,
+                       m_reviewed_string_counts.m_marked_as_non_localizable);
+        processStrings(m_internal_strings, m_reviewed_string_counts.m_internal);
+        processStrings(m_unsafe_localizable_strings, m_reviewed_string_counts.m_unsafe_localizable);
         }
 
     //--------------------------------------------------
     void i18n_review::run_diagnostics() const
         {
-        for (const auto& str : m_localizable_strings)
-            {
-            if (str.m_usage.m_value.empty() &&
-                str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
-                {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
-                            std::wstring::npos);
-                }
-            }
-        for (const auto& str : m_not_available_for_localization_strings)
-            {
-            if (str.m_usage.m_value.empty() &&
-                str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
-                {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
-                            std::wstring::npos);
-                }
-            }
-        for (const auto& str : m_marked_as_non_localizable_strings)
-            {
-            if (str.m_usage.m_value.empty() &&
-                str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
-                {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
-                            std::wstring::npos);
-                }
-            }
-        for (const auto& str : m_internal_strings)
-            {
-            if (str.m_usage.m_value.empty() &&
-                str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
-                {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
-                            std::wstring::npos);
-                }
-            }
-        for (const auto& str : m_unsafe_localizable_strings)
-            {
-            if (str.m_usage.m_value.empty() &&
-                str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
+        // (the strings from before the last review were already diagnosed)
+        const auto diagnoseStrings = [this](const std::vector<string_info>& strings,
+                                            const size_t reviewedCount)
+        {
+            for (const auto& str : std::span<const string_info>{ strings }.subspan(reviewedCount))
                 {
-                log_message(str.m_string,
-                            L"Unknown function or variable assignment for this string.",
-                            std::wstring::npos);
+                if (str.m_usage.m_value.empty() &&
+                    str.m_usage.m_type != string_info::usage_info::usage_type::orphan)
+                    {
+                    log_message(str.m_string,
+                                L"Unknown function or variable assignment for this string.",
+                                std::wstring::npos);
+                    }
                 }
-            }
+        };
+        diagnoseStrings(m_localizable_strings, m_reviewed_string_counts.m_localizable);
+        diagnoseStrings(m_not_available_for_localization_strings,
+                        m_reviewed_string_counts.m_not_available_for_localization);
+        diagnoseStrings(m_marked_as_non_localizable_strings,
+                        m_reviewed_string_counts.m_marked_as_non_localizable);
+        diagnoseStrings(m_internal_strings, m_reviewed_string_counts.m_internal);
+        diagnoseStrings(m_unsafe_localizable_strings,
+                        m_reviewed_string_counts.m_unsafe_localizable);
         }
 
     //--------------------------------------------------
@@ -2751,24 +3509,66 @@ namespace i18n_check
         variableInfo.reset();
         parameterPosition = 0;
         deprecatedMacroEncountered.clear();
+
+        // the points passed by the last scan (reused if this scan joins it)
+        std::optional<scan_trail> previousTrail{ std::move(m_scan_trail) };
+        m_scan_trail.reset();
+        if (previousTrail && previousTrail->m_startSentinel != startSentinel)
+            {
+            previousTrail.reset();
+            }
+        // the next point in the previous trail that this scan could reach (plus one)
+        size_t trailIndex{ previousTrail ? previousTrail->m_points.size() : 0 };
+        std::vector<scan_point> scannedPoints;
+        const wchar_t* const scanStart{ startPos };
+        const size_t errorCount{ m_error_log.size() };
+
+        // Stores the points that this scan passed (if it can be reused),
+        // after the points from the trail that it joined (if any).
+        const auto storeTrail = [&](scan_trail trail, const wchar_t* namePos)
+        {
+            // scans connecting the string to a localization function also review the
+            // function's outer call (and log errors), so don't skip those later
+            if (m_error_log.size() != errorCount || is_i18n_function(functionName))
+                {
+                return;
+                }
+            trail.m_startSentinel = startSentinel;
+            trail.m_functionOrVarNamePos = (namePos == scanStart) ? nullptr : namePos;
+            for (auto point = scannedPoints.rbegin(); point != scannedPoints.rend(); ++point)
+                {
+                point->m_parameterPosition = parameterPosition - point->m_parameterPosition;
+                point->m_functionOrVarNamePosMatters =
+                    (point->m_functionOrVarNamePos == trail.m_functionOrVarNamePos);
+                trail.m_points.push_back(*point);
+                }
+            m_scan_trail = std::move(trail);
+        };
+        const auto cacheCallContext = [&](const wchar_t* namePos)
+        {
+            storeTrail(scan_trail{ startSentinel, {}, nullptr, functionName, variableInfo,
+                                   deprecatedMacroEncountered },
+                       namePos);
+            return namePos;
+        };
+
         int32_t closeParenCount{ 0 };
         int32_t closeBraseCount{ 0 };
         bool quoteWrappedInCTOR{ false };
         const wchar_t* functionOrVarNamePos = startPos;
 
         const auto readOperator =
-            [&variableInfo](const wchar_t* startingPos, const wchar_t* operatorEnd)
+            [this, &variableInfo](const wchar_t* startingPos, const wchar_t* operatorEnd)
         {
             if (startingPos < operatorEnd)
                 {
                 const wchar_t* operatorStart{ startingPos };
                 while (std::next(operatorStart) < operatorEnd &&
-                       static_cast<bool>(std::iswspace(*operatorStart)))
+                       i18n_string_util::is_space(char_at(operatorStart)))
                     {
                     std::advance(operatorStart, 1);
                     }
-                variableInfo.m_operator.assign(operatorStart,
-                                               static_cast<size_t>(operatorEnd - operatorStart));
+                variableInfo.m_operator = get_section(operatorStart, operatorEnd);
                 string_util::trim(variableInfo.m_operator);
                 }
         };
@@ -2785,47 +3585,50 @@ namespace i18n_check
                     }
                 std::advance(functionOrVarNamePos, -1);
                 while (functionOrVarNamePos > startSentinel &&
-                       static_cast<bool>(std::iswspace(*functionOrVarNamePos)))
+                       i18n_string_util::is_space(char_at(functionOrVarNamePos)))
                     {
                     std::advance(functionOrVarNamePos, -1);
                     }
                 const auto* typeEnd = std::next(functionOrVarNamePos);
                 // if a template, then step over (going backwards) the template arguments
                 // to get to the root type
-                if (std::prev(typeEnd) > startSentinel && *std::prev(typeEnd) == L'>')
+                if (std::prev(typeEnd) > startSentinel && char_at(std::prev(typeEnd)) == L'>')
                     {
                     // if a pointer accessor (->) then bail as it won't be a variable assignment
-                    if (std::prev(typeEnd, 2) > startSentinel && *std::prev(typeEnd, 2) == L'-')
+                    if (std::prev(typeEnd, 2) > startSentinel &&
+                        char_at(std::prev(typeEnd, 2)) == L'-')
                         {
                         return;
                         }
                     assert(functionOrVarNamePos >= startSentinel);
-                    const auto openingAngle = std::wstring_view{ startSentinel }.find_last_of(
-                        L'<', functionOrVarNamePos - startSentinel);
-                    if (openingAngle == std::wstring::npos)
+                    const wchar_t* openingAngle{ functionOrVarNamePos };
+                    while (openingAngle > startSentinel && char_at(openingAngle) != L'<')
+                        {
+                        std::advance(openingAngle, -1);
+                        }
+                    if (char_at(openingAngle) != L'<')
                         {
                         log_message(L"Template parse error",
                                     L"Unable to find opening < for template variable.",
                                     functionOrVarNamePos - startSentinel);
                         return;
                         }
-                    functionOrVarNamePos =
-                        std::next(startSentinel, static_cast<ptrdiff_t>(openingAngle));
+                    functionOrVarNamePos = openingAngle;
                     }
-                while (
-                    functionOrVarNamePos > startSentinel &&
-                    (is_valid_name_char_ex(*functionOrVarNamePos) || *functionOrVarNamePos == L'&'))
+                while (functionOrVarNamePos > startSentinel &&
+                       (is_valid_name_char_ex(char_at(functionOrVarNamePos)) ||
+                        char_at(functionOrVarNamePos) == L'&'))
                     {
                     std::advance(functionOrVarNamePos, -1);
                     }
-                if (!is_valid_name_char_ex(*functionOrVarNamePos))
+                if (!is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                     {
                     std::advance(functionOrVarNamePos, 1);
                     }
-                variableInfo.m_type.assign(functionOrVarNamePos, typeEnd - functionOrVarNamePos);
+                variableInfo.m_type = get_section(functionOrVarNamePos, typeEnd);
                 // make sure the variable type is a word, not something like "<<"
                 if (!variableInfo.m_type.empty() &&
-                    !static_cast<bool>(std::iswalpha(variableInfo.m_type.front())))
+                    !i18n_string_util::is_alpha(variableInfo.m_type.front()))
                     {
                     variableInfo.m_type.clear();
                     }
@@ -2848,28 +3651,77 @@ namespace i18n_check
 
         while (startPos > startSentinel)
             {
-            if (*startPos == L')')
+            ++m_backward_scan_steps;
+            const wchar_t currentChar{ char_at(startPos) };
+            // if nothing has been found yet, then see if the last scan went through here
+            // in the same state (and if so, this scan would end up the same way)
+            if ((startPos == scanStart || currentChar == L',' || currentChar == L'(' ||
+                 currentChar == L'{') &&
+                functionName.empty() && deprecatedMacroEncountered.empty() &&
+                variableInfo.m_name.empty() && variableInfo.m_type.empty() &&
+                variableInfo.m_operator.empty())
+                {
+                const scan_point currentPoint{
+                    startPos,
+                    closeParenCount,
+                    closeBraseCount,
+                    quoteWrappedInCTOR,
+                    (functionOrVarNamePos == scanStart) ? nullptr : functionOrVarNamePos,
+                    true,
+                    parameterPosition
+                };
+                if (previousTrail)
+                    {
+                    const auto& trailPoints{ previousTrail->m_points };
+                    while (trailIndex > 0 && trailPoints[trailIndex - 1].m_position > startPos)
+                        {
+                        --trailIndex;
+                        }
+                    for (size_t i = trailIndex;
+                         i > 0 && trailPoints[i - 1].m_position == startPos; --i)
+                        {
+                        if (trailPoints[i - 1].is_joined_by(currentPoint))
+                            {
+                            parameterPosition += trailPoints[i - 1].m_parameterPosition;
+                            functionName = previousTrail->m_functionName;
+                            variableInfo = previousTrail->m_variableInfo;
+                            deprecatedMacroEncountered =
+                                previousTrail->m_deprecatedMacroEncountered;
+                            const wchar_t* const namePos =
+                                (previousTrail->m_functionOrVarNamePos == nullptr) ?
+                                    scanStart :
+                                    previousTrail->m_functionOrVarNamePos;
+                            // the points before this are only from the previous scan
+                            previousTrail->m_points.resize(i);
+                            storeTrail(std::move(previousTrail.value()), namePos);
+                            return namePos;
+                            }
+                        }
+                    }
+                scannedPoints.push_back(currentPoint);
+                }
+
+            if (currentChar == L')')
                 {
                 ++closeParenCount;
                 std::advance(startPos, -1);
                 }
-            else if (*startPos == L'}')
+            else if (currentChar == L'}')
                 {
                 ++closeBraseCount;
                 std::advance(startPos, -1);
                 }
-            else if (*startPos == L'(' || *startPos == L'{')
+            else if (currentChar == L'(' || currentChar == L'{')
                 {
-                const auto currentOpeningChar{ *startPos };
                 std::advance(startPos, -1);
                 // if just closing the terminating parenthesis for a function
                 // call in the list of parameters, then skip it and keep going
                 // to find the outer function call that this string really belongs to.
-                if (currentOpeningChar == L'(')
+                if (currentChar == L'(')
                     {
                     --closeParenCount;
                     }
-                else if (currentOpeningChar == L'{')
+                else if (currentChar == L'{')
                     {
                     --closeBraseCount;
                     }
@@ -2878,20 +3730,20 @@ namespace i18n_check
                     continue;
                     }
                 // skip whitespace between open parenthesis and function name
-                while (startPos > startSentinel && static_cast<bool>(std::iswspace(*startPos)))
+                while (startPos > startSentinel && i18n_string_util::is_space(char_at(startPos)))
                     {
                     std::advance(startPos, -1);
                     }
                 functionOrVarNamePos = startPos;
                 while (functionOrVarNamePos > startSentinel &&
-                       is_valid_name_char_ex(*functionOrVarNamePos))
+                       is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                     {
                     std::advance(functionOrVarNamePos, -1);
                     }
                 // If we are on the start of the text, then see if we need to
                 // include that character too. We may have short-circuited because
                 // we reached the start of the stream.
-                if (!is_valid_name_char_ex(*functionOrVarNamePos))
+                if (!is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                     {
                     std::advance(functionOrVarNamePos, 1);
                     }
@@ -2906,11 +3758,11 @@ namespace i18n_check
                     {
                     startPos = std::min(startPos, functionOrVarNamePos);
                     // reset, the current open parenthesis isn't relevant
-                    if (currentOpeningChar == L'(')
+                    if (currentChar == L'(')
                         {
                         closeParenCount = 0;
                         }
-                    else if (currentOpeningChar == L'{')
+                    else if (currentChar == L'{')
                         {
                         closeBraseCount = 0;
                         }
@@ -2922,8 +3774,9 @@ namespace i18n_check
                     // now we should be looking for a + operator, comma, or ( or { proceeding this
                     // (unless we are already on it because we stepped back too far
                     //      due to the string being inside an empty parenthesis)
-                    if (*startPos != L',' && *startPos != L'+' && *startPos != L'&' &&
-                        *startPos != L'=')
+                    if (const wchar_t previousChar{ char_at(startPos) };
+                        previousChar != L',' && previousChar != L'+' && previousChar != L'&' &&
+                        previousChar != L'=')
                         {
                         quoteWrappedInCTOR = true;
                         }
@@ -2943,12 +3796,14 @@ namespace i18n_check
                 if (!functionName.empty())
                     {
                     // see if function is actually a CTOR
-                    if (variableInfo.m_name.empty() &&
-                        !m_localization_functions.contains(functionName) &&
-                        !m_non_localizable_functions.contains(functionName) &&
-                        !m_internal_functions.contains(functionName) &&
-                        !m_log_functions.contains(functionName) &&
-                        functionOrVarNamePos >= startSentinel && !is_keyword(functionName))
+                    if (const auto& resolved = resolve_function(functionName);
+                        variableInfo.m_name.empty() &&
+                        !resolved.has_name_role(function_role::i18n) &&
+                        !resolved.has_name_role(function_role::non_i18n) &&
+                        !resolved.has_name_role(function_role::internal) &&
+                        !resolved.has_name_role(function_role::log) &&
+                        functionOrVarNamePos >= startSentinel &&
+                        !resolved.has_name_role(function_role::keyword))
                         {
                         readVarType();
 
@@ -2966,8 +3821,8 @@ namespace i18n_check
                         const wchar_t* operatorEnd{ std::next(startPos) };
                         // skip spaces (and "==" and "!=" tokens)
                         while (startPos > startSentinel &&
-                               (static_cast<bool>(std::iswspace(*startPos)) || *startPos == L'=' ||
-                                *startPos == L'!'))
+                               (i18n_string_util::is_space(char_at(startPos)) ||
+                                char_at(startPos) == L'=' || char_at(startPos) == L'!'))
                             {
                             std::advance(startPos, -1);
                             }
@@ -2999,43 +3854,44 @@ namespace i18n_check
             // deal with variable assignments here
             // (note that comparisons (>=, <=, ==, !=) are handled as though this string
             //      is a parameter to a function.)
-            else if (*startPos == L'=' && *std::next(startPos) != L'=' &&
-                     startPos > startSentinel && *std::prev(startPos) != L'=' &&
-                     *std::prev(startPos) != L'!' && *std::prev(startPos) != L'>' &&
-                     *std::prev(startPos) != L'<')
+            else if (currentChar == L'=' && char_at(std::next(startPos)) != L'=' &&
+                     startPos > startSentinel && char_at(std::prev(startPos)) != L'=' &&
+                     char_at(std::prev(startPos)) != L'!' && char_at(std::prev(startPos)) != L'>' &&
+                     char_at(std::prev(startPos)) != L'<')
                 {
                 const wchar_t* operatorEnd{ std::next(startPos) };
                 std::advance(startPos, -1);
                 // skip spaces (and "+=" tokens)
                 while (startPos > startSentinel &&
-                       (static_cast<bool>(std::iswspace(*startPos)) || *startPos == L'+'))
+                       (i18n_string_util::is_space(char_at(startPos)) || char_at(startPos) == L'+'))
                     {
                     std::advance(startPos, -1);
                     }
                 readOperator(std::next(startPos), operatorEnd);
                 // skip array info
-                if (startPos > startSentinel && *startPos == L']')
+                if (startPos > startSentinel && char_at(startPos) == L']')
                     {
-                    while (startPos > startSentinel && *startPos != L'[')
+                    while (startPos > startSentinel && char_at(startPos) != L'[')
                         {
                         std::advance(startPos, -1);
                         }
                     std::advance(startPos, -1);
-                    while (startPos > startSentinel && static_cast<bool>(std::iswspace(*startPos)))
+                    while (startPos > startSentinel &&
+                           i18n_string_util::is_space(char_at(startPos)))
                         {
                         std::advance(startPos, -1);
                         }
                     }
                 functionOrVarNamePos = startPos;
                 while (functionOrVarNamePos > startSentinel &&
-                       is_valid_name_char_ex(*functionOrVarNamePos))
+                       is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                     {
                     std::advance(functionOrVarNamePos, -1);
                     }
                 // If we are on the start of the text, then see if we need to include that
                 // character too. We may have short-circuited because we reached the start
                 // of the stream.
-                if (!is_valid_name_char_ex(*functionOrVarNamePos))
+                if (!is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                     {
                     std::advance(functionOrVarNamePos, 1);
                     }
@@ -3049,17 +3905,22 @@ namespace i18n_check
                     break;
                     }
                 }
-            else if (static_cast<bool>(std::iswspace(*startPos)))
+            else if (i18n_string_util::is_space(currentChar))
                 {
-                std::advance(startPos, -1);
+                // step over the rest of a masked section at once
+                const auto maskedStart = static_cast<ptrdiff_t>(
+                    m_file_text.get_masked_start(static_cast<size_t>(startPos - m_file_start)));
+                startPos = (maskedStart > startSentinel - m_file_start) ?
+                               std::next(m_file_start, maskedStart - 1) :
+                               startSentinel;
                 }
             else if (quoteWrappedInCTOR &&
-                     (*startPos == L',' || *startPos == L'+' || *startPos == L'&'))
+                     (currentChar == L',' || currentChar == L'+' || currentChar == L'&'))
                 {
                 quoteWrappedInCTOR = false;
                 }
-            else if (quoteWrappedInCTOR && *startPos != L',' && *startPos != L'+' &&
-                     *startPos != L'&')
+            else if (quoteWrappedInCTOR && currentChar != L',' && currentChar != L'+' &&
+                     currentChar != L'&')
                 {
                 break;
                 }
@@ -3067,22 +3928,23 @@ namespace i18n_check
             // Skip over it and skip over ')' in front of it if there is one
             // to allow things like:
             //     gDebug() << "message"
-            else if (*startPos == L'<')
+            else if (currentChar == L'<')
                 {
                 std::advance(startPos, -1);
-                if (startPos > startSentinel && *startPos == L'<')
+                if (startPos > startSentinel && char_at(startPos) == L'<')
                     {
                     bool isFunctionCall{ false };
                     std::advance(startPos, -1);
-                    while (startPos > startSentinel && static_cast<bool>(std::iswspace(*startPos)))
+                    while (startPos > startSentinel &&
+                           i18n_string_util::is_space(char_at(startPos)))
                         {
                         std::advance(startPos, -1);
                         }
                     // step over arguments to streamable function
-                    if (startPos > startSentinel && *startPos == L')')
+                    if (startPos > startSentinel && char_at(startPos) == L')')
                         {
                         std::advance(startPos, -1);
-                        while (startPos > startSentinel && *startPos != L'(')
+                        while (startPos > startSentinel && char_at(startPos) != L'(')
                             {
                             std::advance(startPos, -1);
                             }
@@ -3094,12 +3956,12 @@ namespace i18n_check
                         }
                     functionOrVarNamePos = startPos;
                     while (functionOrVarNamePos > startSentinel &&
-                           is_valid_name_char_ex(*functionOrVarNamePos))
+                           is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                         {
                         std::advance(functionOrVarNamePos, -1);
                         }
                     // move back to valid starting character and return
-                    if (!is_valid_name_char_ex(*functionOrVarNamePos))
+                    if (!is_valid_name_char_ex(char_at(functionOrVarNamePos)))
                         {
                         std::advance(functionOrVarNamePos, 1);
                         }
@@ -3110,8 +3972,9 @@ namespace i18n_check
                         // ignore localization related functions; in this case, it is the
                         // (temporary) string objects << operator being called,
                         // not the localization function
-                        if (m_localization_functions.contains(functionName) ||
-                            m_non_localizable_functions.contains(functionName))
+                        if (const auto& resolved = resolve_function(functionName);
+                            resolved.has_name_role(function_role::i18n) ||
+                            resolved.has_name_role(function_role::non_i18n))
                             {
                             functionName.clear();
                             }
@@ -3122,16 +3985,16 @@ namespace i18n_check
                                                    std::next(startPos) - functionOrVarNamePos);
                         }
 
-                    return functionOrVarNamePos;
+                    return cacheCallContext(functionOrVarNamePos);
                     }
                 }
             else
                 {
-                if (*startPos == L',')
+                if (currentChar == L',')
                     {
                     ++parameterPosition;
                     }
-                else if (*startPos == L'+' || *startPos == L'?' || *startPos == L':')
+                else if (currentChar == L'+' || currentChar == L'?' || currentChar == L':')
                     {
                     const wchar_t* operatorEnd{ std::next(startPos) };
                     readOperator(startPos, operatorEnd);
@@ -3140,7 +4003,7 @@ namespace i18n_check
                 }
             }
 
-        return functionOrVarNamePos;
+        return cacheCallContext(functionOrVarNamePos);
         }
 
     //------------------------------------------------
@@ -3592,6 +4455,135 @@ namespace i18n_check
         return { true, msgId, idPos, idEndPos };
         }
 
+    //--------------------------------------------------
+    void i18n_review::set_file_start(std::wstring_view fileText)
+        {
+        m_file_start = fileText.empty() ? nullptr : fileText.data();
+        m_file_text = masked_text_view{ fileText };
+        m_file_line_starts.clear();
+        if (fileText.empty())
+            {
+            return;
+            }
+        // a line ends with CRLF, LF, or CR
+        m_file_line_starts.push_back(0);
+        for (size_t i = 0; i < fileText.length(); ++i)
+            {
+            if (fileText[i] == L'\n' ||
+                (fileText[i] == L'\r' &&
+                 (i + 1 == fileText.length() || fileText[i + 1] != L'\n')))
+                {
+                m_file_line_starts.push_back(i + 1);
+                }
+            }
+        }
+
+    //--------------------------------------------------
+    void i18n_review::masked_text_view::mask(size_t start, size_t end)
+        {
+        end = std::min(end, m_text.length());
+        if (start >= end)
+            {
+            return;
+            }
+        // sections are usually masked in order, so this will normally just be appended
+        auto first = std::lower_bound(m_masked_sections.begin(), m_masked_sections.end(), start,
+                                      [](const auto& section, const size_t position)
+                                      { return section.second < position; });
+        // merge with any sections that it overlaps or touches
+        auto last = first;
+        while (last != m_masked_sections.end() && last->first <= end)
+            {
+            start = std::min(start, last->first);
+            end = std::max(end, last->second);
+            ++last;
+            }
+        if (first == last)
+            {
+            m_masked_sections.insert(first, std::make_pair(start, end));
+            }
+        else
+            {
+            *first = std::make_pair(start, end);
+            m_masked_sections.erase(std::next(first), last);
+            }
+        }
+
+    //--------------------------------------------------
+    std::vector<std::pair<size_t, size_t>>::const_iterator
+    i18n_review::masked_text_view::find_section(const size_t position) const noexcept
+        {
+        return std::upper_bound(m_masked_sections.cbegin(), m_masked_sections.cend(), position,
+                                [](const size_t pos, const auto& section)
+                                { return pos < section.second; });
+        }
+
+    //--------------------------------------------------
+    bool i18n_review::masked_text_view::is_masked(const size_t start,
+                                                   const size_t end) const noexcept
+        {
+        const auto section = find_section(start);
+        return section != m_masked_sections.cend() && section->first < end;
+        }
+
+    //--------------------------------------------------
+    size_t i18n_review::masked_text_view::get_masked_end(const size_t position) const noexcept
+        {
+        const auto section = find_section(position);
+        return (section != m_masked_sections.cend() && section->first <= position) ?
+                   section->second :
+                   position;
+        }
+
+    //--------------------------------------------------
+    size_t i18n_review::masked_text_view::get_masked_start(const size_t position) const noexcept
+        {
+        const auto section = find_section(position);
+        return (section != m_masked_sections.cend() && section->first <= position) ?
+                   section->first :
+                   position;
+        }
+
+    //--------------------------------------------------
+    size_t i18n_review::masked_text_view::find(const std::wstring_view str,
+                                               size_t position /*= 0*/) const noexcept
+        {
+        position = m_text.find(str, position);
+        while (position != std::wstring_view::npos &&
+               is_masked(position, position + str.length()))
+            {
+            // step over the masked section that the match overlaps
+            position = m_text.find(
+                str, std::max(position + 1, get_masked_end(position + str.length() - 1)));
+            }
+        return position;
+        }
+
+    //--------------------------------------------------
+    std::wstring i18n_review::masked_text_view::substr(const size_t start, size_t length) const
+        {
+        if (start >= m_text.length())
+            {
+            return std::wstring{};
+            }
+        length = std::min(length, m_text.length() - start);
+        std::wstring section{ m_text.substr(start, length) };
+        // blank out the masked sections that overlap this one
+        for (auto masked = find_section(start);
+             masked != m_masked_sections.cend() && masked->first < start + length; ++masked)
+            {
+            for (size_t i = std::max(masked->first, start) - start;
+                 i < std::min(masked->second, start + length) - start; ++i)
+                {
+                if (section[i] != L'\r' && section[i] != L'\n')
+                    {
+                    section[i] = L' ';
+                    }
+                }
+            }
+        return section;
+        }
+
     //--------------------------------------------------
     std::pair<size_t, size_t>
     i18n_review::get_line_and_column(size_t position,
@@ -3602,6 +4594,16 @@ namespace i18n_check
             return std::make_pair(std::wstring::npos, std::wstring::npos);
             }
 
+        if (fileStart.empty() && m_file_start != nullptr && !m_file_line_starts.empty())
+            {
+            // the first line always starts at zero, so this will never be the first element
+            const auto nextLineStart = std::upper_bound(m_file_line_starts.cbegin(),
+                                                        m_file_line_starts.cend(), position);
+            return std::make_pair(
+                static_cast<size_t>(std::distance(m_file_line_starts.cbegin(), nextLineStart)),
+                position - *std::prev(nextLineStart) + 1);
+            }
+
         const auto* startSentinel = (!fileStart.empty() ? fileStart.data() : m_file_start);
         if (startSentinel == nullptr)
             {
@@ -21,12 +21,15 @@
 #include "char_traits.h"
 #include "donttranslate.h"
 #include "i18n_string_util.h"
+#include "plural_forms.h"
 #include "string_util.h"
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #ifndef CPPCHECK_SKIP_SECTION
@@ -256,6 +259,8 @@ namespace i18n_check
         rc,
         /// @brief GNU gettext catalog files.
         po,
+        /// @brief Compiled GNU gettext catalog files.
+        mo,
         /// @brief C# source files.
         cs,
         /// @brief macOS info.plist manifest files.
@@ -302,6 +307,13 @@ namespace i18n_check
         /// @brief The comment for the translator to provide context for
         ///     how to translate the string.
         std::wstring m_comment;
+        /// @brief The translations of every plural form (i.e., @c msgstr[0], @c msgstr[1],
+        ///     @c msgstr[2], etc.) if there is a plural source string.\n
+        ///     Only used for gettext PO files.
+        std::vector<std::wstring> m_translation_plural_forms;
+        /// @brief The compiled @c Plural-Forms header from the entry's catalog (if it has one).\n
+        ///     Only used for gettext PO files.
+        std::shared_ptr<const plural_forms> m_plural_forms;
         };
 
     /// @brief Progress callback for analyze().
@@ -425,8 +437,10 @@ namespace i18n_check
         struct wx_project_info
             {
             string_info m_app_init_info;
-            bool m_wxuilocale_initialized{ false };
-            bool m_wxlocale_initialized{ false };
+            /// @brief The files that call @c wxUILocale::UseDefault().
+            std::set<std::filesystem::path> m_wxuilocale_initialized_files;
+            /// @brief The files that use @c wxLocale.
+            std::set<std::filesystem::path> m_wxlocale_initialized_files;
             };
 
         /// @brief Messages logged during a review.
@@ -468,14 +482,18 @@ namespace i18n_check
         /** @brief Adds a function to be considered as internal (e.g., debug functions).
             @details Strings passed to this function will not be considered translatable.
             @param func The function to ignore.*/
-        void add_function_to_ignore(const std::wstring& func) { m_internal_functions.insert(func); }
+        void add_function_to_ignore(const std::wstring& func)
+            {
+            add_function_role(*m_internal_functions.insert(func).first, function_role::internal);
+            }
 
         /** @brief Adds a function that loads hard-coded strings as translatable resources.
             @details This is usually functions like those found in the gettext library.
             @param func The function to consider as a resource-loading function.*/
         void add_translation_extraction_function(const std::wstring& func)
             {
-            m_localization_functions.insert(func);
+            add_function_role(*m_localization_functions.insert(func).first,
+                              function_role::i18n);
             }
 
         /** @brief Sets which checks are being performed.
@@ -733,16 +751,40 @@ namespace i18n_check
         static void add_variable_name_pattern_to_ignore(const std::wregex& pattern)
             {
             m_variable_name_patterns_to_ignore.push_back(pattern);
-            }
+            // the pattern's text isn't available, so there is nothing to check before matching it
+            m_variable_name_pattern_info.emplace_back();
+            ++m_variable_name_patterns_version;
+            }
+
+        /** @brief Adds a regex pattern to compare against variable names.
+            @details Unlike the @c std::wregex overload, a pattern that was already added
+                isn't added again, and the literal text that the pattern starts or ends with
+                is compared against a variable name before the regex is.
+            @param pattern The regex pattern to compare against the variable names.
+            @param flags The regex's flags.
+            @throws std::regex_error If the pattern isn't a valid regex.
+            @sa add_variable_name_pattern_to_ignore(const std::wregex&).*/
+        static void add_variable_name_pattern_to_ignore(
+            std::wstring_view pattern,
+            const std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript);
 
         /// @returns The regex patterns compared against variables that have
         ///     strings assigned to them. @sa add_variable_name_patterns_to_ignore().
         [[nodiscard]]
-        static std::vector<std::wregex>& get_ignored_variable_patterns() noexcept
+        static const std::vector<std::wregex>& get_ignored_variable_patterns() noexcept
             {
             return m_variable_name_patterns_to_ignore;
             }
 
+        /// @brief Removes the regex patterns compared against variable names
+        ///     (including the built-in ones, until another analyzer is constructed).
+        static void clear_ignored_variable_patterns() noexcept
+            {
+            m_variable_name_patterns_to_ignore.clear();
+            m_variable_name_pattern_info.clear();
+            ++m_variable_name_patterns_version;
+            }
+
         /** @brief Adds a variable type to ignore.
             @details Any variables that are constructed in place with these types
                 will have their string values marked as internal.
@@ -773,6 +815,15 @@ namespace i18n_check
                 to the parser; it will only reset the results from the last parsing operation.*/
         virtual void clear_results();
 
+        /** @brief Removes the results (and loaded strings) from a file, so that it can be
+                reloaded after it changes or dropped after it is deleted.
+            @details Results that depend on other files (e.g., ID values assigned in
+                multiple files) are updated to account for the file being removed.\n
+                Files loaded after this (via `operator()`) are then reviewed by the next call
+                to review_strings(), without reviewing the strings from the other files again.
+            @param file The file to remove the results for.*/
+        virtual void clear_file_results(const std::filesystem::path& file);
+
         /// @returns A list of errors (usually the regex engine having issues parsing something)
         ///     encountered while parsing the file.
         [[nodiscard]]
@@ -781,6 +832,33 @@ namespace i18n_check
             return m_error_log;
             }
 
+        /// @returns The number of times a string check's verdict was looked up
+        ///     since the last call to clear_results().
+        [[nodiscard]]
+        size_t get_string_classification_lookups() const noexcept
+            {
+            return m_string_classification_lookups;
+            }
+
+        /// @returns The number of string check lookups that were answered by an earlier
+        ///     verdict for the same string (rather than running the check again).
+        [[nodiscard]]
+        size_t get_string_classification_cache_hits() const noexcept
+            {
+            return m_string_classification_cache_hits;
+            }
+
+        /// @returns The number of characters that strings' backward scans (to find the
+        ///     function or variable that a string is connected to) have stepped over
+        ///     since the last call to clear_results().
+        /// @note Scans that join an earlier scan stop there, so this should grow
+        ///     linearly with the length of a function call or initializer list.
+        [[nodiscard]]
+        size_t get_backward_scan_steps() const noexcept
+            {
+            return m_backward_scan_steps;
+            }
+
         /// @returns Whether to consider punctuation-only strings as being safe to translate.
         [[nodiscard]]
         bool is_allowing_translating_punctuation_only_strings() const noexcept
@@ -811,6 +889,24 @@ namespace i18n_check
             m_exceptions_should_be_translatable = allow;
             }
 
+        /// @returns Whether duplicate ID values are looked for across all files in the batch
+        ///     (rather than within each file).
+        [[nodiscard]]
+        bool is_reviewing_duplicate_ids_across_files() const noexcept
+            {
+            return m_review_duplicate_ids_across_files;
+            }
+
+        /// @brief Set whether to look for duplicate ID values across all files in the batch.
+        /// @details The default is @c false, where an ID value is only reported if it is
+        ///     assigned to multiple ID variables within the same file.\n
+        ///     The IDs are tracked until clear_results() is called.
+        /// @param enable @c true to look for duplicate ID values across files.
+        void review_duplicate_ids_across_files(const bool enable) noexcept
+            {
+            m_review_duplicate_ids_across_files = enable;
+            }
+
         /// @returns Whether strings sent to logging functions can be translatable.
         [[nodiscard]]
         bool can_log_messages_be_translatable() const noexcept
@@ -828,6 +924,8 @@ namespace i18n_check
         void log_messages_can_be_translatable(const bool allow) noexcept
             {
             m_log_messages_are_translatable = allow;
+            // which functions are diagnostic depends on this
+            m_resolved_function_roles.clear();
             }
 
         /// @returns The minimum number of words that a string must have to be
@@ -873,14 +971,14 @@ namespace i18n_check
 
         /** @brief Adds a font face to be ignored if found as a string.
             @param str The font face name.*/
-        static void add_font_name_to_ignore(const string_util::case_insensitive_wstring& str)
+        static void add_font_name_to_ignore(const std::wstring_view str)
             {
             m_font_names.insert(str);
             }
 
         /** @brief Adds a file extension to be ignored if found as a string.
             @param str The font face name.*/
-        static void add_file_extension_to_ignore(const string_util::case_insensitive_wstring& str)
+        static void add_file_extension_to_ignore(const std::wstring_view str)
             {
             m_file_extensions.insert(str);
             }
@@ -888,7 +986,7 @@ namespace i18n_check
         /// @returns @c true if string is a known font face name.
         /// @param str The string to review.
         [[nodiscard]]
-        static bool is_font_name(const string_util::case_insensitive_wstring& str)
+        static bool is_font_name(const std::wstring_view str)
             {
             return m_font_names.contains(str);
             }
@@ -896,7 +994,7 @@ namespace i18n_check
         /// @returns @c true if string is a known file extension.
         /// @param str The string to review.
         [[nodiscard]]
-        static bool is_file_extension(const string_util::case_insensitive_wstring& str)
+        static bool is_file_extension(const std::wstring_view str)
             {
             return m_file_extensions.contains(str);
             }
@@ -1027,6 +1125,115 @@ namespace i18n_check
             size_t m_previousBlockEnd{ 0 };
             };
 
+        /** @brief A read-only view of a file's text, where sections of it (e.g., comments
+                and strings that have already been reviewed) can be masked out.
+            @details Masked characters are read as spaces (other than newlines, so that
+                line positions stay the same), without copying or changing the text.
+                The masked sections are kept as a sorted set of intervals.*/
+        class masked_text_view
+            {
+          public:
+            masked_text_view() = default;
+
+            /// @brief Constructor.
+            /// @param text The text to view.
+            explicit masked_text_view(const std::wstring_view text) noexcept : m_text(text) {}
+
+            /// @brief Masks a section of the text.
+            /// @param start The start of the section.
+            /// @param end The end of the section (one past its last character).
+            void mask(size_t start, size_t end);
+
+            /// @returns The character at @c position, or a space if it is masked.\n
+            ///     Past the end of the text, this returns a null terminator.
+            /// @param position The position in the text.
+            [[nodiscard]]
+            wchar_t operator[](const size_t position) const noexcept
+                {
+                if (position >= m_text.length())
+                    {
+                    return 0;
+                    }
+                const wchar_t chr{ m_text[position] };
+                return (chr == L'\r' || chr == L'\n' || !is_masked(position)) ? chr : L' ';
+                }
+
+            /// @returns @c true if the character at @c position is masked.
+            /// @param position The position in the text.
+            [[nodiscard]]
+            bool is_masked(const size_t position) const noexcept
+                {
+                return get_masked_end(position) != position;
+                }
+
+            /// @returns @c true if any of the characters in [start, end) are masked.
+            /// @param start The start of the section.
+            /// @param end The end of the section.
+            [[nodiscard]]
+            bool is_masked(size_t start, size_t end) const noexcept;
+
+            /// @returns The end of the masked section that @c position is in,
+            ///     or @c position if it isn't masked.
+            /// @param position The position in the text.
+            [[nodiscard]]
+            size_t get_masked_end(size_t position) const noexcept;
+
+            /// @returns The start of the masked section that @c position is in,
+            ///     or @c position if it isn't masked.
+            /// @param position The position in the text.
+            [[nodiscard]]
+            size_t get_masked_start(size_t position) const noexcept;
+
+            /// @returns @c true if @c str is at @c position (and none of it is masked).
+            /// @param position The position in the text.
+            /// @param str The string to look for.
+            [[nodiscard]]
+            bool starts_with(const size_t position, const std::wstring_view str) const noexcept
+                {
+                return position <= m_text.length() &&
+                       m_text.substr(position).starts_with(str) &&
+                       !is_masked(position, position + str.length());
+                }
+
+            /// @returns The position of the first @c str from @c position that isn't
+            ///     (even partially) masked, or @c npos if not found.
+            /// @param str The string to look for.
+            /// @param position The position to start searching from.
+            [[nodiscard]]
+            size_t find(std::wstring_view str, size_t position = 0) const noexcept;
+
+            /// @returns A section of the text, with its masked characters read as spaces.
+            /// @param start The start of the section.
+            /// @param length The length of the section.
+            [[nodiscard]]
+            std::wstring substr(size_t start, size_t length) const;
+
+            /// @returns The length of the text.
+            [[nodiscard]]
+            size_t length() const noexcept
+                {
+                return m_text.length();
+                }
+
+            /// @returns The text as written (i.e., including its masked sections).
+            [[nodiscard]]
+            std::wstring_view get_text() const noexcept
+                {
+                return m_text;
+                }
+
+          private:
+            /// @returns The first masked section that ends after @c position.
+            /// @param position The position in the text.
+            [[nodiscard]]
+            std::vector<std::pair<size_t, size_t>>::const_iterator
+            find_section(size_t position) const noexcept;
+
+            std::wstring_view m_text;
+            /// @brief The masked [start, end) sections, in order and not overlapping.
+            std::vector<std::pair<size_t, size_t>> m_masked_sections;
+            };
+
         /// @returns @c true if a string is a localizable operator being concatenated.
         /// @param str The string to review.
         [[nodiscard]]
@@ -1123,8 +1330,8 @@ namespace i18n_check
 
         /** @brief Processes a quote after its positions and respective
                 function/variable assignment has been found.
-            @param[in,out] currentTextPos The current position into the text buffer.\n
-                This position (up to @c quoteEnd) will be filled with spaces after
+            @param currentTextPos The current position into the text buffer.\n
+                This position (up to @c quoteEnd) will be masked after
                 this section is processed.
             @param quoteEnd The end of the quote.
             @param functionVarNamePos The position in the buffer of the quote's
@@ -1135,7 +1342,7 @@ namespace i18n_check
                 macro, then name of this macro.
             @param parameterPosition The string's position in the function call (if applicable).
             @param isFollowedByComma Whether the quote is followed by a comma.*/
-        void process_quote(wchar_t* currentTextPos, const wchar_t* quoteEnd,
+        void process_quote(const wchar_t* currentTextPos, const wchar_t* quoteEnd,
                            const wchar_t* functionVarNamePos, const std::wstring& functionName,
                            const variable_info& variableInfo,
                            const std::wstring& deprecatedMacroEncountered,
@@ -1153,8 +1360,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_i18n_function(std::wstring_view functionName) const
             {
-            return m_localization_functions.contains(functionName) ||
-                   m_localization_functions.contains(extract_base_function(functionName));
+            return resolve_function(functionName).has_role(function_role::i18n);
             }
 
         /// @returns @c true if a function name is a translation extraction function that takes an
@@ -1163,9 +1369,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_i18n_with_context_function(std::wstring_view functionName) const
             {
-            return m_localization_with_context_functions.contains(functionName) ||
-                   m_localization_with_context_functions.contains(
-                       extract_base_function(functionName));
+            return resolve_function(functionName).has_role(function_role::i18n_with_context);
             }
 
         /// @returns @c true if a function name is a translation noop function.
@@ -1173,8 +1377,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_non_i18n_function(std::wstring_view functionName) const
             {
-            return m_non_localizable_functions.contains(functionName) ||
-                   m_non_localizable_functions.contains(extract_base_function(functionName));
+            return resolve_function(functionName).has_role(function_role::non_i18n);
             }
 
         /// @returns @c true if a string is a keyword.
@@ -1184,7 +1387,7 @@ namespace i18n_check
         [[nodiscard]]
         bool is_keyword(std::wstring_view str) const
             {
-            return m_keywords.contains(str);
+            return resolve_function(str).has_name_role(function_role::keyword);
             }
 
         /** @brief Logs a debug message.
@@ -1198,22 +1401,113 @@ namespace i18n_check
                                      message);
             }
 
+        /// @brief An ID variable assignment (e.g., <tt>#define IDC_OK 100</tt>).
+        struct id_assignment
+            {
+            /// @brief Where the assignment (starting with its type or @c \#define) is.
+            size_t m_position{ 0 };
+            /// @brief The length of the assignment.
+            size_t m_length{ 0 };
+            /// @brief The ID variable's name.
+            std::wstring_view m_name;
+            /// @brief The value assigned to the ID, as written
+            ///     (with any masked sections in it read as spaces).
+            std::wstring m_value;
+            /// @brief The character after the value (if there is one on the same line).
+            std::wstring_view m_following;
+            };
+
+        /// @brief An ID variable that a value was assigned to.
+        struct assigned_id
+            {
+            /// @brief The ID variable's name.
+            std::wstring m_variable;
+            /// @brief The file that the assignment is in.
+            std::filesystem::path m_file_name;
+            /// @brief The line and column of the assignment.
+            std::pair<size_t, size_t> m_position;
+            };
+
+        /** @brief Lexes the ID assignments (e.g., <tt>UINT MENU_ID_PRINT = 1'000;</tt>)
+                from a file's text in one pass.
+            @param fileText The text to review (its masked sections are skipped).
+            @returns The ID assignments, in the order that they appear.*/
+        [[nodiscard]]
+        static std::vector<id_assignment> find_id_assignments(const masked_text_view& fileText);
+
         /** @brief Loads ID assignments in the text to see if there are
                 hard-coded numbers or duplicated assignments.
             @param fileText The source file's text to analyze.
             @param fileName The file name being analyzed.*/
-        void load_id_assignments(const std::wstring_view fileText,
+        void load_id_assignments(const masked_text_view& fileText,
                                  const std::filesystem::path& fileName);
+        /** @brief Adds an ID value's assignment to the batch's ID table, reporting it
+                if the value was already assigned to a different ID variable.
+            @details The assignments for a value are kept in file order, so that a file
+                reloaded after it changed is reported the same as it would be in a full batch.
+            @param idValue The value assigned to the ID.
+            @param assignment The ID variable and where it was assigned.*/
+        void add_assigned_id(const std::wstring& idValue, assigned_id assignment);
+        /** @brief Reports the assignments of an ID value (from the batch's ID table) to
+                ID variables other than the first one that it was assigned to.
+            @details Any previous reports for the value are replaced.
+            @param idValue The value assigned to the IDs.*/
+        void review_assigned_id(const std::wstring& idValue);
+        /// @returns @c true if assigning an ID value to a variable should be reported
+        ///     as a duplicate.
+        /// @param idValue The value assigned to the ID.
+        /// @param variable The ID variable.
+        /// @param firstVariable The first ID variable that the value was assigned to.
+        [[nodiscard]]
+        bool is_duplicate_id_assignment(const std::wstring& idValue, const std::wstring& variable,
+                                        const std::wstring& firstVariable) const;
+        /// @returns The message for an ID value assigned to multiple ID variables.
+        /// @param idValue The value assigned to the IDs.
+        [[nodiscard]]
+        static std::wstring format_duplicate_id_message(const std::wstring& idValue);
         /** @brief Loads any deprecated functions found in the text.
             @param fileText The source file's text to analyze.
             @param fileName The file name being analyzed.*/
-        void load_deprecated_functions(const std::wstring_view fileText,
+        void load_deprecated_functions(const masked_text_view& fileText,
                                        const std::filesystem::path& fileName);
         /** @brief Loads any i18n functions being misused.
+            @details This is a single pass over the identifiers in the text, where each
+                suspect usage rule is triggered by the identifiers that it cares about.
             @param fileText The source file's text to analyze.
             @param fileName The file name being analyzed.*/
-        void load_suspect_i18n_usage(const std::wstring_view fileText,
+        void load_suspect_i18n_usage(const masked_text_view& fileText,
                                      const std::filesystem::path& fileName);
+        /** @brief Loads the line formatting issues (tabs, trailing spaces, and overly
+                long lines) in a file.
+            @details This only needs the line boundaries (not the code's syntax), so this
+                can be performed without parsing the file. Because of that, tabs and
+                long lines inside of comments and strings are included.
+            @param fileText The source file's text to analyze.
+            @param fileName The file name being analyzed.*/
+        void load_line_formatting_issues(const std::wstring_view fileText,
+                                         const std::filesystem::path& fileName);
+        /** @brief A suspect usage rule for load_suspect_i18n_usage(), which reviews
+                the text at one of its triggering identifiers.
+            @details The parameters are the source file's text, the position and
+                length of the identifier, where to add any issues, and the file name.
+                It returns the end of the text that it matched (so that the rule isn't
+                triggered again within it), or @c npos if it didn't match.*/
+        using suspect_usage_reviewer = size_t (i18n_review::*)(
+            const masked_text_view&, const size_t, const size_t, std::vector<string_info>&,
+            const std::filesystem::path&) const;
+        /// @brief Suspect usage rule for ::LoadString() being called.
+        /// @details See suspect_usage_reviewer for the parameters and return value.
+        [[nodiscard]]
+        size_t review_load_string_call(const masked_text_view& fileText, const size_t position,
+                                       const size_t length, std::vector<string_info>& results,
+                                       const std::filesystem::path& fileName) const;
+        /// @brief Suspect usage rule for _() and wxPLURAL() not being passed a string literal.
+        /// @details See suspect_usage_reviewer for the parameters and return value.
+        [[nodiscard]]
+        size_t review_l10n_function_argument(const masked_text_view& fileText,
+                                             const size_t position, const size_t length,
+                                             std::vector<string_info>& results,
+                                             const std::filesystem::path& fileName) const;
 #ifdef __UNITTEST
       public:
 #endif
@@ -1282,17 +1576,33 @@ namespace i18n_check
         void process_variable(const variable_info& variableInfo, const std::wstring_view value,
                               const size_t quotePosition);
 
-        /// @brief Fills a block with blanks.
+        /// @brief Masks a block of the file being parsed, so that it is read as blanks.
         /// @details Useful for excluding an already processed text block.
         /// @param start The starting position.
         /// @param end The ending position.
-        static void clear_section(wchar_t* start, const wchar_t* end) noexcept
+        void mask_section(const wchar_t* start, const wchar_t* end)
             {
-            for (ptrdiff_t i = 0; i < end - start; ++i)
-                {
-                // preserve newlines so that line position calculations work later
-                start[i] = (start[i] == L'\r' || start[i] == L'\n') ? start[i] : L' ';
-                }
+            m_file_text.mask(static_cast<size_t>(start - m_file_start),
+                             static_cast<size_t>(end - m_file_start));
+            }
+
+        /// @returns The character at @c position in the file being parsed
+        ///     (as a space if it is masked).
+        /// @param position The position in the file.
+        [[nodiscard]]
+        wchar_t char_at(const wchar_t* position) const noexcept
+            {
+            return m_file_text[static_cast<size_t>(position - m_file_start)];
+            }
+
+        /// @returns A block of the file being parsed, with its masked sections as blanks.
+        /// @param start The starting position.
+        /// @param end The ending position.
+        [[nodiscard]]
+        std::wstring get_section(const wchar_t* start, const wchar_t* end) const
+            {
+            return m_file_text.substr(static_cast<size_t>(start - m_file_start),
+                                      static_cast<size_t>(end - start));
             }
 
         /// @brief Fills a block with blanks.
@@ -1311,6 +1621,8 @@ namespace i18n_check
 
         /** @brief Backtracks from a quote to see which function or variable it is
                 connected to.
+            @details If this reaches a point that the previous scan went through in
+                the same state, then that scan's results are reused (see m_scan_trail).
             @param startPos The start of the quote.
             @param startSentinel The furthest point to look backwards.
             @param[out] functionName If the string is in a function call,
@@ -1359,7 +1671,143 @@ namespace i18n_check
         /// @brief Reviews output integrity to see if there were any parsing errors.
         void run_diagnostics() const;
 
+        /** @brief Sets the start of the file buffer being parsed, which get_line_and_column()
+                uses by default.
+            @details This also records where each line starts, so that looking up a position's
+                line doesn't need to count the lines from the top of the file each time,
+                and clears the masked sections (see m_file_text).
+            @param fileText The file buffer, or an empty view when done parsing it.*/
+        void set_file_start(std::wstring_view fileText);
+
         const wchar_t* m_file_start{ nullptr };
+        /// @brief The file buffer at m_file_start, along with the sections of it that
+        ///     have been processed (and are masked out).
+        masked_text_view m_file_text;
+        /// @brief The positions (in the buffer at m_file_start) where each line starts.
+        std::vector<size_t> m_file_line_starts;
+
+        /// @brief The state of a backward scan in read_var_or_function_name() at a point
+        ///     that it passed (where it started, or an opening parenthesis or brace or a comma).
+        /// @details Other than the parameter position (which is only counted), where a scan
+        ///     ends up only depends on where it is and this state, as long as it hasn't
+        ///     found anything yet. So another scan that reaches the same point in the same
+        ///     state will end up with the same results.
+        struct scan_point
+            {
+            /// @returns @c true if a scan at @c point would end up the same as
+            ///     the scan that passed this one.
+            /// @param point The other scan's state.
+            [[nodiscard]]
+            bool is_joined_by(const scan_point& point) const noexcept
+                {
+                return m_position == point.m_position &&
+                       m_closeParenCount == point.m_closeParenCount &&
+                       m_closeBraceCount == point.m_closeBraceCount &&
+                       m_quoteWrappedInCTOR == point.m_quoteWrappedInCTOR &&
+                       (!m_functionOrVarNamePosMatters ||
+                        m_functionOrVarNamePos == point.m_functionOrVarNamePos);
+                }
+
+            const wchar_t* m_position{ nullptr };
+            int32_t m_closeParenCount{ 0 };
+            int32_t m_closeBraceCount{ 0 };
+            bool m_quoteWrappedInCTOR{ false };
+            /// @brief Where the function or variable name was last read
+            ///     (@c nullptr if still where the scan started).
+            const wchar_t* m_functionOrVarNamePos{ nullptr };
+            /// @brief Whether the scan returned m_functionOrVarNamePos
+            ///     (rather than reading another name after this).
+            bool m_functionOrVarNamePosMatters{ true };
+            /// @brief The parameter position counted so far, and once the scan is done,
+            ///     how many more commas it counted after this.
+            size_t m_parameterPosition{ 0 };
+            };
+
+        /// @brief The points passed by the last backward scan in read_var_or_function_name()
+        ///     (and the scans that it joined), along with what they found.
+        /// @details The next string's scan looks for these as it goes, so a string in the same
+        ///     function call or initializer list only needs to scan back to where
+        ///     the previous one's scan went, rather than to the start of the call again.
+        struct scan_trail
+            {
+            const wchar_t* m_startSentinel{ nullptr };
+            /// @brief The points, from the furthest back to where the last scan started.
+            std::vector<scan_point> m_points;
+            /// @brief The position of the function or variable that was found
+            ///     (@c nullptr if nothing was, where the scan returns where it started).
+            const wchar_t* m_functionOrVarNamePos{ nullptr };
+            std::wstring m_functionName;
+            variable_info m_variableInfo;
+            std::wstring m_deprecatedMacroEncountered;
+            };
+
+        std::optional<scan_trail> m_scan_trail;
+        size_t m_backward_scan_steps{ 0 };
+
+        /// @brief The roles that a function (or keyword) name can have,
+        ///     based on which of the function lists it is in.
+        enum class function_role : uint8_t
+            {
+            i18n = 1 << 0,
+            i18n_with_context = 1 << 1,
+            non_i18n = 1 << 2,
+            internal = 1 << 3,
+            log = 1 << 4,
+            keyword = 1 << 5
+            };
+
+        /// @brief The roles of a function name that has been looked up.
+        struct resolved_function_roles
+            {
+            /// @brief The roles of the name itself.
+            uint8_t m_nameRoles{ 0 };
+            /// @brief The roles of the name, or of its base name
+            ///     (with any class or namespace information stripped off).
+            uint8_t m_nameOrBaseNameRoles{ 0 };
+            /// @brief Whether the function is a diagnostic function, once it's been reviewed.
+            std::optional<bool> m_isDiagnostic;
+
+            /// @returns @c true if the name, or its base name, has @c role.
+            /// @param role The role to look for.
+            [[nodiscard]]
+            bool has_role(const function_role role) const noexcept
+                {
+                return (m_nameOrBaseNameRoles & static_cast<uint8_t>(role)) != 0;
+                }
+
+            /// @returns @c true if the name itself has @c role.
+            /// @param role The role to look for.
+            [[nodiscard]]
+            bool has_name_role(const function_role role) const noexcept
+                {
+                return (m_nameRoles & static_cast<uint8_t>(role)) != 0;
+                }
+            };
+
+        /// @brief Hash for looking up string keys with a string view.
+        struct wstring_view_hash
+            {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            size_t operator()(std::wstring_view str) const noexcept
+                {
+                return std::hash<std::wstring_view>{}(str);
+                }
+            };
+
+        /// @brief The function names resolved while reviewing the current file.
+        mutable std::unordered_map<std::wstring, resolved_function_roles, wstring_view_hash,
+                                   std::equal_to<>>
+            m_resolved_function_roles;
+
+        /// @brief Whether each variable name reviewed in the batch matched
+        ///     an ignored variable pattern.
+        mutable std::unordered_map<std::wstring, bool, wstring_view_hash, std::equal_to<>>
+            m_ignored_variable_names;
+        /// @brief The version of the ignored variable patterns that
+        ///     @c m_ignored_variable_names was built from.
+        mutable size_t m_ignored_variable_names_version{ 0 };
 
         bool m_collapse_double_quotes{ false };
         bool m_allow_translating_punctuation_only_strings{ false };
@@ -1380,6 +1828,26 @@ namespace i18n_check
 
         bool m_verbose{ false };
 
+        bool m_review_duplicate_ids_across_files{ false };
+
+        // ID values and the variables they were assigned to (in file order), for the whole batch
+        std::unordered_map<std::wstring, std::vector<assigned_id>> m_assigned_ids;
+
+        /// @brief The number of loaded strings that were already reviewed by review_strings().
+        /// @details Strings loaded after a review are appended to these containers,
+        ///     so only the ones after these counts still need to be reviewed.
+        struct reviewed_string_counts
+            {
+            size_t m_localizable{ 0 };
+            size_t m_localizable_in_internal_call{ 0 };
+            size_t m_not_available_for_localization{ 0 };
+            size_t m_marked_as_non_localizable{ 0 };
+            size_t m_internal{ 0 };
+            size_t m_unsafe_localizable{ 0 };
+            };
+
+        reviewed_string_counts m_reviewed_string_counts;
+
         // once these are set (by our CTOR and/or by client), they shouldn't be reset
         std::set<std::wstring_view> m_localization_functions;
         std::set<std::wstring_view> m_localization_with_context_functions;
@@ -1388,16 +1856,30 @@ namespace i18n_check
         std::set<std::wstring_view> m_log_functions;
         std::set<std::wstring_view> m_exceptions;
         std::set<std::wstring_view> m_ctors_to_ignore;
-        std::set<string_util::case_insensitive_wstring> m_known_internal_strings;
+        string_util::case_folded_wstring_set m_known_internal_strings;
         std::set<std::wstring_view> m_keywords;
         std::map<std::wstring_view, std::wstring> m_deprecated_string_macros;
         std::map<std::wstring_view, std::wstring> m_deprecated_string_functions;
         // These have built-in values, but can be added to by the client also.
         // These are static so that client's additions can propagate to other instances.
         static std::vector<std::wregex> m_variable_name_patterns_to_ignore;
+        /// @brief A pattern's text, and the literal text that a variable name must start
+        ///     and end with to match it (which is cheaper to check than the regex).
+        struct variable_name_pattern_info
+            {
+            std::wstring m_pattern;
+            std::regex_constants::syntax_option_type m_flags{};
+            std::wstring m_prefix;
+            std::wstring m_suffix;
+            bool m_ignoreCase{ false };
+            };
+        // parallel to m_variable_name_patterns_to_ignore
+        static std::vector<variable_name_pattern_info> m_variable_name_pattern_info;
+        // incremented whenever the ignored variable patterns might have changed
+        static size_t m_variable_name_patterns_version;
         static std::set<std::wstring> m_variable_types_to_ignore;
-        static std::set<string_util::case_insensitive_wstring> m_font_names;
-        static std::set<string_util::case_insensitive_wstring> m_file_extensions;
+        static string_util::case_folded_wstring_set m_font_names;
+        static string_util::case_folded_wstring_set m_file_extensions;
         static std::set<std::wstring> m_untranslatable_exceptions;
         // results after parsing what the client should maybe review
         std::vector<string_info> m_localizable_strings;
@@ -1455,7 +1937,6 @@ namespace i18n_check
         static const std::wregex m_plural_regex;
         static const std::wregex m_open_function_signature_regex;
         static const std::wregex m_diagnostic_function_regex;
-        static const std::wregex m_id_assignment_regex;
         static const std::wregex m_sql_code;
         static const std::wregex m_malformed_html_tag;
         static const std::wregex m_malformed_html_tag_bad_amp;
@@ -1493,9 +1974,113 @@ namespace i18n_check
         convert_positional_cpp_printf(const std::vector<std::wstring>& printfCommands,
                                       std::wstring& errorInfo);
 
+        /// @brief Adds a role to a function name.
+        /// @param functionName The function name, which must be stored in one
+        ///     of the function lists.
+        /// @param role The role to add.
+        void add_function_role(std::wstring_view functionName, const function_role role)
+            {
+            m_function_roles[functionName] |= static_cast<uint8_t>(role);
+            m_resolved_function_roles.clear();
+            }
+
+        /// @brief Fills the function role table from the function lists.
+        void load_function_roles();
+
+        /** @returns @c true if a variable name matches any of the ignored variable patterns.
+            @details The results are cached by name (for the batch, or until the
+                patterns are changed), so the patterns are only compared against each
+                variable name once.
+            @param variableName The variable name to review.
+            @throws std::regex_error If the patterns are too complex to match against.*/
+        [[nodiscard]]
+        bool is_ignored_variable_name(const std::wstring& variableName) const;
+
+        /** @brief Looks up the roles of a function name and its base name.
+            @details The results are cached (until the next file is reviewed), so each
+                function name encountered in a file is only classified once.
+            @param functionName The function name to look up.
+            @returns The name's roles.*/
+        [[nodiscard]]
+        resolved_function_roles& resolve_function(std::wstring_view functionName) const;
+
+        /// @brief String checks whose verdicts are memoized for the batch.
+        enum class string_check : uint16_t
+            {
+            untranslatable = 1 << 0,
+            untranslatable_limited_word_count = 1 << 1,
+            multipart = 1 << 2,
+            faux_plural = 1 << 3,
+            article_or_pronoun = 1 << 4,
+            contains_url = 1 << 5,
+            ambiguous = 1 << 6,
+            malformed = 1 << 7,
+            printf_single_number = 1 << 8
+            };
+
+        /// @brief The memoized verdicts for a string.
+        struct string_classification
+            {
+            /// @brief The checks that have been run on the string.
+            uint16_t m_checked{ 0 };
+            /// @brief The checks that the string was flagged by.
+            uint16_t m_verdicts{ 0 };
+            /// @brief The translatable content lengths from is_untranslatable_string()
+            ///     (without and with the word-count limit).
+            std::pair<size_t, size_t> m_translatableContentLengths{ 0, 0 };
+            };
+
+        /** @brief Runs a check on a string, or returns its verdict from the last time
+                the same string was checked.
+            @details The same strings (e.g., "OK", "Cancel", or a long message) are usually
+                repeated throughout a project, so this avoids rerunning regexes for each
+                occurrence. This should only be used for checks that depend solely on the
+                string's content (and the analyzer's settings).
+            @param str The string to check.
+            @param check The check being run.
+            @param classify The check to run (taking @c str) if there isn't a verdict yet.
+            @returns The check's verdict.*/
+        template<typename Classifier>
+        [[nodiscard]]
+        bool is_string_classified(const std::wstring& str, const string_check check,
+                                  const Classifier& classify)
+            {
+            const auto checkFlag = static_cast<uint16_t>(check);
+            ++m_string_classification_lookups;
+            auto& classification = m_string_classifications[str];
+            if ((classification.m_checked & checkFlag) != 0)
+                {
+                ++m_string_classification_cache_hits;
+                return (classification.m_verdicts & checkFlag) != 0;
+                }
+            const bool verdict = classify(str);
+            classification.m_checked |= checkFlag;
+            if (verdict)
+                {
+                classification.m_verdicts |= checkFlag;
+                }
+            return verdict;
+            }
+
+        /// @brief Memoized version of is_untranslatable_string().
+        /// @param str The string to review.
+        /// @param limitWordCount Whether to limit by word count.
+        /// @returns Whether the string is untranslatable and its translatable length.
+        [[nodiscard]]
+        std::pair<bool, size_t> classify_untranslatable_string(const std::wstring& str,
+                                                               const bool limitWordCount);
+
         // helpers
         mutable std::vector<parse_messages> m_error_log;
 
+        // the roles of the names in the function lists (and keywords)
+        std::unordered_map<std::wstring_view, uint8_t> m_function_roles;
+
+        // verdicts of the string checks for the batch, keyed by the strings' content
+        std::unordered_map<std::wstring, string_classification> m_string_classifications;
+        size_t m_string_classification_lookups{ 0 };
+        size_t m_string_classification_cache_hits{ 0 };
+
         // bookkeeping diagnostics
 #ifndef NDEBUG
         mutable std::pair<std::wstring, std::wregex> m_longest_internal_string;
@@ -14,7 +14,18 @@
 #include "i18n_string_util.h"
 #include "char_traits.h"
 #include "string_util.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <numeric>
 #include <set>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define I18N_STRING_UTIL_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define I18N_STRING_UTIL_NEON
+#endif
 
 namespace i18n_string_util
     {
@@ -67,10 +78,10 @@ namespace i18n_string_util
             const size_t lastDotPos = text.find_last_of(L'.', firstSlash);
             if (lastDotPos != std::wstring_view::npos && lastDotPos > 0 &&
                 (lastDotPos + 4 == firstSlash) &&
-                static_cast<bool>(std::iswalpha(text[lastDotPos - 1])) &&
-                static_cast<bool>(std::iswalpha(text[lastDotPos + 1])) &&
-                static_cast<bool>(std::iswalpha(text[lastDotPos + 2])) &&
-                static_cast<bool>(std::iswalpha(text[lastDotPos + 3])))
+                is_alpha(text[lastDotPos - 1]) &&
+                is_alpha(text[lastDotPos + 1]) &&
+                is_alpha(text[lastDotPos + 2]) &&
+                is_alpha(text[lastDotPos + 3]))
                 {
                 return true;
                 }
@@ -121,7 +132,7 @@ namespace i18n_string_util
             }
         // Windows file path
         if (text.length() >= BASIC_FILE_EXT_MIN_LENGTH &&
-            static_cast<bool>(std::iswalpha(text[0])) && text[1] == L':' &&
+            is_alpha(text[0]) && text[1] == L':' &&
             (text[2] == L'\\' || text[2] == L'/'))
             {
             return true;
@@ -207,9 +218,9 @@ namespace i18n_string_util
         // look at extensions now
         // 3-letter file name
         if (text.length() >= 4 && text[text.length() - 4] == L'.' &&
-            static_cast<bool>(std::iswalpha(text[text.length() - 3])) &&
-            static_cast<bool>(std::iswalpha(text[text.length() - 2])) &&
-            static_cast<bool>(std::iswalpha(text[text.length() - 1])))
+            is_alpha(text[text.length() - 3]) &&
+            is_alpha(text[text.length() - 2]) &&
+            is_alpha(text[text.length() - 1]))
             {
             // Space followed by extension is probably not a file name,
             // but something referring to a file extension instead.
@@ -218,8 +229,7 @@ namespace i18n_string_util
                 return false;
                 }
             // see if it is really a typo (missing space after a sentence).
-            if (static_cast<bool>(std::iswupper(text[text.length() - 3])) &&
-                !static_cast<bool>(std::iswupper(text[text.length() - 2])))
+            if (is_upper(text[text.length() - 3]) && !is_upper(text[text.length() - 2]))
                 {
                 return false;
                 }
@@ -235,9 +245,9 @@ namespace i18n_string_util
         // 4-letter (Microsoft XML-based) file name
         if (text.length() >= FILE_ADDRESS_MIN_LENGTH &&
             text[text.length() - FILE_ADDRESS_MIN_LENGTH] == L'.' &&
-            static_cast<bool>(std::iswalpha(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 1)])) &&
-            static_cast<bool>(std::iswalpha(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 2)])) &&
-            static_cast<bool>(std::iswalpha(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 3)])) &&
+            is_alpha(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 1)]) &&
+            is_alpha(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 2)]) &&
+            is_alpha(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 3)]) &&
             string_util::is_either(text[text.length() - 1], L'x', L'X'))
             {
             if (text.length() >= 6 && text[text.length() - 6] == L' ')
@@ -246,10 +256,8 @@ namespace i18n_string_util
                 }
 
             // see if it is really a typo (missing space after a sentence)
-            if (static_cast<bool>(
-                    std::iswupper(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 1)])) &&
-                !static_cast<bool>(
-                    std::iswupper(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 2)])))
+            if (is_upper(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 1)]) &&
+                !is_upper(text[text.length() - (FILE_ADDRESS_MIN_LENGTH - 2)]))
                 {
                 return false;
                 }
@@ -292,8 +300,7 @@ namespace i18n_string_util
                                                         std::wstring_view{ L".tar." }) == 0)
             {
             // see if it is really a typo (missing space after a sentence).
-            return !static_cast<bool>(std::iswupper(text[text.length() - 4])) ||
-                   static_cast<bool>(std::iswupper(text[text.length() - 3]));
+            return !is_upper(text[text.length() - 4]) || is_upper(text[text.length() - 3]);
             }
         // C header/source files, which only have a letter in the extension,
         // but are common in documentation
@@ -366,10 +373,495 @@ namespace i18n_string_util
     //--------------------------------------------------
     bool contains_escaped_unicode_value(std::wstring_view str)
         {
-        // "\uXXXX", "\UXXXXXXXX", or "\xXX"/"\xXXXX" formats
-        static const std::wregex escapedUnicodeRegex{
-            LR"(\\(u[[:xdigit:]]{4}|U[[:xdigit:]]{8}|x[[:xdigit:]]{2}([[:xdigit:]]{2})?))"
+        const auto isHexRun = [&str](const size_t start, const size_t length)
+        {
+            return start + length <= str.length() &&
+                   std::all_of(std::next(str.cbegin(), static_cast<ptrdiff_t>(start)),
+                               std::next(str.cbegin(), static_cast<ptrdiff_t>(start + length)),
+                               [](const auto ch) { return string_util::is_hex_digit(ch); });
         };
-        return std::regex_search(str.cbegin(), str.cend(), escapedUnicodeRegex);
+        // "\uXXXX", "\UXXXXXXXX", or "\xXX"/"\xXXXX" formats
+        for (size_t i = str.find(L'\\'); i != std::wstring_view::npos;
+             i = str.find(L'\\', i + 1))
+            {
+            if (i + 1 < str.length() &&
+                ((str[i + 1] == L'u' && isHexRun(i + 2, 4)) ||
+                 (str[i + 1] == L'U' && isHexRun(i + 2, 8)) ||
+                 (str[i + 1] == L'x' && isHexRun(i + 2, 2))))
+                {
+                return true;
+                }
+            }
+        return false;
+        }
+
+    //--------------------------------------------------
+    uint8_t get_char_classes(std::wstring_view str) noexcept
+        {
+        // the halfwidth range, which an unsigned comparison of (ch - start) can test
+        constexpr wchar_t HALFWIDTH_START{ 0xFF61 };
+        constexpr wchar_t HALFWIDTH_SPAN{ 0xFFDC - 0xFF61 + 1 };
+        uint8_t classes{ 0 };
+        const auto* current = str.data();
+        const auto* const last = std::next(str.data(), static_cast<ptrdiff_t>(str.length()));
+#if defined(I18N_STRING_UTIL_SSE2)
+        // wchar_t is 32-bit on most systems, but 16-bit on Windows
+        constexpr size_t LANE_COUNT{ sizeof(__m128i) / sizeof(wchar_t) };
+        if (static_cast<size_t>(last - current) >= LANE_COUNT)
+            {
+            __m128i extended = _mm_setzero_si128();
+            __m128i halfwidth = _mm_setzero_si128();
+            __m128i backslash = _mm_setzero_si128();
+            if constexpr (sizeof(wchar_t) == 4)
+                {
+                const __m128i nonAsciiBits = _mm_set1_epi32(~0x7F);
+                const __m128i halfwidthStart = _mm_set1_epi32(HALFWIDTH_START);
+                const __m128i halfwidthSpan = _mm_set1_epi32(HALFWIDTH_SPAN);
+                const __m128i backslashes = _mm_set1_epi32(static_cast<int32_t>(L'\\'));
+                const __m128i belowZero = _mm_set1_epi32(-1);
+                while (static_cast<size_t>(last - current) >= LANE_COUNT)
+                    {
+                    const __m128i chars =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                    extended = _mm_or_si128(extended, _mm_and_si128(chars, nonAsciiBits));
+                    // code points are at most 0x10FFFF, so this can't overflow
+                    const __m128i offset = _mm_sub_epi32(chars, halfwidthStart);
+                    halfwidth = _mm_or_si128(
+                        halfwidth, _mm_and_si128(_mm_cmpgt_epi32(offset, belowZero),
+                                                 _mm_cmplt_epi32(offset, halfwidthSpan)));
+                    backslash = _mm_or_si128(backslash, _mm_cmpeq_epi32(chars, backslashes));
+                    std::advance(current, LANE_COUNT);
+                    }
+                }
+            else
+                {
+                const __m128i nonAsciiBits = _mm_set1_epi16(static_cast<int16_t>(~0x7F));
+                const __m128i halfwidthStart =
+                    _mm_set1_epi16(static_cast<int16_t>(HALFWIDTH_START));
+                // SSE2 only has signed comparisons, so flip the sign bits to compare unsigned
+                const __m128i signBits = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+                const __m128i halfwidthSpan =
+                    _mm_set1_epi16(static_cast<int16_t>(HALFWIDTH_SPAN ^ 0x8000));
+                const __m128i backslashes = _mm_set1_epi16(static_cast<int16_t>(L'\\'));
+                while (static_cast<size_t>(last - current) >= LANE_COUNT)
+                    {
+                    const __m128i chars =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                    extended = _mm_or_si128(extended, _mm_and_si128(chars, nonAsciiBits));
+                    const __m128i offset =
+                        _mm_xor_si128(_mm_sub_epi16(chars, halfwidthStart), signBits);
+                    halfwidth = _mm_or_si128(halfwidth, _mm_cmplt_epi16(offset, halfwidthSpan));
+                    backslash = _mm_or_si128(backslash, _mm_cmpeq_epi16(chars, backslashes));
+                    std::advance(current, LANE_COUNT);
+                    }
+                }
+            const auto hasAny = [](const __m128i lanes)
+            { return _mm_movemask_epi8(_mm_cmpeq_epi8(lanes, _mm_setzero_si128())) != 0xFFFF; };
+            if (hasAny(extended))
+                {
+                classes |= char_class_extended;
+                }
+            if (hasAny(halfwidth))
+                {
+                classes |= char_class_halfwidth;
+                }
+            if (hasAny(backslash))
+                {
+                classes |= char_class_backslash;
+                }
+            }
+#elif defined(I18N_STRING_UTIL_NEON)
+        if constexpr (sizeof(wchar_t) == 4)
+            {
+            uint32x4_t extended = vdupq_n_u32(0);
+            uint32x4_t halfwidth = vdupq_n_u32(0);
+            uint32x4_t backslash = vdupq_n_u32(0);
+            while (last - current >= 4)
+                {
+                const uint32x4_t chars = vld1q_u32(reinterpret_cast<const uint32_t*>(current));
+                extended = vorrq_u32(extended, vandq_u32(chars, vdupq_n_u32(~0x7FU)));
+                halfwidth = vorrq_u32(
+                    halfwidth, vcltq_u32(vsubq_u32(chars, vdupq_n_u32(HALFWIDTH_START)),
+                                         vdupq_n_u32(HALFWIDTH_SPAN)));
+                backslash = vorrq_u32(backslash, vceqq_u32(chars, vdupq_n_u32(L'\\')));
+                std::advance(current, 4);
+                }
+            classes |= (vmaxvq_u32(extended) != 0 ? char_class_extended : 0) |
+                       (vmaxvq_u32(halfwidth) != 0 ? char_class_halfwidth : 0) |
+                       (vmaxvq_u32(backslash) != 0 ? char_class_backslash : 0);
+            }
+        else
+            {
+            uint16x8_t extended = vdupq_n_u16(0);
+            uint16x8_t halfwidth = vdupq_n_u16(0);
+            uint16x8_t backslash = vdupq_n_u16(0);
+            while (last - current >= 8)
+                {
+                const uint16x8_t chars = vld1q_u16(reinterpret_cast<const uint16_t*>(current));
+                extended = vorrq_u16(extended, vandq_u16(chars, vdupq_n_u16(0xFF80)));
+                halfwidth = vorrq_u16(
+                    halfwidth, vcltq_u16(vsubq_u16(chars, vdupq_n_u16(HALFWIDTH_START)),
+                                         vdupq_n_u16(HALFWIDTH_SPAN)));
+                backslash = vorrq_u16(backslash, vceqq_u16(chars, vdupq_n_u16(L'\\')));
+                std::advance(current, 8);
+                }
+            classes |= (vmaxvq_u16(extended) != 0 ? char_class_extended : 0) |
+                       (vmaxvq_u16(halfwidth) != 0 ? char_class_halfwidth : 0) |
+                       (vmaxvq_u16(backslash) != 0 ? char_class_backslash : 0);
+            }
+#endif
+        // the remaining characters (or all of them, if not vectorized)
+        for (; current < last; std::advance(current, 1))
+            {
+            const auto ch = static_cast<uint32_t>(*current);
+            if (ch >= 128)
+                {
+                classes |= char_class_extended;
+                if (ch - static_cast<uint32_t>(HALFWIDTH_START) <
+                    static_cast<uint32_t>(HALFWIDTH_SPAN))
+                    {
+                    classes |= char_class_halfwidth;
+                    }
+                }
+            else if (ch == L'\\')
+                {
+                classes |= char_class_backslash;
+                }
+            }
+        return classes;
+        }
+
+    //--------------------------------------------------
+    const wchar_t* find_first_of_chars(const wchar_t* first, const wchar_t* last,
+                                       std::wstring_view chars) noexcept
+        {
+        // the most characters that will be compared against a block at once
+        constexpr size_t MAX_VECTORIZED_CHARS{ 16 };
+#if defined(I18N_STRING_UTIL_SSE2)
+        if (chars.length() <= MAX_VECTORIZED_CHARS)
+            {
+            // wchar_t is 32-bit on most systems, but 16-bit on Windows
+            constexpr size_t LANE_COUNT{ sizeof(__m128i) / sizeof(wchar_t) };
+            __m128i needles[MAX_VECTORIZED_CHARS]{}; // NOLINT(modernize-avoid-c-arrays)
+            for (size_t i = 0; i < chars.length(); ++i)
+                {
+                if constexpr (sizeof(wchar_t) == 4)
+                    {
+                    needles[i] = _mm_set1_epi32(static_cast<int32_t>(chars[i]));
+                    }
+                else
+                    {
+                    needles[i] = _mm_set1_epi16(static_cast<int16_t>(chars[i]));
+                    }
+                }
+            while (static_cast<size_t>(last - first) >= LANE_COUNT)
+                {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                __m128i matches = _mm_setzero_si128();
+                for (size_t i = 0; i < chars.length(); ++i)
+                    {
+                    if constexpr (sizeof(wchar_t) == 4)
+                        {
+                        matches = _mm_or_si128(matches, _mm_cmpeq_epi32(block, needles[i]));
+                        }
+                    else
+                        {
+                        matches = _mm_or_si128(matches, _mm_cmpeq_epi16(block, needles[i]));
+                        }
+                    }
+                // one bit per byte, so divide the first set bit by the character size
+                if (const auto matchMask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+                    matchMask != 0)
+                    {
+                    return std::next(first, std::countr_zero(matchMask) / sizeof(wchar_t));
+                    }
+                std::advance(first, LANE_COUNT);
+                }
+            }
+#elif defined(I18N_STRING_UTIL_NEON)
+        if (chars.length() <= MAX_VECTORIZED_CHARS)
+            {
+            if constexpr (sizeof(wchar_t) == 4)
+                {
+                uint32x4_t needles[MAX_VECTORIZED_CHARS]{}; // NOLINT(modernize-avoid-c-arrays)
+                for (size_t i = 0; i < chars.length(); ++i)
+                    {
+                    needles[i] = vdupq_n_u32(static_cast<uint32_t>(chars[i]));
+                    }
+                while (last - first >= 4)
+                    {
+                    const uint32x4_t block = vld1q_u32(reinterpret_cast<const uint32_t*>(first));
+                    uint32x4_t matches = vdupq_n_u32(0);
+                    for (size_t i = 0; i < chars.length(); ++i)
+                        {
+                        matches = vorrq_u32(matches, vceqq_u32(block, needles[i]));
+                        }
+                    // the block has a match, let the scalar search below find where
+                    if (vmaxvq_u32(matches) != 0)
+                        {
+                        break;
+                        }
+                    std::advance(first, 4);
+                    }
+                }
+            else
+                {
+                uint16x8_t needles[MAX_VECTORIZED_CHARS]{}; // NOLINT(modernize-avoid-c-arrays)
+                for (size_t i = 0; i < chars.length(); ++i)
+                    {
+                    needles[i] = vdupq_n_u16(static_cast<uint16_t>(chars[i]));
+                    }
+                while (last - first >= 8)
+                    {
+                    const uint16x8_t block = vld1q_u16(reinterpret_cast<const uint16_t*>(first));
+                    uint16x8_t matches = vdupq_n_u16(0);
+                    for (size_t i = 0; i < chars.length(); ++i)
+                        {
+                        matches = vorrq_u16(matches, vceqq_u16(block, needles[i]));
+                        }
+                    if (vmaxvq_u16(matches) != 0)
+                        {
+                        break;
+                        }
+                    std::advance(first, 8);
+                    }
+                }
+            }
+#endif
+        return std::find_first_of(first, last, chars.cbegin(), chars.cend());
+        }
+
+    //--------------------------------------------------
+    uint64_t scan_line_block(const wchar_t* block, const bool includeTabs) noexcept
+        {
+        // if not including tabs, then just compare against a newline again
+        const wchar_t tab{ includeTabs ? L'\t' : L'\n' };
+        uint64_t found{ 0 };
+#if defined(I18N_STRING_UTIL_SSE2)
+        // four 128-bit registers' worth of characters
+        constexpr size_t LANE_COUNT{ sizeof(__m128i) / sizeof(wchar_t) };
+        if constexpr (sizeof(wchar_t) == 4)
+            {
+            const __m128i newlines = _mm_set1_epi32(static_cast<int32_t>(L'\n'));
+            const __m128i carriageReturns = _mm_set1_epi32(static_cast<int32_t>(L'\r'));
+            const __m128i tabs = _mm_set1_epi32(static_cast<int32_t>(tab));
+            for (size_t i = 0; i < 4; ++i)
+                {
+                const __m128i chars = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(std::next(block, i * LANE_COUNT)));
+                const __m128i matches = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi32(chars, newlines),
+                                 _mm_cmpeq_epi32(chars, carriageReturns)),
+                    _mm_cmpeq_epi32(chars, tabs));
+                // one bit per 32-bit lane
+                found |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(matches)))
+                         << (i * LANE_COUNT);
+                }
+            }
+        else
+            {
+            const __m128i newlines = _mm_set1_epi16(static_cast<int16_t>(L'\n'));
+            const __m128i carriageReturns = _mm_set1_epi16(static_cast<int16_t>(L'\r'));
+            const __m128i tabs = _mm_set1_epi16(static_cast<int16_t>(tab));
+            const auto compareChars = [&](const size_t i)
+            {
+                const __m128i chars = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(std::next(block, i * LANE_COUNT)));
+                return _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(chars, newlines),
+                                                 _mm_cmpeq_epi16(chars, carriageReturns)),
+                                    _mm_cmpeq_epi16(chars, tabs));
+            };
+            // pack two registers' results into bytes to get one bit per 16-bit lane
+            for (size_t i = 0; i < 4; i += 2)
+                {
+                found |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(
+                             _mm_packs_epi16(compareChars(i), compareChars(i + 1)))))
+                         << (i * LANE_COUNT);
+                }
+            }
+#elif defined(I18N_STRING_UTIL_NEON)
+        if constexpr (sizeof(wchar_t) == 4)
+            {
+            constexpr size_t LANE_COUNT{ 4 };
+            const uint32x4_t laneBits{ 1, 2, 4, 8 };
+            for (size_t i = 0; i < 4; ++i)
+                {
+                const uint32x4_t chars = vld1q_u32(
+                    reinterpret_cast<const uint32_t*>(std::next(block, i * LANE_COUNT)));
+                const uint32x4_t matches =
+                    vorrq_u32(vorrq_u32(vceqq_u32(chars, vdupq_n_u32(L'\n')),
+                                        vceqq_u32(chars, vdupq_n_u32(L'\r'))),
+                              vceqq_u32(chars, vdupq_n_u32(static_cast<uint32_t>(tab))));
+                found |= static_cast<uint64_t>(vaddvq_u32(vandq_u32(matches, laneBits)))
+                         << (i * LANE_COUNT);
+                }
+            }
+        else
+            {
+            constexpr size_t LANE_COUNT{ 8 };
+            const uint16x8_t laneBits{ 1, 2, 4, 8, 16, 32, 64, 128 };
+            for (size_t i = 0; i < 4; ++i)
+                {
+                const uint16x8_t chars = vld1q_u16(
+                    reinterpret_cast<const uint16_t*>(std::next(block, i * LANE_COUNT)));
+                const uint16x8_t matches =
+                    vorrq_u16(vorrq_u16(vceqq_u16(chars, vdupq_n_u16(L'\n')),
+                                        vceqq_u16(chars, vdupq_n_u16(L'\r'))),
+                              vceqq_u16(chars, vdupq_n_u16(static_cast<uint16_t>(tab))));
+                found |= static_cast<uint64_t>(vaddvq_u16(vandq_u16(matches, laneBits)))
+                         << (i * LANE_COUNT);
+                }
+            }
+#else
+        for (size_t i = 0; i < LINE_SCAN_BLOCK_SIZE; ++i)
+            {
+            if (block[i] == L'\n' || block[i] == L'\r' || block[i] == tab)
+                {
+                found |= (static_cast<uint64_t>(1) << i);
+                }
+            }
+#endif
+        return found;
+        }
+
+    //--------------------------------------------------
+    whole_word_matcher::whole_word_matcher(const std::vector<std::wstring>& words)
+        {
+        // the root node
+        m_nodes.emplace_back();
+        // the parent, character leading into, and depth of each node,
+        // needed only while building the failure links
+        std::vector<std::pair<uint32_t, wchar_t>> parents{ { 0, 0 } };
+        std::vector<size_t> depths{ 0 };
+
+        for (size_t wordIndex = 0; wordIndex < words.size(); ++wordIndex)
+            {
+            const auto& word = words[wordIndex];
+            if (word.empty())
+                {
+                continue;
+                }
+            uint32_t current{ 0 };
+            for (const auto ch : word)
+                {
+                const auto [transition, inserted] = m_transitions.try_emplace(
+                    transition_key(current, ch), static_cast<uint32_t>(m_nodes.size()));
+                if (inserted)
+                    {
+                    m_nodes.emplace_back();
+                    parents.emplace_back(current, ch);
+                    depths.push_back(depths[current] + 1);
+                    }
+                current = transition->second;
+                }
+            // a duplicate word is reported under its first index
+            if (m_nodes[current].m_word == NO_NODE)
+                {
+                m_nodes[current].m_word = static_cast<uint32_t>(m_word_lengths.size());
+                m_word_lengths.push_back(word.length());
+                m_word_indices.push_back(wordIndex);
+                }
+            }
+
+        // a node's failure link is always shallower than it,
+        // so build them breadth first (i.e., in order of depth)
+        std::vector<uint32_t> byDepth(m_nodes.size());
+        std::iota(byDepth.begin(), byDepth.end(), 0);
+        std::stable_sort(byDepth.begin(), byDepth.end(), [&depths](const auto lhv, const auto rhv)
+                         { return depths[lhv] < depths[rhv]; });
+        for (const auto current : byDepth)
+            {
+            const auto [parent, ch] = parents[current];
+            if (current == 0 || parent == 0)
+                {
+                continue;
+                }
+            uint32_t failure{ m_nodes[parent].m_failure };
+            uint32_t next{ next_node(failure, ch) };
+            while (next == NO_NODE && failure != 0)
+                {
+                failure = m_nodes[failure].m_failure;
+                next = next_node(failure, ch);
+                }
+            auto& currentNode = m_nodes[current];
+            currentNode.m_failure = (next != NO_NODE) ? next : 0;
+            const auto& failureNode = m_nodes[currentNode.m_failure];
+            currentNode.m_next_output =
+                (failureNode.m_word != NO_NODE) ? currentNode.m_failure : failureNode.m_next_output;
+            }
+        }
+
+    //--------------------------------------------------
+    std::vector<std::pair<size_t, size_t>> whole_word_matcher::count(std::wstring_view text) const
+        {
+        struct word_hit
+            {
+            uint32_t m_word{ 0 };
+            size_t m_count{ 0 };
+            // where the last counted occurrence ended, to not count overlapping ones
+            size_t m_end{ 0 };
+            };
+
+        if (empty())
+            {
+            return {};
+            }
+        std::vector<word_hit> hits;
+
+        const auto isWordBoundary = [](const wchar_t ch) noexcept
+        { return is_space(ch) || is_punctuation(ch); };
+
+        uint32_t current{ 0 };
+        for (size_t i = 0; i < text.length(); ++i)
+            {
+            uint32_t next{ next_node(current, text[i]) };
+            while (next == NO_NODE && current != 0)
+                {
+                current = m_nodes[current].m_failure;
+                next = next_node(current, text[i]);
+                }
+            current = (next != NO_NODE) ? next : 0;
+
+            // every word ending here must be followed by the end of the string or a boundary
+            const size_t end{ i + 1 };
+            if (end < text.length() && !isWordBoundary(text[end]))
+                {
+                continue;
+                }
+            for (uint32_t output = (m_nodes[current].m_word != NO_NODE) ?
+                                       current :
+                                       m_nodes[current].m_next_output;
+                 output != NO_NODE; output = m_nodes[output].m_next_output)
+                {
+                const uint32_t word{ m_nodes[output].m_word };
+                const size_t start{ end - m_word_lengths[word] };
+                if (start > 0 && !isWordBoundary(text[start - 1]))
+                    {
+                    continue;
+                    }
+                auto hit = std::find_if(hits.begin(), hits.end(), [word](const auto& prevHit)
+                                        { return prevHit.m_word == word; });
+                if (hit == hits.end())
+                    {
+                    hits.push_back({ word, 1, end });
+                    }
+                else if (start >= hit->m_end)
+                    {
+                    ++hit->m_count;
+                    hit->m_end = end;
+                    }
+                }
+            }
+
+        // words were numbered in the order they were passed in
+        std::sort(hits.begin(), hits.end(),
+                  [](const auto& lhv, const auto& rhv) { return lhv.m_word < rhv.m_word; });
+        std::vector<std::pair<size_t, size_t>> results;
+        results.reserve(hits.size());
+        for (const auto& hit : hits)
+            {
+            results.emplace_back(m_word_indices[hit.m_word], hit.m_count);
+            }
+        return results;
         }
     } // namespace i18n_string_util
@@ -18,9 +18,14 @@
 #ifndef I18N_EXTRACT_H
 #define I18N_EXTRACT_H
 
+#include "unicode_tables.h"
+#include <cstdint>
 #include <regex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 /// @brief Helper functions for reviewing i18n/l10n related strings.
 namespace i18n_string_util
@@ -60,6 +65,125 @@ namespace i18n_string_util
                 ((ch >= 0x61 /*'a'*/) && (ch <= 0x7A /*'z'*/)));
         }
 
+    /** @brief Looks up the Unicode properties of a character.
+        @details Unlike @c std::iswspace(), @c std::iswpunct(), etc., this does not depend
+            on the current locale, and doesn't go through the C runtime's locale tables.
+            ASCII characters are read directly from the first block of the table.
+        @param ch The character to look up.
+        @returns The character's @c unicode_tables::property flags.*/
+    [[nodiscard]]
+    constexpr uint8_t get_char_properties(const wchar_t ch) noexcept
+        {
+        const auto codePoint = static_cast<uint32_t>(ch);
+        if (codePoint < 0x80)
+            {
+            return unicode_tables::PROPERTY_BLOCKS[codePoint];
+            }
+        if (codePoint >= unicode_tables::PROPERTY_LIMIT)
+            {
+            return 0;
+            }
+        constexpr uint32_t BLOCK_MASK{ (1U << unicode_tables::BLOCK_SHIFT) - 1 };
+        return unicode_tables::PROPERTY_BLOCKS
+            [(static_cast<size_t>(
+                  unicode_tables::PROPERTY_INDEX[codePoint >> unicode_tables::BLOCK_SHIFT])
+              << unicode_tables::BLOCK_SHIFT) |
+             (codePoint & BLOCK_MASK)];
+        }
+
+    /** @returns @c true if a character is a space (locale-independent @c std::iswspace()).
+        @note No-break spaces are not considered spaces.
+        @param ch The character to review.*/
+    [[nodiscard]]
+    constexpr bool is_space(const wchar_t ch) noexcept
+        {
+        return (get_char_properties(ch) & unicode_tables::space) != 0;
+        }
+
+    /** @returns @c true if a character is punctuation or a symbol
+            (locale-independent @c std::iswpunct()).
+        @param ch The character to review.*/
+    [[nodiscard]]
+    constexpr bool is_punctuation(const wchar_t ch) noexcept
+        {
+        return (get_char_properties(ch) & unicode_tables::punctuation) != 0;
+        }
+
+    /** @returns @c true if a character is a letter from any script
+            (locale-independent @c std::iswalpha()).
+        @param ch The character to review.*/
+    [[nodiscard]]
+    constexpr bool is_alpha(const wchar_t ch) noexcept
+        {
+        return (get_char_properties(ch) & unicode_tables::alpha) != 0;
+        }
+
+    /** @returns @c true if a character is a letter or decimal digit from any script
+            (locale-independent @c std::iswalnum()).
+        @param ch The character to review.*/
+    [[nodiscard]]
+    constexpr bool is_alnum(const wchar_t ch) noexcept
+        {
+        return (get_char_properties(ch) & (unicode_tables::alpha | unicode_tables::digit)) != 0;
+        }
+
+    /** @returns @c true if a character is an uppercase (or titlecase) letter
+            (locale-independent @c std::iswupper()).
+        @param ch The character to review.*/
+    [[nodiscard]]
+    constexpr bool is_upper(const wchar_t ch) noexcept
+        {
+        return (get_char_properties(ch) & unicode_tables::upper) != 0;
+        }
+
+    /** @returns @c true if a character is a lowercase letter
+            (locale-independent @c std::iswlower()).
+        @param ch The character to review.*/
+    [[nodiscard]]
+    constexpr bool is_lower(const wchar_t ch) noexcept
+        {
+        return (get_char_properties(ch) & unicode_tables::lower) != 0;
+        }
+
+    /// @private
+    template<size_t indexSize, size_t blocksSize>
+    [[nodiscard]]
+    constexpr wchar_t map_char_case(const wchar_t ch,
+                                    const std::array<uint8_t, indexSize>& blockIndex,
+                                    const std::array<uint16_t, blocksSize>& blocks) noexcept
+        {
+        const auto codePoint = static_cast<uint32_t>(ch);
+        if (codePoint >= unicode_tables::CASE_MAPPING_LIMIT)
+            {
+            return ch;
+            }
+        constexpr uint32_t BLOCK_MASK{ (1U << unicode_tables::BLOCK_SHIFT) - 1 };
+        const uint16_t delta =
+            (codePoint < 0x80) ?
+                blocks[codePoint] :
+                blocks[(static_cast<size_t>(blockIndex[codePoint >> unicode_tables::BLOCK_SHIFT])
+                        << unicode_tables::BLOCK_SHIFT) |
+                       (codePoint & BLOCK_MASK)];
+        // the mapping is in the same plane, so only the lower 16 bits change
+        return static_cast<wchar_t>((codePoint & ~0xFFFFU) | ((codePoint + delta) & 0xFFFFU));
+        }
+
+    /** @returns The lowercase form of a character (locale-independent @c std::towlower()).
+        @param ch The character to convert.*/
+    [[nodiscard]]
+    constexpr wchar_t to_lower(const wchar_t ch) noexcept
+        {
+        return map_char_case(ch, unicode_tables::LOWER_INDEX, unicode_tables::LOWER_BLOCKS);
+        }
+
+    /** @returns The uppercase form of a character (locale-independent @c std::towupper()).
+        @param ch The character to convert.*/
+    [[nodiscard]]
+    constexpr wchar_t to_upper(const wchar_t ch) noexcept
+        {
+        return map_char_case(ch, unicode_tables::UPPER_INDEX, unicode_tables::UPPER_BLOCKS);
+        }
+
     /** @returns @c true if a character is an apostrophe (includes straight single quotes).
         @param ch The letter to be reviewed.*/
     [[nodiscard]]
@@ -241,6 +365,119 @@ namespace i18n_string_util
     [[nodiscard]]
     bool contains_escaped_unicode_value(std::wstring_view str);
 
+    /// @brief Classes of characters that get_char_classes() looks for.
+    enum char_class : uint8_t
+        {
+        /// @brief A character outside of the 7-bit ASCII range.
+        char_class_extended = (1 << 0),
+        /// @brief A halfwidth Kana, Hangul, or punctuation character (U+FF61-U+FFDC).
+        char_class_halfwidth = (1 << 1),
+        /// @brief A backslash (e.g., the start of an escaped Unicode value).
+        char_class_backslash = (1 << 2)
+        };
+
+    /** @brief Looks for several classes of characters in a string in one pass.
+        @details Where SSE2 or NEON is available, a block of characters is compared at once.\n
+            This lets several character-based checks share one scan of the string.
+        @param str The string to review.
+        @returns The @c char_class flags of the classes found in the string.*/
+    [[nodiscard]]
+    uint8_t get_char_classes(std::wstring_view str) noexcept;
+
+    /** @brief Finds the first character in a block of text that is one of a small
+            set of characters.
+        @details This is the same as @c std::find_first_of(), except that (where SSE2 or NEON
+            is available) it compares a block of characters against the set at once.\n
+            This is meant for jumping over long stretches of text that do not contain
+            any of the characters being searched for.
+        @param first The start of the text.
+        @param last The end of the text.
+        @param chars The characters to search for.
+        @returns A pointer to the first character found, or @c last if none were found.*/
+    [[nodiscard]]
+    const wchar_t* find_first_of_chars(const wchar_t* first, const wchar_t* last,
+                                       std::wstring_view chars) noexcept;
+
+    /// @brief The number of characters that scan_line_block() looks at
+    ///     (64 bytes' worth, so 16 characters where @c wchar_t is 32-bit, 32 on Windows).
+    constexpr size_t LINE_SCAN_BLOCK_SIZE{ 64 / sizeof(wchar_t) };
+
+    /** @brief Finds the line breaks (and optionally, the tabs) in a block of characters.
+        @details Where SSE2 or NEON is available, the entire block is compared at once.\n
+            This is meant for reviewing line formatting (e.g., line lengths), where only
+            the line boundaries are needed, not the text's syntax.
+        @param block The start of the block, which must have at least
+            @c LINE_SCAN_BLOCK_SIZE characters.
+        @param includeTabs @c true to include tabs in the results.
+        @returns A mask with a bit set for each carriage return, newline, or tab in the block
+            (the block's first character being the lowest bit).*/
+    [[nodiscard]]
+    uint64_t scan_line_block(const wchar_t* block, const bool includeTabs) noexcept;
+
+    /** @brief Counts the whole-word occurrences of a list of words (or phrases) in strings.
+        @details The words are compiled into an Aho-Corasick automaton, so each string is scanned
+            once regardless of how many words there are.\n
+            Matching follows string_util::find_whole_word(): a word must be bounded by
+            the ends of the string, spaces, or punctuation, it is case sensitive, and
+            overlapping occurrences of the same word are only counted once.*/
+    class whole_word_matcher
+        {
+      public:
+        /// @private
+        whole_word_matcher() = default;
+
+        /// @brief Constructor.
+        /// @param words The words to search for (empty words are ignored).
+        explicit whole_word_matcher(const std::vector<std::wstring>& words);
+
+        /** @brief Counts the occurrences of the words in a string.
+            @param text The string to search.
+            @returns The index (into the list of words passed to the constructor) of each
+                word found in @c text and how many times it was found, sorted by index.
+                For duplicate words, only the first one's index is reported.*/
+        [[nodiscard]]
+        std::vector<std::pair<size_t, size_t>> count(std::wstring_view text) const;
+
+        /// @returns @c true if there are no words to search for.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_word_lengths.empty();
+            }
+
+      private:
+        constexpr static uint32_t NO_NODE{ static_cast<uint32_t>(-1) };
+
+        struct node
+            {
+            // the longest proper suffix of this node's path that is also in the trie
+            uint32_t m_failure{ 0 };
+            // the closest node along the failure links that ends a word
+            uint32_t m_next_output{ NO_NODE };
+            // the word that this node ends (index into m_word_lengths)
+            uint32_t m_word{ NO_NODE };
+            };
+
+        [[nodiscard]]
+        uint32_t next_node(const uint32_t current, const wchar_t ch) const
+            {
+            const auto transition = m_transitions.find(transition_key(current, ch));
+            return (transition != m_transitions.cend()) ? transition->second : NO_NODE;
+            }
+
+        [[nodiscard]]
+        constexpr static uint64_t transition_key(const uint32_t current, const wchar_t ch) noexcept
+            {
+            return (static_cast<uint64_t>(current) << 32) | static_cast<uint32_t>(ch);
+            }
+
+        std::vector<node> m_nodes;
+        std::unordered_map<uint64_t, uint32_t> m_transitions;
+        std::vector<size_t> m_word_lengths;
+        // the index of each (unique) word in the list passed to the constructor
+        std::vector<size_t> m_word_indices;
+        };
+
     /** @brief Converts a string to wstring (assuming that the string is simple 8-bit ASCII).
         @param str The string to convert.
         @returns The string, converted to a wstring.
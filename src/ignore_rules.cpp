@@ -0,0 +1,380 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "ignore_rules.h"
+#include "i18n_string_util.h"
+#include "utfcpp/source/utf8.h"
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+
+namespace
+    {
+    //------------------------------------------------
+    std::optional<std::wstring> read_ignore_file(const std::filesystem::path& filePath)
+        {
+        std::ifstream ifs(filePath, std::ios::binary);
+        if (!ifs)
+            {
+            return std::nullopt;
+            }
+        const std::string content{ std::istreambuf_iterator<char>(ifs),
+                                   std::istreambuf_iterator<char>{} };
+        // ignore files are UTF-8 (and git skips a signature)
+        auto contentStart{ content.cbegin() };
+        if (utf8::starts_with_bom(content.cbegin(), content.cend()))
+            {
+            std::advance(contentStart, std::size(utf8::bom));
+            }
+        if (!utf8::is_valid(contentStart, content.cend()))
+            {
+            return i18n_string_util::lazy_string_to_wstring(
+                std::string{ contentStart, content.cend() });
+            }
+        // decoded to the same width as the file names being compared against
+        // (UTF-16 or UTF-32), so that non-ASCII names match
+        std::wstring patterns;
+        patterns.reserve(content.length());
+        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
+            {
+            utf8::utf8to16(contentStart, content.cend(), std::back_inserter(patterns));
+            }
+        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+            {
+            utf8::utf8to32(contentStart, content.cend(), std::back_inserter(patterns));
+            }
+        return patterns;
+        }
+
+    //------------------------------------------------
+    bool glob_match_from(const std::wstring_view pattern, size_t patternPos,
+                         const std::wstring_view path, size_t pathPos)
+        {
+        while (patternPos < pattern.length())
+            {
+            const wchar_t patternChar{ pattern[patternPos] };
+            if (patternChar == L'*')
+                {
+                // "**" as a whole segment matches any number of folders
+                if (patternPos + 1 < pattern.length() && pattern[patternPos + 1] == L'*' &&
+                    (patternPos == 0 || pattern[patternPos - 1] == L'/') &&
+                    (patternPos + 2 == pattern.length() || pattern[patternPos + 2] == L'/'))
+                    {
+                    if (patternPos + 2 == pattern.length())
+                        {
+                        return true;
+                        }
+                    // "**/" matches nothing, or anything up to and including a '/'
+                    patternPos += 3;
+                    if (glob_match_from(pattern, patternPos, path, pathPos))
+                        {
+                        return true;
+                        }
+                    for (; pathPos < path.length(); ++pathPos)
+                        {
+                        if (path[pathPos] == L'/' &&
+                            glob_match_from(pattern, patternPos, path, pathPos + 1))
+                            {
+                            return true;
+                            }
+                        }
+                    return false;
+                    }
+                // any other '*' (or run of them) matches anything within the current segment
+                while (patternPos < pattern.length() && pattern[patternPos] == L'*')
+                    {
+                    ++patternPos;
+                    }
+                if (patternPos == pattern.length())
+                    {
+                    return path.find(L'/', pathPos) == std::wstring_view::npos;
+                    }
+                for (; pathPos < path.length() && path[pathPos] != L'/'; ++pathPos)
+                    {
+                    if (glob_match_from(pattern, patternPos, path, pathPos))
+                        {
+                        return true;
+                        }
+                    }
+                return glob_match_from(pattern, patternPos, path, pathPos);
+                }
+
+            if (pathPos == path.length())
+                {
+                return false;
+                }
+            const wchar_t pathChar{ path[pathPos] };
+            if (patternChar == L'?')
+                {
+                if (pathChar == L'/')
+                    {
+                    return false;
+                    }
+                }
+            else if (patternChar == L'[')
+                {
+                size_t classStart{ patternPos + 1 };
+                const bool negated{ classStart < pattern.length() &&
+                                    (pattern[classStart] == L'!' || pattern[classStart] == L'^') };
+                if (negated)
+                    {
+                    ++classStart;
+                    }
+                // a ']' right after the '[' is part of the class
+                const size_t classEnd{ pattern.find(L']', classStart + 1) };
+                if (classEnd == std::wstring_view::npos)
+                    {
+                    // not a class, just a '['
+                    if (pathChar != L'[')
+                        {
+                        return false;
+                        }
+                    }
+                else
+                    {
+                    bool inClass{ false };
+                    for (size_t i = classStart; i < classEnd && !inClass; ++i)
+                        {
+                        if (i + 2 < classEnd && pattern[i + 1] == L'-')
+                            {
+                            inClass = (pathChar >= pattern[i] && pathChar <= pattern[i + 2]);
+                            i += 2;
+                            }
+                        else
+                            {
+                            inClass = (pathChar == pattern[i]);
+                            }
+                        }
+                    if (pathChar == L'/' || inClass == negated)
+                        {
+                        return false;
+                        }
+                    patternPos = classEnd;
+                    }
+                }
+            else if (patternChar == L'\\' && patternPos + 1 < pattern.length())
+                {
+                ++patternPos;
+                if (pathChar != pattern[patternPos])
+                    {
+                    return false;
+                    }
+                }
+            else if (pathChar != patternChar)
+                {
+                return false;
+                }
+            ++patternPos;
+            ++pathPos;
+            }
+        return pathPos == path.length();
+        }
+    } // namespace
+
+namespace i18n_check
+    {
+    //------------------------------------------------
+    ignore_rules::ignore_rules(std::wstring_view patterns, std::wstring basePath,
+                               std::shared_ptr<const ignore_rules> parent)
+        : m_basePath(std::move(basePath)), m_parent(std::move(parent))
+        {
+        if (patterns.starts_with(L'\uFEFF'))
+            {
+            patterns.remove_prefix(1);
+            }
+
+        while (!patterns.empty())
+            {
+            const size_t lineEnd{ patterns.find(L'\n') };
+            std::wstring_view line{ patterns.substr(0, lineEnd) };
+            patterns.remove_prefix(lineEnd == std::wstring_view::npos ? patterns.length() :
+                                                                        lineEnd + 1);
+
+            if (line.ends_with(L'\r'))
+                {
+                line.remove_suffix(1);
+                }
+            // trailing spaces are ignored, unless escaped
+            while (line.ends_with(L' ') && !line.ends_with(L"\\ "))
+                {
+                line.remove_suffix(1);
+                }
+            if (line.empty() || line.starts_with(L'#'))
+                {
+                continue;
+                }
+
+            pattern pat;
+            // (an escaped "\!" or "\#" at the start is matched literally by the glob)
+            if (line.starts_with(L'!'))
+                {
+                pat.m_negated = true;
+                line.remove_prefix(1);
+                }
+            if (line.ends_with(L'/'))
+                {
+                pat.m_directoryOnly = true;
+                line.remove_suffix(1);
+                }
+            pat.m_anchored = (line.find(L'/') != std::wstring_view::npos);
+            if (line.starts_with(L'/'))
+                {
+                line.remove_prefix(1);
+                }
+            if (line.empty())
+                {
+                continue;
+                }
+
+            constexpr std::wstring_view WILDCARDS{ L"*?[\\" };
+            if (line.find_first_of(WILDCARDS) == std::wstring_view::npos)
+                {
+                pat.m_matchType = match_type::literal;
+                }
+            else if (!pat.m_anchored && line.starts_with(L'*') &&
+                     line.find_first_of(WILDCARDS, 1) == std::wstring_view::npos)
+                {
+                pat.m_matchType = match_type::suffix;
+                line.remove_prefix(1);
+                }
+            pat.m_pattern = line;
+            m_patterns.push_back(std::move(pat));
+            }
+        }
+
+    //------------------------------------------------
+    std::shared_ptr<const ignore_rules>
+    ignore_rules::load_folder(const std::filesystem::path& folder, const std::wstring& basePath,
+                              std::shared_ptr<const ignore_rules> parent)
+        {
+        for (const auto* fileName : { L".gitignore", L".ignore" })
+            {
+            if (const auto patterns = read_ignore_file(folder / fileName); patterns.has_value())
+                {
+                parent = std::make_shared<const ignore_rules>(patterns.value(), basePath,
+                                                              std::move(parent));
+                }
+            }
+        return parent;
+        }
+
+    //------------------------------------------------
+    std::pair<std::shared_ptr<const ignore_rules>, std::wstring>
+    ignore_rules::load_parent_folders(const std::filesystem::path& folder)
+        {
+        std::error_code fileError;
+        const std::filesystem::path canonicalFolder{ std::filesystem::weakly_canonical(
+            folder, fileError) };
+        if (fileError)
+            {
+            return { nullptr, std::wstring{} };
+            }
+
+        // find the repository's root
+        std::filesystem::path root{ canonicalFolder };
+        while (!std::filesystem::exists(root / L".git", fileError))
+            {
+            if (!root.has_relative_path())
+                {
+                return { nullptr, std::wstring{} };
+                }
+            root = root.parent_path();
+            }
+
+        // the repository's own exclusions have the lowest precedence
+        std::shared_ptr<const ignore_rules> rules;
+        if (const auto patterns = read_ignore_file(root / L".git" / L"info" / L"exclude");
+            patterns.has_value())
+            {
+            rules = std::make_shared<const ignore_rules>(patterns.value(), std::wstring{}, nullptr);
+            }
+
+        // load the folders from the root down to the folder being walked
+        const std::filesystem::path relativeFolder{ canonicalFolder.lexically_relative(root) };
+        std::filesystem::path currentFolder{ root };
+        std::wstring basePath;
+        for (const auto& folderName : relativeFolder)
+            {
+            if (folderName.empty() || folderName == L".")
+                {
+                continue;
+                }
+            rules = load_folder(currentFolder, basePath, std::move(rules));
+            currentFolder /= folderName;
+            if (!basePath.empty())
+                {
+                basePath += L'/';
+                }
+            basePath += folderName.wstring();
+            }
+
+        return { rules, basePath };
+        }
+
+    //------------------------------------------------
+    bool ignore_rules::is_ignored(std::wstring_view relativePath, const bool isDirectory) const
+        {
+        const size_t lastSeparator{ relativePath.rfind(L'/') };
+        const std::wstring_view name{ lastSeparator == std::wstring_view::npos ?
+                                          relativePath :
+                                          relativePath.substr(lastSeparator + 1) };
+
+        // the deepest folder's last matching pattern wins
+        for (const ignore_rules* rules = this; rules != nullptr; rules = rules->m_parent.get())
+            {
+            // the path relative to the ignore file's folder
+            std::wstring_view subPath{ relativePath };
+            if (!rules->m_basePath.empty())
+                {
+                if (subPath.length() <= rules->m_basePath.length() ||
+                    !subPath.starts_with(rules->m_basePath) ||
+                    subPath[rules->m_basePath.length()] != L'/')
+                    {
+                    continue;
+                    }
+                subPath.remove_prefix(rules->m_basePath.length() + 1);
+                }
+
+            for (auto pat = rules->m_patterns.crbegin(); pat != rules->m_patterns.crend(); ++pat)
+                {
+                if ((!pat->m_directoryOnly || isDirectory) &&
+                    matches(*pat, pat->m_anchored ? subPath : name))
+                    {
+                    return !pat->m_negated;
+                    }
+                }
+            }
+        return false;
+        }
+
+    //------------------------------------------------
+    bool ignore_rules::glob_match(std::wstring_view pattern, std::wstring_view path)
+        {
+        return glob_match_from(pattern, 0, path, 0);
+        }
+
+    //------------------------------------------------
+    bool ignore_rules::matches(const pattern& pat, std::wstring_view path)
+        {
+        if (pat.m_matchType == match_type::literal)
+            {
+            return path == pat.m_pattern;
+            }
+        if (pat.m_matchType == match_type::suffix)
+            {
+            return path.ends_with(pat.m_pattern);
+            }
+        return glob_match(pat.m_pattern, path);
+        }
+    } // namespace i18n_check
@@ -0,0 +1,127 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef IGNORE_RULES_H
+#define IGNORE_RULES_H
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief The patterns from a folder's @c .gitignore (or @c .ignore) file,
+            chained to the patterns from its parent folders.
+        @details Paths are relative to the root of the tree being walked
+            (the repository's root if there is one) and use '/' as the separator.\n
+            As with git, patterns from deeper folders take precedence over their
+            parents' patterns, and later patterns in a file take precedence over
+            earlier ones.
+        @sa https://git-scm.com/docs/gitignore*/
+    class ignore_rules
+        {
+      public:
+        /** @brief Compiles the patterns from an ignore file.
+            @param patterns The content of the ignore file.
+            @param basePath The folder of the ignore file, relative to the root
+                (empty for the root itself).
+            @param parent The rules from the parent folders (can be null).*/
+        ignore_rules(std::wstring_view patterns, std::wstring basePath,
+                     std::shared_ptr<const ignore_rules> parent);
+
+        /** @brief Loads the @c .gitignore and @c .ignore files from a folder.
+            @details Patterns in @c .ignore take precedence over those in @c .gitignore.
+            @param folder The folder to load the files from.
+            @param basePath The folder's path, relative to the root.
+            @param parent The rules from the parent folders (can be null).
+            @returns The folder's rules chained to @c parent,
+                or @c parent if the folder doesn't have any ignore files.*/
+        [[nodiscard]]
+        static std::shared_ptr<const ignore_rules>
+        load_folder(const std::filesystem::path& folder, const std::wstring& basePath,
+                    std::shared_ptr<const ignore_rules> parent);
+
+        /** @brief Loads the rules that apply to a folder from the folders above it.
+            @details If the folder is in a git repository, then the repository's
+                @c .git/info/exclude file and the ignore files from the repository's root
+                down to (but not including) @c folder are loaded.
+            @param folder The folder being walked.
+            @returns The rules from the folders above @c folder (or null if there are none),
+                and the path of @c folder relative to the repository's root
+                (or empty if it isn't in a repository).*/
+        [[nodiscard]]
+        static std::pair<std::shared_ptr<const ignore_rules>, std::wstring>
+        load_parent_folders(const std::filesystem::path& folder);
+
+        /** @returns @c true if a file or folder is ignored.
+            @param relativePath The path, relative to the root.
+            @param isDirectory @c true if the path is a folder.*/
+        [[nodiscard]]
+        bool is_ignored(std::wstring_view relativePath, const bool isDirectory) const;
+
+        /** @returns @c true if a path matches a glob pattern.
+            @details @c * and @c ? match anything other than '/', @c [] matches a character
+                class (negated with @c ! or @c ^), and @c ** as a whole path segment
+                matches any number of folders.
+            @param pattern The glob pattern.
+            @param path The path to review.*/
+        [[nodiscard]]
+        static bool glob_match(std::wstring_view pattern, std::wstring_view path);
+
+      private:
+        /// @brief How a pattern is compared against a path.
+        enum class match_type
+            {
+            /// @brief No wildcards, so the path is compared against the pattern.
+            literal,
+            /// @brief A @c * followed by a literal (e.g., <tt>*.o</tt>),
+            ///     so the path only needs to end with the literal.
+            suffix,
+            /// @brief Anything else, which needs glob_match().
+            glob
+            };
+
+        struct pattern
+            {
+            std::wstring m_pattern;
+            match_type m_matchType{ match_type::glob };
+            /// @brief Ignores matching paths, or re-includes them if negated
+            ///     (i.e., a pattern starting with '!').
+            bool m_negated{ false };
+            /// @brief Only matches folders (i.e., a pattern ending with '/').
+            bool m_directoryOnly{ false };
+            /// @brief Matches the path relative to the ignore file's folder,
+            ///     rather than just the file or folder name
+            ///     (i.e., a pattern with a '/' at the start or middle).
+            bool m_anchored{ false };
+            };
+
+        [[nodiscard]]
+        static bool matches(const pattern& pat, std::wstring_view path);
+
+        std::vector<pattern> m_patterns;
+        std::wstring m_basePath;
+        std::shared_ptr<const ignore_rules> m_parent;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif // IGNORE_RULES_H
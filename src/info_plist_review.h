@@ -52,6 +52,15 @@ namespace i18n_check
             m_noLocalizationBundles.clear();
             }
 
+        /// @brief Removes the results from a file.
+        /// @param file The file to remove the results for.
+        void clear_file_results(const std::filesystem::path& file) final
+            {
+            i18n_review::clear_file_results(file);
+            std::erase_if(m_noLocalizationBundles,
+                          [&file](const auto& str) { return str.m_file_name == file; });
+            }
+
       private:
         std::vector<string_info> m_noLocalizationBundles;
         };
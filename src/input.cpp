@@ -13,8 +13,32 @@
 
 #include "input.h"
 #include "i18n_review.h"
+#include "ignore_rules.h"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <future>
 #include <iostream>
-#include <unordered_set>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+namespace
+    {
+    //------------------------------------------------------
+    /// @returns The canonical form of a full path that is compared against,
+    ///     which removes any trailing separator so that "dir/" and "dir" match.
+    std::filesystem::path::string_type canonical_key(const std::filesystem::path& path)
+        {
+        std::filesystem::path canonicalPath{ std::filesystem::weakly_canonical(path) };
+        if (!canonicalPath.has_filename() && canonicalPath.has_relative_path())
+            {
+            canonicalPath = canonicalPath.parent_path();
+            }
+        return canonicalPath.native();
+        }
+    } // namespace
 
 namespace i18n_check
     {
@@ -51,17 +75,8 @@ namespace i18n_check
                     {
                     if (std::filesystem::is_directory(excItem))
                         {
+                        // (its subfolders are skipped along with it when files are gathered)
                         excResults.m_excludedPaths.push_back(excItem);
-                        const auto folderToRecurse{ excResults.m_excludedPaths.back() };
-                        // add subdirectories
-                        for (const auto& p :
-                             std::filesystem::recursive_directory_iterator(folderToRecurse))
-                            {
-                            if (std::filesystem::exists(p) && p.is_directory())
-                                {
-                                excResults.m_excludedPaths.push_back(p.path());
-                                }
-                            }
                         }
                     else
                         {
@@ -75,16 +90,6 @@ namespace i18n_check
                     if (std::filesystem::is_directory(relPath))
                         {
                         excResults.m_excludedPaths.push_back(relPath);
-                        const auto folderToRecurse{ excResults.m_excludedPaths.back() };
-                        // add subdirectories
-                        for (const auto& p :
-                             std::filesystem::recursive_directory_iterator(folderToRecurse))
-                            {
-                            if (std::filesystem::exists(p) && p.is_directory())
-                                {
-                                excResults.m_excludedPaths.push_back(p.path());
-                                }
-                            }
                         }
                     else
                         {
@@ -106,23 +111,14 @@ namespace i18n_check
         }
 
     //------------------------------------------------------
-    std::vector<std::filesystem::path>
-    get_files_to_analyze(const std::filesystem::path& inputFolder,
-                         const std::vector<std::filesystem::path>& excludedPaths,
-                         const std::vector<std::filesystem::path>& excludedFiles)
+    input_filter::input_filter(std::filesystem::path inputFolder,
+                               const std::vector<std::filesystem::path>& excludedPaths,
+                               const std::vector<std::filesystem::path>& excludedFiles,
+                               const bool respectIgnoreFiles /*= false*/)
+        : m_inputFolder(std::move(inputFolder)), m_respectIgnoreFiles(respectIgnoreFiles)
         {
-        std::vector<std::filesystem::path> filesToAnalyze;
-        // wouldn't make sense to analyze anything in these folders
-        static const std::unordered_set<std::wstring> defaultIgnoredDirs{
-            L".vs",     L".git",   L".gitmodules", L".gitworktree", L".cache",
-            L".clangd", L".cmake", L".gradle",     L".quarto",      L".github",
-            L".vscode", L".idea",  L".svn"
-        };
-
-        std::vector<std::filesystem::path> excludedDirsAbs;
-        excludedDirsAbs.reserve(excludedPaths.size());
-        std::unordered_set<std::wstring> excludedDirNames;
-        excludedDirNames.reserve(excludedPaths.size());
+        m_excludedDirsAbs.reserve(excludedPaths.size());
+        m_excludedDirNames.reserve(excludedPaths.size());
 
         for (const auto& ePath : excludedPaths)
             {
@@ -130,20 +126,19 @@ namespace i18n_check
 
             if (!p.has_parent_path())
                 {
-                excludedDirNames.insert(p.filename().wstring());
+                m_excludedDirNames.insert(p.filename().wstring());
                 continue;
                 }
 
             if (p.is_relative())
                 {
-                p = inputFolder / p;
+                p = m_inputFolder / p;
                 }
 
-            excludedDirsAbs.push_back(std::filesystem::weakly_canonical(p));
+            m_excludedDirsAbs.insert(canonical_key(p));
             }
 
-        std::vector<std::filesystem::path> excludedFilesAbs;
-        excludedFilesAbs.reserve(excludedFiles.size());
+        m_excludedFilesAbs.reserve(excludedFiles.size());
 
         for (const auto& eFile : excludedFiles)
             {
@@ -151,11 +146,187 @@ namespace i18n_check
 
             if (p.is_relative())
                 {
-                p = inputFolder / p;
+                p = m_inputFolder / p;
+                }
+
+            m_excludedFilesAbs.insert(canonical_key(p));
+            }
+
+        // Directory symlinks aren't followed, so the canonical path of anything found
+        // is its folder's canonical path and its name. Only symlinks themselves need
+        // to be resolved, and only if there are full paths to compare against.
+        m_comparePaths = (!m_excludedDirsAbs.empty() || !m_excludedFilesAbs.empty());
+        }
+
+    //------------------------------------------------------
+    input_filter::folder input_filter::get_root_folder() const
+        {
+        folder rootFolder{ m_inputFolder,
+                           m_comparePaths ? std::filesystem::path{ canonical_key(m_inputFolder) } :
+                                            std::filesystem::path{},
+                           std::wstring{}, nullptr };
+        if (m_respectIgnoreFiles)
+            {
+            std::tie(rootFolder.m_ignoreRules, rootFolder.m_relativePath) =
+                ignore_rules::load_parent_folders(m_inputFolder);
+            }
+        return rootFolder;
+        }
+
+    //------------------------------------------------------
+    void input_filter::load_ignore_files(folder& dir) const
+        {
+        if (m_respectIgnoreFiles)
+            {
+            dir.m_ignoreRules = ignore_rules::load_folder(dir.m_path, dir.m_relativePath,
+                                                          std::move(dir.m_ignoreRules));
+            }
+        }
+
+    //------------------------------------------------------
+    std::optional<input_filter::folder>
+    input_filter::get_subfolder(const folder& parent,
+                                const std::filesystem::directory_entry& entry) const
+        {
+        // wouldn't make sense to analyze anything in these folders
+        static const std::unordered_set<std::wstring> defaultIgnoredDirs{
+            L".vs",     L".git",   L".gitmodules", L".gitworktree", L".cache",
+            L".clangd", L".cmake", L".gradle",     L".quarto",      L".github",
+            L".vscode", L".idea",  L".svn"
+        };
+
+        const std::wstring dirName = entry.path().filename().wstring();
+        if (defaultIgnoredDirs.contains(dirName) || m_excludedDirNames.contains(dirName))
+            {
+            return std::nullopt;
+            }
+        std::filesystem::path curDir;
+        if (m_comparePaths)
+            {
+            curDir = get_canonical_path(parent, entry);
+            if (m_excludedDirsAbs.contains(curDir.native()))
+                {
+                return std::nullopt;
                 }
+            }
+        std::wstring curRelativeDir;
+        if (parent.m_ignoreRules != nullptr)
+            {
+            curRelativeDir = get_relative_path(parent, dirName);
+            if (parent.m_ignoreRules->is_ignored(curRelativeDir, true))
+                {
+                return std::nullopt;
+                }
+            }
+        return folder{ entry.path(), std::move(curDir), std::move(curRelativeDir),
+                       parent.m_ignoreRules };
+        }
+
+    //------------------------------------------------------
+    bool input_filter::is_file_included(const folder& parent,
+                                        const std::filesystem::directory_entry& entry) const
+        {
+        static const std::unordered_set<std::wstring> supportedExtensions{
+            L".rc", L".plist", L".qmd", L".c",   L".cs", L".cpp",
+            L".h",  L".hpp",   L".po",  L".pot", L".mo"
+        };
+        static const std::unordered_set<std::wstring> ignoredFileNames{
+            // CMake build files
+            L"CMakeCXXCompilerId.cpp", L"CMakeCCompilerId.c",
+            // main catch2 files
+            L"catch.hpp", L"catch_amalgamated.cpp", L"catch_amalgamated.hpp"
+        };
 
-            excludedFilesAbs.push_back(std::filesystem::weakly_canonical(p));
+        if (!supportedExtensions.contains(entry.path().extension().wstring()))
+            {
+            return false;
             }
+        const std::wstring fileName = entry.path().filename().wstring();
+        return !(ignoredFileNames.contains(fileName) ||
+                 // ignore pseudo-translated message catalogs
+                 fileName.starts_with(L"pseudo_") ||
+                 (!m_excludedFilesAbs.empty() &&
+                  m_excludedFilesAbs.contains(get_canonical_path(parent, entry).native())) ||
+                 (parent.m_ignoreRules != nullptr &&
+                  parent.m_ignoreRules->is_ignored(get_relative_path(parent, fileName), false)));
+        }
+
+    //------------------------------------------------------
+    bool input_filter::is_path_included(const std::filesystem::path& file) const
+        {
+        const std::filesystem::path fullPath{
+            (file.is_relative() ? m_inputFolder / file : file).lexically_normal()
+        };
+        if (!fullPath.has_filename())
+            {
+            return false;
+            }
+
+        // (the entries below are made without an error code, which would fail on a missing file)
+        std::error_code fileError;
+        const std::filesystem::path relativePath{ fullPath.lexically_relative(m_inputFolder) };
+        if (relativePath.empty() || *relativePath.begin() == L".." ||
+            std::filesystem::is_regular_file(m_inputFolder, fileError))
+            {
+            // files outside of the input folder are only checked against the exclusions
+            // that aren't relative to it
+            const std::filesystem::path parentPath{ fullPath.parent_path() };
+            const folder parent{ parentPath,
+                                 m_comparePaths ?
+                                     std::filesystem::path{ canonical_key(parentPath) } :
+                                     std::filesystem::path{},
+                                 std::wstring{}, nullptr };
+            return is_file_included(parent, std::filesystem::directory_entry{ fullPath });
+            }
+
+        // walk down to the file's folder, the same as when gathering the files
+        folder current{ get_root_folder() };
+        for (const auto& subfolderName : relativePath.parent_path())
+            {
+            load_ignore_files(current);
+            auto subfolder = get_subfolder(
+                current, std::filesystem::directory_entry{ current.m_path / subfolderName });
+            if (!subfolder.has_value())
+                {
+                return false;
+                }
+            current = std::move(subfolder.value());
+            }
+        load_ignore_files(current);
+        return is_file_included(current, std::filesystem::directory_entry{ fullPath });
+        }
+
+    //------------------------------------------------------
+    std::filesystem::path
+    input_filter::get_canonical_path(const folder& parent,
+                                     const std::filesystem::directory_entry& entry)
+        {
+        return entry.is_symlink() ? std::filesystem::path{ canonical_key(entry.path()) } :
+                                    parent.m_canonicalPath / entry.path().filename();
+        }
+
+    //------------------------------------------------------
+    std::wstring input_filter::get_relative_path(const folder& parent, const std::wstring& name)
+        {
+        return parent.m_relativePath.empty() ? name : parent.m_relativePath + L'/' + name;
+        }
+
+    //------------------------------------------------------
+    std::vector<std::filesystem::path>
+    get_files_to_analyze(const std::filesystem::path& inputFolder,
+                         const std::vector<std::filesystem::path>& excludedPaths,
+                         const std::vector<std::filesystem::path>& excludedFiles,
+                         const bool respectIgnoreFiles /*= false*/)
+        {
+        return get_files_to_analyze(
+            input_filter{ inputFolder, excludedPaths, excludedFiles, respectIgnoreFiles });
+        }
+
+    //------------------------------------------------------
+    std::vector<std::filesystem::path> get_files_to_analyze(const input_filter& filter)
+        {
+        std::vector<std::filesystem::path> filesToAnalyze;
+        const std::filesystem::path& inputFolder{ filter.get_input_folder() };
 
         if (std::filesystem::exists(inputFolder) && std::filesystem::is_regular_file(inputFolder))
             {
@@ -163,83 +334,160 @@ namespace i18n_check
             }
         else if (std::filesystem::exists(inputFolder) && std::filesystem::is_directory(inputFolder))
             {
-            for (std::filesystem::recursive_directory_iterator
-                     it(inputFolder, std::filesystem::directory_options::skip_permission_denied),
-                 end;
-                 it != end; ++it)
-                {
-                const std::filesystem::directory_entry& p = *it;
+            std::vector<input_filter::folder> foldersToWalk{ filter.get_root_folder() };
+            // folders queued or being walked
+            size_t foldersPending{ 1 };
+            std::mutex walkMutex;
+            std::condition_variable walkCondition;
+            // the first failure (other than a folder or file that can't be read)
+            std::exception_ptr walkException;
 
-                // prune excluded directories immediately
-                if (p.is_directory())
+            // each worker takes a folder from the queue, lists it, and queues its subfolders
+            const auto walkFolders = [&]()
+            {
+                std::vector<std::filesystem::path> foundFiles;
+                std::vector<std::wstring> errors;
+                while (true)
                     {
-                    const std::wstring dirName = p.path().filename().wstring();
-                    bool excludeDir =
-                        defaultIgnoredDirs.contains(dirName) || excludedDirNames.contains(dirName);
-
-                    if (!excludeDir)
+                    input_filter::folder folder;
+                        {
+                        std::unique_lock lock(walkMutex);
+                        walkCondition.wait(lock,
+                                           [&foldersToWalk, &foldersPending]() {
+                                               return !foldersToWalk.empty() ||
+                                                      foldersPending == 0;
+                                           });
+                        if (foldersToWalk.empty())
+                            {
+                            break;
+                            }
+                        folder = std::move(foldersToWalk.back());
+                        foldersToWalk.pop_back();
+                        }
+                    std::vector<input_filter::folder> subfolders;
+                    try
                         {
-                        const std::filesystem::path curDir =
-                            std::filesystem::weakly_canonical(p.path());
+                        filter.load_ignore_files(folder);
 
-                        for (const auto& excDir : excludedDirsAbs)
+                        std::error_code walkError;
+                        for (std::filesystem::directory_iterator
+                                 it(folder.m_path,
+                                    std::filesystem::directory_options::skip_permission_denied,
+                                    walkError),
+                             end;
+                             !walkError && it != end; it.increment(walkError))
                             {
-                            if (curDir == excDir)
+                            const std::filesystem::directory_entry& p = *it;
+                            try
                                 {
-                                excludeDir = true;
-                                break;
+                                std::error_code entryError;
+                                // prune excluded directories immediately
+                                if (p.is_directory(entryError))
+                                    {
+                                    if (auto subfolder = filter.get_subfolder(folder, p);
+                                        subfolder.has_value() && !p.is_symlink(entryError))
+                                        {
+                                        subfolders.push_back(std::move(subfolder.value()));
+                                        }
+                                    continue;
+                                    }
+
+                                if (p.is_regular_file(entryError) &&
+                                    filter.is_file_included(folder, p))
+                                    {
+                                    foundFiles.push_back(p.path());
+                                    }
+                                }
+                            catch (const std::exception& expt)
+                                {
+                                errors.push_back(
+                                    i18n_string_util::lazy_string_to_wstring(expt.what()));
                                 }
                             }
+                        if (walkError)
+                            {
+                            errors.push_back(
+                                i18n_string_util::lazy_string_to_wstring(walkError.message()) +
+                                L": " + folder.m_path.wstring());
+                            }
                         }
-
-                    if (excludeDir)
+                    catch (...)
                         {
-                        // skip this directory entirely
-                        it.disable_recursion_pending();
-                        continue;
+                        // still finish this folder below (so that the other workers aren't left
+                        // waiting for it) and rethrow after all the workers are done
+                        const std::lock_guard lock(walkMutex);
+                        if (walkException == nullptr)
+                            {
+                            walkException = std::current_exception();
+                            }
+                        subfolders.clear();
                         }
-                    }
-                const auto ext = p.path().extension();
-                bool inExcludedPath{ false };
-                try
-                    {
-                    if (p.is_regular_file())
-                        {
-                        const std::filesystem::path curFile =
-                            std::filesystem::weakly_canonical(p.path());
 
-                        for (const auto& excFile : excludedFilesAbs)
+                    bool walkFinished{ false };
+                    size_t subfoldersQueued{ 0 };
+                        {
+                        const std::lock_guard lock(walkMutex);
+                        if (walkException == nullptr)
                             {
-                            if (curFile == excFile)
+                            try
                                 {
-                                inExcludedPath = true;
-                                break;
+                                foldersToWalk.insert(foldersToWalk.end(),
+                                                     std::make_move_iterator(subfolders.begin()),
+                                                     std::make_move_iterator(subfolders.end()));
+                                subfoldersQueued = subfolders.size();
                                 }
+                            catch (...)
+                                {
+                                walkException = std::current_exception();
+                                }
+                            }
+                        foldersPending += subfoldersQueued;
+                        --foldersPending;
+                        // if anything failed, then abandon the rest of the walk
+                        if (walkException != nullptr)
+                            {
+                            foldersPending -= foldersToWalk.size();
+                            foldersToWalk.clear();
                             }
+                        walkFinished = (foldersPending == 0);
                         }
-
-                    if (p.is_regular_file() && !inExcludedPath &&
-                        (ext == L".rc" || ext == L".plist" || ext == L".qmd" || ext == L".c" ||
-                         ext == L".cs" || ext == L".cpp" || ext == L".h" || ext == L".hpp" ||
-                         ext == L".po" || ext == L".pot") &&
-                        // ignore CMake build files
-                        p.path().filename() != L"CMakeCXXCompilerId.cpp" &&
-                        p.path().filename() != L"CMakeCCompilerId.c" &&
-                        // main catch2 files
-                        p.path().filename() != L"catch.hpp" &&
-                        p.path().filename() != L"catch_amalgamated.cpp" &&
-                        p.path().filename() != L"catch_amalgamated.hpp" &&
-                        // ignore pseudo-translated message catalogs
-                        !p.path().filename().wstring().starts_with(L"pseudo_"))
+                    if (walkFinished || subfoldersQueued > 1)
                         {
-                        filesToAnalyze.push_back(p.path());
+                        walkCondition.notify_all();
+                        }
+                    else if (subfoldersQueued == 1)
+                        {
+                        walkCondition.notify_one();
                         }
                     }
-                catch (const std::exception& expt)
+                return std::make_pair(std::move(foundFiles), std::move(errors));
+            };
+
+            std::vector<std::future<
+                std::pair<std::vector<std::filesystem::path>, std::vector<std::wstring>>>>
+                walkers;
+            const size_t walkerCount{ std::max<size_t>(1, std::thread::hardware_concurrency()) };
+            for (size_t i = 0; i < walkerCount; ++i)
+                {
+                walkers.push_back(std::async(std::launch::async, walkFolders));
+                }
+            for (auto& walker : walkers)
+                {
+                auto [foundFiles, errors] = walker.get();
+                filesToAnalyze.insert(filesToAnalyze.end(),
+                                      std::make_move_iterator(foundFiles.begin()),
+                                      std::make_move_iterator(foundFiles.end()));
+                for (const auto& error : errors)
                     {
-                    std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+                    std::wcout << error << L"\n";
                     }
                 }
+            if (walkException != nullptr)
+                {
+                std::rethrow_exception(walkException);
+                }
+            // folders are walked in parallel, so sort to keep the results in a consistent order
+            std::sort(filesToAnalyze.begin(), filesToAnalyze.end());
             }
 
         return filesToAnalyze;
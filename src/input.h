@@ -18,7 +18,12 @@
 #ifndef I18N_INPUTS_H
 #define I18N_INPUTS_H
 
+#include "ignore_rules.h"
 #include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace i18n_check
@@ -33,24 +38,138 @@ namespace i18n_check
         @param inputFolder The root folder being analyzed.
         @param excluded The list of excluded files and folder.
             This can be full paths, relative paths, folder names, filenames, etc.
-        @returns The fully-expanded paths for folders and files to exclude.*/
+        @returns The fully-expanded paths for folders and files to exclude.\n
+            Subfolders of excluded folders aren't included, as get_files_to_analyze()
+            skips them along with their parent.*/
     [[nodiscard]]
     excluded_results get_paths_files_to_exclude(const std::filesystem::path& inputFolder,
                                                 const std::vector<std::filesystem::path>& excluded);
 
+    /** @brief Decides which folders and files under an input folder are analyzed.
+        @details This is used by get_files_to_analyze(), and for anything else that needs to
+            know whether a folder or file under the input folder would be analyzed
+            (e.g., when watching it for changes).*/
+    class input_filter
+        {
+      public:
+        /// @brief A folder under the input folder, along with what's needed
+        ///     to filter its files and subfolders.
+        struct folder
+            {
+            std::filesystem::path m_path;
+            /// @brief The canonical path (only if there are full paths to compare against).
+            std::filesystem::path m_canonicalPath;
+            /// @brief The path relative to the root that ignore files' patterns
+            ///     are compared against.
+            std::wstring m_relativePath;
+            /// @brief The ignore rules from the folders above this one
+            ///     (or including this one, after load_ignore_files()).
+            std::shared_ptr<const ignore_rules> m_ignoreRules;
+            };
+
+        /** @brief Constructor.
+            @param inputFolder The root folder to scan.
+            @param excludedPaths Folders that should be ignored (along with their subfolders).
+                These should be full paths or folder names.
+            @param excludedFiles Files that should be ignored. These should be full paths,
+                not filenames.
+            @param respectIgnoreFiles Whether to skip files and folders that are ignored by
+                @c .gitignore and @c .ignore files (including the ones in the folders above
+                @c inputFolder, up to its git repository's root).*/
+        input_filter(std::filesystem::path inputFolder,
+                     const std::vector<std::filesystem::path>& excludedPaths,
+                     const std::vector<std::filesystem::path>& excludedFiles,
+                     const bool respectIgnoreFiles = false);
+
+        /// @returns The root folder to scan.
+        [[nodiscard]]
+        const std::filesystem::path& get_input_folder() const noexcept
+            {
+            return m_inputFolder;
+            }
+
+        /// @returns @c true if files and folders ignored by @c .gitignore and @c .ignore
+        ///     files are skipped.
+        [[nodiscard]]
+        bool is_respecting_ignore_files() const noexcept
+            {
+            return m_respectIgnoreFiles;
+            }
+
+        /// @returns The input folder (which should be a folder), with the ignore rules
+        ///     from the folders above it.
+        [[nodiscard]]
+        folder get_root_folder() const;
+
+        /** @brief Loads a folder's own ignore files (if respecting them),
+                which should be done before reviewing its files and subfolders.
+            @param[in,out] dir The folder.*/
+        void load_ignore_files(folder& dir) const;
+
+        /** @returns The subfolder to walk, or @c std::nullopt if it is excluded.
+            @param parent The folder that the subfolder is in.
+            @param entry The subfolder.*/
+        [[nodiscard]]
+        std::optional<folder> get_subfolder(const folder& parent,
+                                            const std::filesystem::directory_entry& entry) const;
+
+        /** @returns @c true if a file (by its name and path) would be analyzed.
+            @param parent The folder that the file is in.
+            @param entry The file.*/
+        [[nodiscard]]
+        bool is_file_included(const folder& parent,
+                              const std::filesystem::directory_entry& entry) const;
+
+        /** @returns @c true if a file would be analyzed, going by its path alone
+                (the file doesn't need to exist, e.g., for unsaved editor buffers).
+            @details The folders between the input folder and the file are checked
+                the same way as when gathering the files.
+            @param file The file. A relative path is relative to the input folder.
+            @throws std::filesystem::filesystem_error If a folder's status can't be read.*/
+        [[nodiscard]]
+        bool is_path_included(const std::filesystem::path& file) const;
+
+      private:
+        [[nodiscard]]
+        static std::filesystem::path
+        get_canonical_path(const folder& parent, const std::filesystem::directory_entry& entry);
+        [[nodiscard]]
+        static std::wstring get_relative_path(const folder& parent, const std::wstring& name);
+
+        std::filesystem::path m_inputFolder;
+        // full paths are hashed by their canonical form
+        std::unordered_set<std::filesystem::path::string_type> m_excludedDirsAbs;
+        std::unordered_set<std::wstring> m_excludedDirNames;
+        std::unordered_set<std::filesystem::path::string_type> m_excludedFilesAbs;
+        bool m_comparePaths{ false };
+        bool m_respectIgnoreFiles{ false };
+        };
+
     /** @brief Retrieves a list of files to analyze from a root folder, excluding any files and
        paths that were requested to be ignored.
         @param inputFolder The root folder to scan.
-        @param excludedPaths Folders that should be ignored.
+        @param excludedPaths Folders that should be ignored (along with their subfolders).
             These should be full paths, not folder names.
         @param excludedFiles Files that should be ignored. These should be full paths, not
        filenames.
-        @returns A list of files that can be analyzed.*/
+        @param respectIgnoreFiles Whether to skip files and folders that are ignored by
+            @c .gitignore and @c .ignore files (including the ones in the folders above
+            @c inputFolder, up to its git repository's root).
+        @returns A list of files that can be analyzed, sorted by path.
+        @note Folders are walked in parallel.*/
     [[nodiscard]]
     std::vector<std::filesystem::path>
     get_files_to_analyze(const std::filesystem::path& inputFolder,
                          const std::vector<std::filesystem::path>& excludedPaths,
-                         const std::vector<std::filesystem::path>& excludedFiles);
+                         const std::vector<std::filesystem::path>& excludedFiles,
+                         const bool respectIgnoreFiles = false);
+
+    /** @brief Retrieves a list of files to analyze from a root folder.
+        @param filter The root folder and what to exclude from it.
+        @returns A list of files that can be analyzed, sorted by path.
+        @note Folders are walked in parallel.*/
+    [[nodiscard]]
+    std::vector<std::filesystem::path> get_files_to_analyze(const input_filter& filter);
     } // namespace i18n_check
 
 /** @}*/
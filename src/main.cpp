@@ -12,11 +12,18 @@
  ********************************************************************************/
 
 #include "analyze.h"
+#include "analyze_server.h"
+#include "analyze_watcher.h"
 #include "cxxopts/include/cxxopts.hpp"
 #include "input.h"
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <sstream>
+#ifdef _WIN32
+    #include <fcntl.h>
+    #include <io.h>
+#endif
 
 namespace fs = std::filesystem;
 
@@ -56,11 +63,40 @@ int main(int argc, char* argv[])
         ("cpp-version",
          "The C++ standard that should be assumed when issuing deprecated macro warnings.",
          cxxopts::value<int>())
+        ("dup-ids-across-files",
+         "Whether to check for ID values assigned to multiple ID variables across all files, "
+         "rather than within each file. (Default is false.)",
+         cxxopts::value<bool>()->default_value("false"))
         ("fuzzy",
          "Whether to review fuzzy translations. (Default is false.)",
          cxxopts::value<bool>()->default_value("false"))
+        ("stream",
+         "Whether to write the results for PO catalogs as they are reviewed, rather than "
+         "keeping all catalogs in memory until the end. (Default is false.)",
+         cxxopts::value<bool>()->default_value("false"))
+        ("group-by-message",
+         "Whether to group the results for translation catalogs by message, reporting each "
+         "source string issue once rather than once per catalog. (Default is false.)",
+         cxxopts::value<bool>()->default_value("false"))
         ("i,ignore", "Folders and files to ignore (can be used multiple times)",
                                cxxopts::value<std::vector<std::string>>())
+        ("serve",
+         "Listen for analysis requests on this Unix domain socket, keeping the analyzers and "
+         "the list of files loaded between requests.",
+         cxxopts::value<std::string>())
+        ("stdin-files",
+         "Whether to analyze file records read from standard input, rather than the files in "
+         "an input folder. Each record is the file's path on one line, the length of its "
+         "content in bytes on the next line, and then the content. (Default is false.)",
+         cxxopts::value<bool>()->default_value("false"))
+        ("watch",
+         "Whether to keep watching the input folder after the analysis, re-analyzing files as "
+         "they change and reporting the new and resolved issues. (Default is false.)",
+         cxxopts::value<bool>()->default_value("false"))
+        ("respect-gitignore",
+         "Whether to skip files and folders listed in .gitignore and .ignore files. "
+         "(Default is false.)",
+         cxxopts::value<bool>()->default_value("false"))
         ("u,untranslatables", "Comma-separated words that should not be translated. "
                               "(If including phrases with spaces, "
                               "put entire argument in double quotes.)",
@@ -116,6 +152,9 @@ int main(int argc, char* argv[])
         return defaultValue;
     };
 
+    // files can be read from stdin rather than an input folder (e.g., staged files in a git hook)
+    const bool readStdinFiles{ readBoolOption("stdin-files", false) };
+
     fs::path inputFolder;
     if (result.count("input") != 0)
         {
@@ -129,6 +168,12 @@ int main(int argc, char* argv[])
             inputFolder.is_relative() ? std::filesystem::current_path() / inputFolder :
                                         inputFolder);
         }
+    else if (readStdinFiles)
+        {
+        // the records' paths (and any relative paths being ignored) are relative
+        // to the current folder
+        inputFolder = std::filesystem::current_path();
+        }
     else
         {
         std::wcout << L"You must pass in at least one folder to analyze.\n\n";
@@ -143,7 +188,10 @@ int main(int argc, char* argv[])
                    << L":\n# Internationalization/localization analysis system\n# (c) 2021-2026 "
                       L"Blake Madden\n"
                    << L"###################################################\n\n";
-        std::wcout << L"Searching for files to analyze in " << inputFolder << L"...\n\n";
+        if (!readStdinFiles)
+            {
+            std::wcout << L"Searching for files to analyze in " << inputFolder << L"...\n\n";
+            }
         }
 
     const std::vector<std::string> providedIgnoredPaths{
@@ -162,8 +210,12 @@ int main(int argc, char* argv[])
         i18n_check::get_paths_files_to_exclude(inputFolder, providedIgnoredPathsWidened);
 
     // input folder
-    const auto filesToAnalyze = i18n_check::get_files_to_analyze(
-        inputFolder, excludedInfo.m_excludedPaths, excludedInfo.m_excludedFiles);
+    const i18n_check::input_filter inputFilter(inputFolder, excludedInfo.m_excludedPaths,
+                                               excludedInfo.m_excludedFiles,
+                                               readBoolOption("respect-gitignore", false));
+    const auto gatherFiles = [&inputFilter]()
+    { return i18n_check::get_files_to_analyze(inputFilter); };
+    const auto filesToAnalyze = readStdinFiles ? std::vector<fs::path>{} : gatherFiles();
 
     const std::vector<std::string> untranslatableNames{
         (result["untranslatables"].count() > 0) ?
@@ -186,6 +238,7 @@ int main(int argc, char* argv[])
         parser.set_min_words_for_classifying_unavailable_string(
             readIntOption("min-l10n-wordcount", 2));
         parser.set_min_cpp_version(readIntOption("cpp-version", 2014));
+        parser.review_duplicate_ids_across_files(readBoolOption("dup-ids-across-files", false));
     };
 
     i18n_check::cpp_i18n_review cpp(readBoolOption("verbose", false));
@@ -199,6 +252,8 @@ int main(int argc, char* argv[])
     i18n_check::po_file_review po(readBoolOption("verbose", false));
     po.review_fuzzy_translations(readBoolOption("fuzzy", false));
 
+    i18n_check::mo_file_review mo(readBoolOption("verbose", false));
+
     i18n_check::info_plist_file_review infoPlist(readBoolOption("verbose", false));
     i18n_check::quarto_review quartoReview;
 
@@ -356,6 +411,7 @@ int main(int argc, char* argv[])
         cpp.set_style(static_cast<i18n_check::review_style>(rs));
         csharp.set_style(static_cast<i18n_check::review_style>(rs));
         po.set_style(static_cast<i18n_check::review_style>(rs));
+        mo.set_style(static_cast<i18n_check::review_style>(rs));
         rc.set_style(static_cast<i18n_check::review_style>(rs));
         }
     // ...and if any checks are being excluded
@@ -512,56 +568,121 @@ int main(int argc, char* argv[])
         cpp.set_style(static_cast<i18n_check::review_style>(rs));
         csharp.set_style(static_cast<i18n_check::review_style>(rs));
         po.set_style(static_cast<i18n_check::review_style>(rs));
+        mo.set_style(static_cast<i18n_check::review_style>(rs));
         rc.set_style(static_cast<i18n_check::review_style>(rs));
         }
 
-    const bool isQuiet{ readBoolOption("quiet", false) };
-    i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &csharp, &infoPlist, &quartoReview);
-    analyzer.analyze(
-        filesToAnalyze, [](const size_t) {},
-        [&filesToAnalyze, isQuiet](const size_t currentFileIndex, const fs::path& file)
+    // write the output to file (if requested)...
+    std::ofstream ofs;
+    bool writeCsv{ false };
+    if (result.count("output") != 0U)
         {
-            if (!isQuiet)
+        const fs::path outPath{ result["output"].as<std::string>() };
+        ofs.open(outPath);
+        writeCsv = (outPath.extension().compare(L"csv") == 0);
+        }
+    const auto writeReport = [&ofs, writeCsv](const std::wstring& resText)
+    {
+        if (ofs.is_open())
+            {
+            // write the results report in UTF-8
+            std::string utf8Str;
+            if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
                 {
-                std::wcout << L"Examining " << currentFileIndex << L" of " << filesToAnalyze.size()
-                           << L" files (" << file.filename() << L")\n";
+                utf8::utf16to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+                }
+            else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+                {
+                utf8::utf32to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
                 }
-            return true;
-        });
-
-    const std::wstringstream report = analyzer.format_results(readBoolOption("verbose", false));
 
-    // write the output to file (if requested)
-    if (result.count("output") != 0U)
-        {
-        const fs::path outPath{ result["output"].as<std::string>() };
-        std::ofstream ofs(outPath);
+            if (writeCsv)
+                {
+                string_util::replace_all<std::string>(utf8Str, "\t", ",");
+                }
 
-        // write the results report in UTF-8
-        std::string utf8Str;
-        const auto resText = report.str();
-        if constexpr (sizeof(wchar_t) == sizeof(uint16_t))
-            {
-            utf8::utf16to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+            ofs << utf8Str;
             }
-        else if constexpr (sizeof(wchar_t) == sizeof(uint32_t))
+        // ...otherwise, send it to the console
+        else
             {
-            utf8::utf32to8(resText.cbegin(), resText.cend(), std::back_inserter(utf8Str));
+            std::wcout << resText;
             }
+    };
 
-        if (outPath.extension().compare(L"csv") == 0)
+    const bool isQuiet{ readBoolOption("quiet", false) };
+    i18n_check::batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quartoReview);
+    analyzer.group_catalog_results_by_message(readBoolOption("group-by-message", false));
+
+    // keep the analyzers loaded and answer requests until told to stop
+    if (result.count("serve") != 0U)
+        {
+        const fs::path socketPath{ result["serve"].as<std::string>() };
+        if (!isQuiet)
             {
-            string_util::replace_all<std::string>(utf8Str, "\t", ",");
+            std::wcout << L"Listening for requests on " << socketPath << L" ("
+                       << filesToAnalyze.size() << L" files in the input folder)...\n";
             }
+        i18n_check::analyze_server server(analyzer, inputFilter, filesToAnalyze, gatherFiles);
+        return server.serve(socketPath) ? 0 : 1;
+        }
 
-        ofs << utf8Str;
+    // results can't be updated after they were streamed
+    // (and there is no folder to watch if the files are from stdin)
+    const bool watchForChanges{ readBoolOption("watch", false) && !readStdinFiles };
+    const bool streamResults{ readBoolOption("stream", false) && !watchForChanges };
+    if (streamResults)
+        {
+        analyzer.stream_catalog_results(writeReport);
+        }
+    // results streamed to the console are written while the files are being analyzed,
+    // so keep the progress out of them
+    std::wostream& progressStream{ (streamResults && !ofs.is_open()) ? std::wcerr : std::wcout };
+    const auto showProgress = [isQuiet, &progressStream](const size_t fileCount)
+    {
+        return [fileCount, isQuiet, &progressStream](const size_t currentFileIndex,
+                                                     const fs::path& file)
+        {
+            if (!isQuiet)
+                {
+                progressStream << L"Examining " << currentFileIndex << L" of " << fileCount
+                               << L" files (" << file.filename() << L")\n";
+                }
+            return true;
+        };
+    };
+    if (readStdinFiles)
+        {
+        // read the records as bytes, so that the content is decoded the same as a file's
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY);
+#endif
+        const std::string records{ std::istreambuf_iterator<char>(std::cin),
+                                   std::istreambuf_iterator<char>{} };
+        std::vector<i18n_check::batch_analyze::file_buffer> buffersToAnalyze;
+        try
+            {
+            buffersToAnalyze = i18n_check::batch_analyze::read_file_buffers(records);
+            // skip the files that wouldn't be analyzed if they were in the input folder
+            std::erase_if(buffersToAnalyze,
+                          [&inputFilter](const auto& buffer)
+                          { return !inputFilter.is_path_included(buffer.first); });
+            }
+        catch (const std::exception& expt)
+            {
+            std::wcout << i18n_string_util::lazy_string_to_wstring(expt.what()) << L"\n";
+            return 1;
+            }
+        analyzer.analyze_buffers(buffersToAnalyze, [](const size_t) {},
+                                 showProgress(buffersToAnalyze.size()));
         }
-    // ...otherwise, send it to the console
     else
         {
-        std::wcout << report.str();
+        analyzer.analyze(filesToAnalyze, [](const size_t) {}, showProgress(filesToAnalyze.size()));
         }
 
+    writeReport(analyzer.format_results(readBoolOption("verbose", false)).str());
+
     if (!readBoolOption("quiet", false))
         {
         const auto endTime{ std::chrono::high_resolution_clock::now() };
@@ -584,5 +705,16 @@ int main(int argc, char* argv[])
         std::wcout << analyzer.format_summary(true).str();
         }
 
+    if (watchForChanges)
+        {
+        if (!isQuiet)
+            {
+            std::wcout << L"\nWatching " << inputFolder << L" for changes...\n";
+            }
+        i18n_check::analyze_watcher watcher(analyzer, inputFilter, filesToAnalyze, gatherFiles,
+                                            writeReport, readBoolOption("verbose", false));
+        return watcher.watch() ? 0 : 1;
+        }
+
     return 0;
     }
@@ -0,0 +1,368 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "mo_file_review.h"
+#include "utfcpp/source/utf8.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#ifdef wxVERSION_NUMBER
+    #include <wx/strconv.h>
+    #include <wx/string.h>
+#endif
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace
+    {
+    /// @brief Read-only view of a file mapped into memory.
+    /// @details If the platform mapping fails, then the file is read into
+    ///     a buffer instead so that callers always get a contiguous view.
+    class mapped_file
+        {
+      public:
+        explicit mapped_file(const std::filesystem::path& filePath)
+            {
+#ifdef _WIN32
+            m_file = ::CreateFileW(filePath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                   nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (m_file != INVALID_HANDLE_VALUE)
+                {
+                LARGE_INTEGER fileSize{};
+                if (::GetFileSizeEx(m_file, &fileSize) != 0 && fileSize.QuadPart > 0)
+                    {
+                    m_mapping =
+                        ::CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if (m_mapping != nullptr)
+                        {
+                        const void* data = ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+                        if (data != nullptr)
+                            {
+                            m_view = std::string_view{ static_cast<const char*>(data),
+                                                       static_cast<size_t>(fileSize.QuadPart) };
+                            return;
+                            }
+                        }
+                    }
+                }
+#else
+            m_file = ::open(filePath.c_str(), O_RDONLY);
+            if (m_file != -1)
+                {
+                struct stat fileInfo{};
+                if (::fstat(m_file, &fileInfo) == 0 && fileInfo.st_size > 0)
+                    {
+                    void* data = ::mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ,
+                                        MAP_PRIVATE, m_file, 0);
+                    if (data != MAP_FAILED)
+                        {
+                        m_mapped = true;
+                        m_view = std::string_view{ static_cast<const char*>(data),
+                                                   static_cast<size_t>(fileInfo.st_size) };
+                        return;
+                        }
+                    }
+                }
+#endif
+            // fall back to reading the whole file
+            std::ifstream ifs(filePath, std::ios::binary);
+            if (ifs)
+                {
+                m_buffer.assign(std::istreambuf_iterator<char>(ifs),
+                                std::istreambuf_iterator<char>());
+                m_view = m_buffer;
+                }
+            }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        ~mapped_file()
+            {
+#ifdef _WIN32
+            if (m_buffer.empty() && !m_view.empty())
+                {
+                ::UnmapViewOfFile(m_view.data());
+                }
+            if (m_mapping != nullptr)
+                {
+                ::CloseHandle(m_mapping);
+                }
+            if (m_file != INVALID_HANDLE_VALUE)
+                {
+                ::CloseHandle(m_file);
+                }
+#else
+            if (m_mapped)
+                {
+                ::munmap(const_cast<char*>(m_view.data()), m_view.length());
+                }
+            if (m_file != -1)
+                {
+                ::close(m_file);
+                }
+#endif
+            }
+
+        [[nodiscard]]
+        std::string_view view() const noexcept
+            {
+            return m_view;
+            }
+
+      private:
+#ifdef _WIN32
+        HANDLE m_file{ INVALID_HANDLE_VALUE };
+        HANDLE m_mapping{ nullptr };
+#else
+        int m_file{ -1 };
+        bool m_mapped{ false };
+#endif
+        std::string m_buffer;
+        std::string_view m_view;
+        };
+    } // namespace
+
+namespace i18n_check
+    {
+    //------------------------------------------------
+    bool mo_file_review::load_file(const std::filesystem::path& fileName)
+        {
+        const mapped_file moFile(fileName);
+        return load_catalog(moFile.view(), fileName);
+        }
+
+    //------------------------------------------------
+    bool mo_file_review::load_catalog(std::string_view moData,
+                                      const std::filesystem::path& fileName)
+        {
+        m_file_name = fileName;
+        m_charset.clear();
+
+        // magic number, revision, string count, offset of original strings table,
+        // offset of translation strings table, hash table size, and hash table offset
+        constexpr size_t HEADER_SIZE{ 7 * sizeof(uint32_t) };
+        if (moData.length() < HEADER_SIZE)
+            {
+            return false;
+            }
+
+        const auto readRawUInt32 = [&moData](const size_t offset)
+        {
+            uint32_t value{ 0 };
+            std::memcpy(&value, std::next(moData.data(), static_cast<ptrdiff_t>(offset)),
+                        sizeof(uint32_t));
+            return value;
+        };
+
+        const uint32_t magic = readRawUInt32(0);
+        if (magic != MO_MAGIC && magic != MO_MAGIC_SWAPPED)
+            {
+            return false;
+            }
+        const bool needsSwap{ magic == MO_MAGIC_SWAPPED };
+        const auto readUInt32 = [&readRawUInt32, needsSwap](const size_t offset)
+        {
+            const uint32_t value = readRawUInt32(offset);
+            return needsSwap ? ((value >> 24) | ((value >> 8) & 0xFF00) |
+                                ((value << 8) & 0xFF0000) | (value << 24)) :
+                               value;
+        };
+
+        // only the major revision (upper 16 bits) affects the layout
+        if ((readUInt32(4) >> 16) > 1)
+            {
+            return false;
+            }
+        const size_t stringCount{ readUInt32(8) };
+        const size_t originalTableOffset{ readUInt32(12) };
+        const size_t translationTableOffset{ readUInt32(16) };
+
+        // each table entry is a length and offset pair
+        constexpr size_t TABLE_ENTRY_SIZE{ 2 * sizeof(uint32_t) };
+        if (stringCount > (moData.length() / TABLE_ENTRY_SIZE) ||
+            originalTableOffset > moData.length() ||
+            translationTableOffset > moData.length() ||
+            (moData.length() - originalTableOffset) < stringCount * TABLE_ENTRY_SIZE ||
+            (moData.length() - translationTableOffset) < stringCount * TABLE_ENTRY_SIZE)
+            {
+            log_message(fileName.wstring(), L"MO file's string tables are truncated.", 0);
+            return false;
+            }
+
+        // returns a view into the mapped data (without the string's NUL terminator)
+        const auto readString = [&moData, &readUInt32](const size_t tableEntryOffset,
+                                                       std::string_view& str)
+        {
+            const size_t length{ readUInt32(tableEntryOffset) };
+            const size_t offset{ readUInt32(tableEntryOffset + sizeof(uint32_t)) };
+            if (offset > moData.length() || length > moData.length() - offset)
+                {
+                return false;
+                }
+            str = moData.substr(offset, length);
+            return true;
+        };
+
+        std::shared_ptr<const plural_forms> pluralForms;
+        // problems with the plural forms are reported once, with the first plural entry
+        bool pluralFormsReviewed{ false };
+        for (size_t i = 0; i < stringCount; ++i)
+            {
+            std::string_view original;
+            std::string_view translation;
+            if (!readString(originalTableOffset + (i * TABLE_ENTRY_SIZE), original) ||
+                !readString(translationTableOffset + (i * TABLE_ENTRY_SIZE), translation))
+                {
+                log_message(fileName.wstring(), L"MO file string table entry is out of range.",
+                            i);
+                return false;
+                }
+            // the header entry (metadata about the catalog) has an empty source string
+            // (and is sorted first, so it is read before the strings that it describes)
+            if (original.empty())
+                {
+                m_charset = read_charset(translation);
+                pluralForms = load_plural_forms(decode_string(translation), L"\n");
+                continue;
+                }
+
+            // context is stored in front of the source string, separated by EOT
+            std::wstring comment;
+            if (const auto contextEnd = original.find('\x04');
+                contextEnd != std::string_view::npos)
+                {
+                comment = decode_string(original.substr(0, contextEnd));
+                original.remove_prefix(contextEnd + 1);
+                }
+
+            // plural forms are stored back-to-back, separated by NULs
+            std::string_view originalPlural;
+            std::vector<std::wstring> translationPlurals;
+            if (const auto pluralStart = original.find('\0');
+                pluralStart != std::string_view::npos)
+                {
+                originalPlural = original.substr(pluralStart + 1);
+                original = original.substr(0, pluralStart);
+                // every plural translation (i.e., msgstr[0], msgstr[1], etc.)
+                while (true)
+                    {
+                    const auto pluralEnd = translation.find('\0');
+                    translationPlurals.push_back(decode_string(translation.substr(0, pluralEnd)));
+                    if (pluralEnd == std::string_view::npos)
+                        {
+                        break;
+                        }
+                    translation.remove_prefix(pluralEnd + 1);
+                    }
+                }
+
+            std::wstring source{ decode_string(original) };
+            std::wstring errorInfo;
+            const po_format_string pofs = load_cpp_printf_commands(source, errorInfo).empty() ?
+                                              po_format_string::no_format :
+                                              po_format_string::cpp_format;
+
+            // MO files don't have line numbers, so use the entry's position in the string table
+            auto& catEntry = get_catalog_entries().emplace_back(
+                fileName,
+                translation_catalog_entry{
+                    std::move(source), decode_string(originalPlural),
+                    translationPlurals.empty() ? decode_string(translation) :
+                                                 translationPlurals.front(),
+                    (translationPlurals.size() > 1) ? translationPlurals[1] : std::wstring{},
+                    pofs, std::vector<std::pair<translation_issue, std::wstring>>{}, i, comment,
+                    std::move(translationPlurals), nullptr });
+
+            if (!catEntry.second.m_source_plural.empty())
+                {
+                catEntry.second.m_plural_forms = pluralForms;
+
+                if (!pluralFormsReviewed && pluralForms != nullptr)
+                    {
+                    review_plural_forms(*pluralForms, catEntry.second.m_issues);
+                    pluralFormsReviewed = true;
+                    }
+                }
+            }
+
+        return true;
+        }
+
+    //------------------------------------------------
+    std::string mo_file_review::read_charset(std::string_view header)
+        {
+        constexpr static std::string_view CHARSET{ "charset=" };
+        auto charsetStart = header.find(CHARSET);
+        if (charsetStart == std::string_view::npos)
+            {
+            return std::string{};
+            }
+        charsetStart += CHARSET.length();
+        const auto charsetEnd = header.find_first_of(" \t\r\n;", charsetStart);
+        return std::string{ header.substr(charsetStart, charsetEnd == std::string_view::npos ?
+                                                            std::string_view::npos :
+                                                            charsetEnd - charsetStart) };
+        }
+
+    //------------------------------------------------
+    std::wstring mo_file_review::decode_string(std::string_view str) const
+        {
+        // ASCII is a subset of UTF-8, and "CHARSET" is the placeholder in catalog templates
+        const bool isUtf8{ m_charset.empty() ||
+                           string_util::stricmp(m_charset.c_str(), "UTF-8") == 0 ||
+                           string_util::stricmp(m_charset.c_str(), "UTF8") == 0 ||
+                           string_util::stricmp(m_charset.c_str(), "ASCII") == 0 ||
+                           string_util::stricmp(m_charset.c_str(), "US-ASCII") == 0 ||
+                           string_util::stricmp(m_charset.c_str(), "CHARSET") == 0 };
+        if (isUtf8 && utf8::is_valid(str.cbegin(), str.cend()))
+            {
+            std::u16string utf16Text;
+            utf16Text.reserve(str.length());
+            utf8::utf8to16(str.cbegin(), str.cend(), std::back_inserter(utf16Text));
+            std::wstring decoded;
+            decoded.reserve(utf16Text.length());
+            for (const auto& ch : utf16Text)
+                {
+                decoded += static_cast<wchar_t>(ch);
+                }
+            return decoded;
+            }
+
+        // another character set (or malformed UTF-8)
+#ifdef wxVERSION_NUMBER
+        const wxString text(str.data(),
+                            isUtf8 ? wxCSConv{ wxFONTENCODING_ISO8859_1 } :
+                                     wxCSConv{ wxString{ m_charset } },
+                            str.length());
+        return std::wstring{ text.wc_str() };
+#else
+        std::wstring decoded;
+        decoded.reserve(str.length());
+        for (const auto& ch : str)
+            {
+            decoded += static_cast<wchar_t>(static_cast<unsigned char>(ch));
+            }
+        return decoded;
+#endif
+        }
+    } // namespace i18n_check
@@ -0,0 +1,93 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef MO_FILE_REVIEW_H
+#define MO_FILE_REVIEW_H
+
+#include "translation_catalog_review.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace i18n_check
+    {
+    /** @brief Class to extract and review translations from compiled (binary) gettext
+            MO catalogs.
+        @details The file is memory mapped and its original and translation string tables
+            are walked in place; only the strings themselves are decoded into catalog entries.\n
+            Strings are decoded using the @c charset from the catalog's header entry, and every
+            plural translation is reviewed against the header's @c Plural-Forms (as with PO files).\n
+            Because MO files do not retain flags or comments, entries whose source string
+            contains printf commands are reviewed as C format strings.*/
+    class mo_file_review : public translation_catalog_review
+        {
+      public:
+        /// @brief Constructor.
+        /// @param verbose @c true to include verbose warnings.
+        explicit mo_file_review(const bool verbose) : translation_catalog_review(verbose) {}
+
+        /** @brief Memory maps an MO file and loads its catalog entries.
+            @param fileName The path to the MO file.
+            @returns @c true if the file was mapped and is a valid MO catalog.*/
+        bool load_file(const std::filesystem::path& fileName);
+
+        /** @brief Loads catalog entries from an MO file's raw content.
+            @param moData The binary content of the MO file.
+            @param fileName The (optional) name of the file being analyzed.
+            @returns @c true if the data is a valid MO catalog.*/
+        bool load_catalog(std::string_view moData, const std::filesystem::path& fileName);
+
+        /** @brief Finalizes the review process after all files have been loaded.
+            @details Reviews the catalogs in all loaded MO files.
+            @param resetCallback Callback function to tell the progress system in @c callback
+                how many items to expect to be processed.
+            @param callback Callback function to display the progress.
+                Takes the current file index, overall file count, and the name of the current file.
+                Returning @c false indicates that the user cancelled the analysis.*/
+        void review_strings(const analyze_callback_reset& resetCallback,
+                            const analyze_callback& callback) final
+            {
+            translation_catalog_review::review_strings(resetCallback, callback);
+            }
+
+        /// @brief Magic number at the start of an MO file (in the file's byte order).
+        constexpr static uint32_t MO_MAGIC{ 0x950412DE };
+        /// @brief Magic number of an MO file written in the opposite byte order.
+        constexpr static uint32_t MO_MAGIC_SWAPPED{ 0xDE120495 };
+
+      private:
+        /** @brief Reads the character set from a catalog's header
+                (e.g., <tt>Content-Type: text/plain; charset=UTF-8</tt>).
+            @param header The header entry's (undecoded) translation.
+            @returns The character set, or an empty string if the header doesn't specify one.*/
+        [[nodiscard]]
+        static std::string read_charset(std::string_view header);
+
+        /** @brief Converts a string from the catalog into a wide string.
+            @details Catalogs are UTF-8 unless their header specifies another character set.
+            @param str The string to decode.
+            @returns The decoded string.*/
+        [[nodiscard]]
+        std::wstring decode_string(std::string_view str) const;
+
+        std::string m_charset;
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif // MO_FILE_REVIEW_H
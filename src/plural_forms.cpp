@@ -0,0 +1,594 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+#include "plural_forms.h"
+#include <algorithm>
+
+namespace i18n_check
+    {
+    /// @private
+    /// @brief Recursive descent compiler for the C subset used by plural expressions.
+    /// @details From lowest to highest precedence, this supports @c ?:, @c ||, @c &&,
+    ///     @c == and @c !=, @c < @c <= @c > and @c >=, @c + and @c -, @c * @c / and @c %,
+    ///     and @c !, along with parentheses, @c n, and decimal numbers.
+    class plural_forms::compiler
+        {
+      public:
+        compiler(std::wstring_view expression, std::vector<instruction>& program)
+            : m_expression(expression), m_program(program)
+            {
+            }
+
+        /// @returns @c true if the entire expression was compiled.
+        [[nodiscard]]
+        bool compile()
+            {
+            if (!parse_conditional())
+                {
+                return false;
+                }
+            skip_spaces();
+            return (m_position == m_expression.length());
+            }
+
+        /// @returns The most values that the program will have on its stack.
+        [[nodiscard]]
+        size_t get_max_stack_depth() const noexcept
+            {
+            return m_max_stack_depth;
+            }
+
+      private:
+        void skip_spaces() noexcept
+            {
+            while (m_position < m_expression.length() &&
+                   (m_expression[m_position] == L' ' || m_expression[m_position] == L'\t'))
+                {
+                ++m_position;
+                }
+            }
+
+        /// @returns @c true (and steps over it) if @c token is next in the expression.
+        bool accept(const std::wstring_view token)
+            {
+            skip_spaces();
+            if (m_expression.substr(m_position).starts_with(token))
+                {
+                m_position += token.length();
+                return true;
+                }
+            return false;
+            }
+
+        /// @returns @c true (and steps over it) if the relational @c token ('<' or '>')
+        ///     is next in the expression and isn't the start of a longer operator
+        ///     (e.g., '<' in "<=" or "<<").
+        bool accept_alone(const wchar_t token)
+            {
+            skip_spaces();
+            if (m_position < m_expression.length() && m_expression[m_position] == token &&
+                (m_position + 1 == m_expression.length() ||
+                 (m_expression[m_position + 1] != L'=' && m_expression[m_position + 1] != token)))
+                {
+                ++m_position;
+                return true;
+                }
+            return false;
+            }
+
+        /// @returns @c true (and steps over it) if a logical not is next in the
+        ///     expression (i.e., a '!' that isn't part of "!=").
+        bool accept_not()
+            {
+            skip_spaces();
+            if (m_position < m_expression.length() && m_expression[m_position] == L'!' &&
+                (m_position + 1 == m_expression.length() ||
+                 m_expression[m_position + 1] != L'='))
+                {
+                ++m_position;
+                return true;
+                }
+            return false;
+            }
+
+        /// @returns The position of the added instruction.
+        size_t emit(const op_code opCode, const uint64_t value = 0)
+            {
+            m_program.push_back(instruction{ opCode, value });
+            return m_program.size() - 1;
+            }
+
+        void push_value()
+            {
+            m_max_stack_depth = std::max(m_max_stack_depth, ++m_stack_depth);
+            }
+
+        /// @returns @c false if going another level deeper into the expression
+        ///     (parentheses, @c !, or @c ?:) would nest it too deeply.
+        /// @details Each level is another few calls into this compiler, so this keeps
+        ///     a malformed catalog from overflowing the stack.
+        bool enter_nested() noexcept
+            {
+            return (++m_nesting_depth <= MAX_NESTING_DEPTH);
+            }
+
+        /// @brief Emits a binary operator, whose two operands are replaced with the result.
+        void emit_binary(const op_code opCode)
+            {
+            emit(opCode);
+            --m_stack_depth;
+            }
+
+        // condition ? true-value : false-value
+        bool parse_conditional()
+            {
+            if (!parse_or())
+                {
+                return false;
+                }
+            if (!accept(L"?"))
+                {
+                return true;
+                }
+            const size_t jumpToFalse = emit(op_code::jump_if_zero);
+            --m_stack_depth;
+            if (!enter_nested() || !parse_conditional() || !accept(L":"))
+                {
+                return false;
+                }
+            const size_t jumpToEnd = emit(op_code::jump);
+            m_program[jumpToFalse].m_value = m_program.size();
+            // only one of the branches is evaluated
+            --m_stack_depth;
+            if (!parse_conditional())
+                {
+                return false;
+                }
+            m_program[jumpToEnd].m_value = m_program.size();
+            --m_nesting_depth;
+            return true;
+            }
+
+        // a || b, where b is only evaluated if a is 0
+        bool parse_or()
+            {
+            if (!parse_and())
+                {
+                return false;
+                }
+            while (accept(L"||"))
+                {
+                const size_t jumpToEnd = emit(op_code::jump_if_nonzero_keep);
+                --m_stack_depth;
+                if (!parse_and())
+                    {
+                    return false;
+                    }
+                m_program[jumpToEnd].m_value = m_program.size();
+                emit(op_code::to_bool);
+                }
+            return true;
+            }
+
+        // a && b, where b is only evaluated if a is not 0
+        bool parse_and()
+            {
+            if (!parse_equality())
+                {
+                return false;
+                }
+            while (accept(L"&&"))
+                {
+                const size_t jumpToEnd = emit(op_code::jump_if_zero_keep);
+                --m_stack_depth;
+                if (!parse_equality())
+                    {
+                    return false;
+                    }
+                m_program[jumpToEnd].m_value = m_program.size();
+                emit(op_code::to_bool);
+                }
+            return true;
+            }
+
+        bool parse_equality()
+            {
+            if (!parse_relational())
+                {
+                return false;
+                }
+            while (true)
+                {
+                op_code opCode{ op_code::equal };
+                if (accept(L"=="))
+                    {
+                    opCode = op_code::equal;
+                    }
+                else if (accept(L"!="))
+                    {
+                    opCode = op_code::not_equal;
+                    }
+                else
+                    {
+                    return true;
+                    }
+                if (!parse_relational())
+                    {
+                    return false;
+                    }
+                emit_binary(opCode);
+                }
+            }
+
+        bool parse_relational()
+            {
+            if (!parse_additive())
+                {
+                return false;
+                }
+            while (true)
+                {
+                op_code opCode{ op_code::less };
+                if (accept(L"<="))
+                    {
+                    opCode = op_code::less_equal;
+                    }
+                else if (accept(L">="))
+                    {
+                    opCode = op_code::greater_equal;
+                    }
+                else if (accept_alone(L'<'))
+                    {
+                    opCode = op_code::less;
+                    }
+                else if (accept_alone(L'>'))
+                    {
+                    opCode = op_code::greater;
+                    }
+                else
+                    {
+                    return true;
+                    }
+                if (!parse_additive())
+                    {
+                    return false;
+                    }
+                emit_binary(opCode);
+                }
+            }
+
+        bool parse_additive()
+            {
+            if (!parse_multiplicative())
+                {
+                return false;
+                }
+            while (true)
+                {
+                op_code opCode{ op_code::add };
+                if (accept(L"+"))
+                    {
+                    opCode = op_code::add;
+                    }
+                else if (accept(L"-"))
+                    {
+                    opCode = op_code::subtract;
+                    }
+                else
+                    {
+                    return true;
+                    }
+                if (!parse_multiplicative())
+                    {
+                    return false;
+                    }
+                emit_binary(opCode);
+                }
+            }
+
+        bool parse_multiplicative()
+            {
+            if (!parse_unary())
+                {
+                return false;
+                }
+            while (true)
+                {
+                op_code opCode{ op_code::multiply };
+                if (accept(L"*"))
+                    {
+                    opCode = op_code::multiply;
+                    }
+                else if (accept(L"/"))
+                    {
+                    opCode = op_code::divide;
+                    }
+                else if (accept(L"%"))
+                    {
+                    opCode = op_code::modulo;
+                    }
+                else
+                    {
+                    return true;
+                    }
+                if (!parse_unary())
+                    {
+                    return false;
+                    }
+                emit_binary(opCode);
+                }
+            }
+
+        bool parse_unary()
+            {
+            if (accept_not())
+                {
+                if (!enter_nested() || !parse_unary())
+                    {
+                    return false;
+                    }
+                emit(op_code::logical_not);
+                --m_nesting_depth;
+                return true;
+                }
+            return parse_primary();
+            }
+
+        bool parse_primary()
+            {
+            if (accept(L"("))
+                {
+                if (!enter_nested() || !parse_conditional() || !accept(L")"))
+                    {
+                    return false;
+                    }
+                --m_nesting_depth;
+                return true;
+                }
+            if (accept(L"n"))
+                {
+                emit(op_code::push_n);
+                push_value();
+                return true;
+                }
+            skip_spaces();
+            if (m_position < m_expression.length() && m_expression[m_position] >= L'0' &&
+                m_expression[m_position] <= L'9')
+                {
+                uint64_t value{ 0 };
+                while (m_position < m_expression.length() && m_expression[m_position] >= L'0' &&
+                       m_expression[m_position] <= L'9')
+                    {
+                    value = (value * 10) + (m_expression[m_position] - L'0');
+                    ++m_position;
+                    }
+                emit(op_code::push_value, value);
+                push_value();
+                return true;
+                }
+            return false;
+            }
+
+        std::wstring_view m_expression;
+        size_t m_position{ 0 };
+        std::vector<instruction>& m_program;
+        size_t m_stack_depth{ 0 };
+        size_t m_max_stack_depth{ 0 };
+        size_t m_nesting_depth{ 0 };
+        // far more than any real plural expression uses
+        constexpr static size_t MAX_NESTING_DEPTH{ 100 };
+        };
+
+    //------------------------------------------------
+    plural_forms::plural_forms(std::wstring_view header)
+        {
+        const auto skipSpaces = [&header]()
+        {
+            while (!header.empty() && (header.front() == L' ' || header.front() == L'\t'))
+                {
+                header.remove_prefix(1);
+                }
+        };
+        // steps over "name=" at the start of what's left of the header
+        const auto readName = [&header, &skipSpaces](const std::wstring_view name)
+        {
+            skipSpaces();
+            if (!header.starts_with(name))
+                {
+                return false;
+                }
+            header.remove_prefix(name.length());
+            skipSpaces();
+            if (!header.starts_with(L'='))
+                {
+                return false;
+                }
+            header.remove_prefix(1);
+            skipSpaces();
+            return true;
+        };
+
+        if (!readName(L"nplurals"))
+            {
+            return;
+            }
+        size_t pluralCount{ 0 };
+        while (!header.empty() && header.front() >= L'0' && header.front() <= L'9')
+            {
+            pluralCount = (pluralCount * 10) + (header.front() - L'0');
+            header.remove_prefix(1);
+            if (pluralCount > get_max_plural_count())
+                {
+                return;
+                }
+            }
+        skipSpaces();
+        if (pluralCount == 0 || !header.starts_with(L';'))
+            {
+            return;
+            }
+        header.remove_prefix(1);
+
+        if (!readName(L"plural"))
+            {
+            return;
+            }
+        std::wstring_view expression{ header.substr(0, header.find(L';')) };
+        while (!expression.empty() && (expression.back() == L' ' || expression.back() == L'\t'))
+            {
+            expression.remove_suffix(1);
+            }
+
+        compiler exprCompiler{ expression, m_program };
+        if (!exprCompiler.compile())
+            {
+            m_program.clear();
+            return;
+            }
+        m_max_stack_depth = exprCompiler.get_max_stack_depth();
+
+        m_sample_numbers.assign(pluralCount, npos);
+        m_sample_counts.assign(pluralCount, 0);
+        for (size_t n = 0; n <= get_max_sample_number(); ++n)
+            {
+            const size_t pluralIndex = evaluate(n);
+            if (pluralIndex < m_sample_numbers.size())
+                {
+                if (m_sample_numbers[pluralIndex] == npos)
+                    {
+                    m_sample_numbers[pluralIndex] = n;
+                    }
+                ++m_sample_counts[pluralIndex];
+                }
+            else if (m_first_out_of_range_number == npos)
+                {
+                m_first_out_of_range_number = n;
+                }
+            }
+        }
+
+    //------------------------------------------------
+    size_t plural_forms::evaluate(const size_t n) const
+        {
+        if (!is_valid())
+            {
+            return npos;
+            }
+
+        std::vector<uint64_t> stack(m_max_stack_depth);
+        // the next free slot on the stack
+        size_t top{ 0 };
+        size_t position{ 0 };
+        while (position < m_program.size())
+            {
+            const instruction& instr = m_program[position++];
+            switch (instr.m_op)
+                {
+            case op_code::push_n:
+                stack[top++] = n;
+                break;
+            case op_code::push_value:
+                stack[top++] = instr.m_value;
+                break;
+            case op_code::logical_not:
+                stack[top - 1] = (stack[top - 1] == 0) ? 1 : 0;
+                break;
+            case op_code::to_bool:
+                stack[top - 1] = (stack[top - 1] != 0) ? 1 : 0;
+                break;
+            case op_code::jump:
+                position = instr.m_value;
+                break;
+            case op_code::jump_if_zero:
+                if (stack[--top] == 0)
+                    {
+                    position = instr.m_value;
+                    }
+                break;
+            case op_code::jump_if_zero_keep:
+                if (stack[top - 1] == 0)
+                    {
+                    position = instr.m_value;
+                    }
+                else
+                    {
+                    --top;
+                    }
+                break;
+            case op_code::jump_if_nonzero_keep:
+                if (stack[top - 1] != 0)
+                    {
+                    position = instr.m_value;
+                    }
+                else
+                    {
+                    --top;
+                    }
+                break;
+            default:
+                {
+                const uint64_t right = stack[--top];
+                uint64_t& left = stack[top - 1];
+                switch (instr.m_op)
+                    {
+                case op_code::multiply:
+                    left *= right;
+                    break;
+                case op_code::divide:
+                    if (right == 0)
+                        {
+                        return npos;
+                        }
+                    left /= right;
+                    break;
+                case op_code::modulo:
+                    if (right == 0)
+                        {
+                        return npos;
+                        }
+                    left %= right;
+                    break;
+                case op_code::add:
+                    left += right;
+                    break;
+                case op_code::subtract:
+                    left -= right;
+                    break;
+                case op_code::less:
+                    left = (left < right) ? 1 : 0;
+                    break;
+                case op_code::less_equal:
+                    left = (left <= right) ? 1 : 0;
+                    break;
+                case op_code::greater:
+                    left = (left > right) ? 1 : 0;
+                    break;
+                case op_code::greater_equal:
+                    left = (left >= right) ? 1 : 0;
+                    break;
+                case op_code::equal:
+                    left = (left == right) ? 1 : 0;
+                    break;
+                case op_code::not_equal:
+                    left = (left != right) ? 1 : 0;
+                    break;
+                default:
+                    break;
+                    }
+                }
+                }
+            }
+
+        return (top == 1 && stack[0] < npos) ? static_cast<size_t>(stack[0]) : npos;
+        }
+    } // namespace i18n_check
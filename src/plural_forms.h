@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2025 Blake Madden
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * https://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Blake Madden - initial implementation
+ ********************************************************************************/
+
+/** @addtogroup Internationalization
+    @brief i18n classes.
+@{*/
+
+#ifndef PLURAL_FORMS_H
+#define PLURAL_FORMS_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace i18n_check
+    {
+    /** @brief A compiled gettext @c Plural-Forms header
+            (e.g., <tt>nplurals=2; plural=(n != 1);</tt>).
+        @details The @c plural expression is compiled to a small stack-based bytecode
+            that can be evaluated for any number. It is evaluated for the numbers
+            0 through get_max_sample_number() when compiled, which shows which
+            plural forms are used and the first number that uses each one.
+        @sa https://www.gnu.org/software/gettext/manual/html_node/Plural-forms.html*/
+    class plural_forms
+        {
+      public:
+        /// @brief The numbers that the expression is evaluated for when compiled
+        ///     are 0 through this.
+        [[nodiscard]]
+        constexpr static size_t get_max_sample_number() noexcept
+            {
+            return 1'000;
+            }
+
+        /// @brief The most plural forms (i.e., @c nplurals) that a header can have.
+        [[nodiscard]]
+        constexpr static size_t get_max_plural_count() noexcept
+            {
+            // no language has anywhere near this many
+            return 100;
+            }
+
+        /// @brief Constructor, which creates an invalid (empty) expression.
+        plural_forms() = default;
+
+        /** @brief Compiles a @c Plural-Forms header.
+            @param header The header's value
+                (e.g., <tt>nplurals=3; plural=(n==1 ? 0 : n==2 ? 1 : 2);</tt>).\n
+                If it can't be compiled, then is_valid() will return @c false.*/
+        explicit plural_forms(std::wstring_view header);
+
+        /// @returns @c true if the header was compiled.
+        [[nodiscard]]
+        bool is_valid() const noexcept
+            {
+            return !m_program.empty();
+            }
+
+        /// @returns The number of plural forms (i.e., @c nplurals).
+        [[nodiscard]]
+        size_t get_plural_count() const noexcept
+            {
+            return m_sample_numbers.size();
+            }
+
+        /** @returns The index of the plural form (i.e., the @c msgstr[] index) to use
+                for @c n, or @c npos if the header is invalid or the expression
+                divides by zero.
+            @param n The number to evaluate the expression for.*/
+        [[nodiscard]]
+        size_t evaluate(const size_t n) const;
+
+        /** @returns The first number (up to get_max_sample_number()) that uses
+                each plural form, or @c npos for a plural form that isn't used
+                by any of them.*/
+        [[nodiscard]]
+        const std::vector<size_t>& get_sample_numbers() const noexcept
+            {
+            return m_sample_numbers;
+            }
+
+        /** @returns @c true if only one of the numbers (up to get_max_sample_number())
+                uses a plural form.
+            @details For example, a form only used for 1 can be written as "one file"
+                instead of "%d file".
+            @param index The plural form.*/
+        [[nodiscard]]
+        bool is_used_by_one_number(const size_t index) const noexcept
+            {
+            return (index < m_sample_counts.size() && m_sample_counts[index] == 1);
+            }
+
+        /** @returns The first number (up to get_max_sample_number()) that the expression
+                returns a plural form for that is not less than @c nplurals
+                (or divides by zero for), or @c npos if there aren't any.*/
+        [[nodiscard]]
+        size_t get_first_out_of_range_number() const noexcept
+            {
+            return m_first_out_of_range_number;
+            }
+
+        /// @brief The value returned by evaluate() for an error or
+        ///     by the sample number functions for none found.
+        constexpr static size_t npos = static_cast<size_t>(-1);
+
+      private:
+        /// @brief The operations in the bytecode.
+        enum class op_code : uint8_t
+            {
+            /// @brief Pushes the number being evaluated.
+            push_n,
+            /// @brief Pushes the instruction's value.
+            push_value,
+            /// @brief Logical NOT of the top value.
+            logical_not,
+            /// @brief Converts the top value to 0 or 1.
+            to_bool,
+            // binary operators, which pop the right side and then the left side
+            // and push the result
+            multiply,
+            divide,
+            modulo,
+            add,
+            subtract,
+            less,
+            less_equal,
+            greater,
+            greater_equal,
+            equal,
+            not_equal,
+            /// @brief Jumps to the instruction's value.
+            jump,
+            /// @brief Pops the top value and jumps to the instruction's value if it is 0.
+            jump_if_zero,
+            /// @brief Jumps to the instruction's value if the top value is 0,
+            ///     otherwise pops it.
+            jump_if_zero_keep,
+            /// @brief Jumps to the instruction's value if the top value is not 0,
+            ///     otherwise pops it.
+            jump_if_nonzero_keep
+            };
+
+        /// @brief An instruction in the bytecode.
+        struct instruction
+            {
+            op_code m_op{ op_code::push_value };
+            uint64_t m_value{ 0 };
+            };
+
+        /// @brief Compiles the plural expression into the bytecode.
+        class compiler;
+
+        std::vector<instruction> m_program;
+        size_t m_max_stack_depth{ 0 };
+        std::vector<size_t> m_sample_numbers;
+        std::vector<size_t> m_sample_counts;
+        size_t m_first_out_of_range_number{ npos };
+        };
+    } // namespace i18n_check
+
+/** @}*/
+
+#endif // PLURAL_FORMS_H
@@ -25,55 +25,7 @@ namespace i18n_check
             return;
             }
 
-        const std::wstring originalPoFileText{ poFileText };
-
-        constexpr static std::wstring_view MSGID{ L"msgid \"" };
-        constexpr static std::wstring_view MSGID_PLURAL{ L"msgid_plural \"" };
-        constexpr static std::wstring_view MSGSTR{ L"msgstr \"" };
-        constexpr static std::wstring_view MSGSTR0{ L"msgstr[0] \"" };
-        constexpr static std::wstring_view MSGSTR1{ L"msgstr[1] \"" };
-        constexpr static std::wstring_view MSGCTXT{ L"msgctxt \"" };
-        // type of printf formatting the string uses, and its fuzzy status
-        static const std::wregex entryLineRegEx{ LR"(^#, ([,a-z \-]+)+$)" };
-        // translator comments, where they go to the end of the line
-        static const std::wregex commentLineRegEx{ LR"(^#[.] ([^\n\r]+)+$)" };
-
-        // captures the "no-" prefix (in case it's in there) so that we know
-        // to ignore this entry later
-        static const std::wregex printfResourceRegEx{ LR"(\b([a-zA-Z\-])+\b)" };
-
-        // Splits a catalog entry into its individual lines (stripping the line terminator,
-        // including a trailing CR for CRLF content), so each line can be matched on its own
-        // with std::regex_match.
-        const auto splitIntoLines = [](std::wstring_view text)
-        {
-            std::vector<std::wstring_view> lines;
-            size_t lineStart{ 0 };
-            while (lineStart <= text.length())
-                {
-                size_t lineEnd = text.find(L'\n', lineStart);
-                if (lineEnd == std::wstring_view::npos)
-                    {
-                    lineEnd = text.length();
-                    }
-                std::wstring_view line{ text.substr(lineStart, lineEnd - lineStart) };
-                if (!line.empty() && line.back() == L'\r')
-                    {
-                    line.remove_suffix(1);
-                    }
-                lines.push_back(line);
-                if (lineEnd == text.length())
-                    {
-                    break;
-                    }
-                lineStart = lineEnd + 1;
-                }
-            return lines;
-        };
-
-        std::vector<std::wstring> entryLines;
-        std::vector<std::wstring> commentLines;
-        std::vector<std::wstring> formatFlags;
+        const std::wstring_view originalPoFileText{ poFileText };
 
         size_t currentPos{ 0 };
 
@@ -95,6 +47,39 @@ namespace i18n_check
             currentPos = newLinePos + 1;
             }
 
+        // the plural forms are in the header, which is everything before the first blank line
+        // (each line of the header ends with an escaped newline)
+        const std::shared_ptr<const plural_forms> pluralForms{ load_plural_forms(
+            read_header_text(originalPoFileText.substr(0, currentPos)), LR"(\n)") };
+        // problems with the plural forms are reported once, with the first plural entry
+        bool pluralFormsReviewed{ false };
+
+        // Line numbers are counted from where the last entry was, rather than
+        // from the start of the file for each entry. CR, LF, and CRLF are each one line break.
+        size_t lineCountedPos{ 0 };
+        size_t lineNumber{ 1 };
+        const auto lineOfPosition = [&originalPoFileText, &lineCountedPos,
+                                     &lineNumber](const size_t position)
+        {
+            for (; lineCountedPos < position; ++lineCountedPos)
+                {
+                if (originalPoFileText[lineCountedPos] == L'\r' ||
+                    (originalPoFileText[lineCountedPos] == L'\n' &&
+                     (lineCountedPos == 0 || originalPoFileText[lineCountedPos - 1] != L'\r')))
+                    {
+                    ++lineNumber;
+                    }
+                }
+            return lineNumber;
+        };
+
+        // when streaming, entries are reviewed as they are read instead of being stored
+        std::optional<i18n_string_util::whole_word_matcher> untranslatableNames;
+        if (m_entryCallback)
+            {
+            untranslatableNames.emplace(get_untranslatable_names());
+            }
+
         size_t prefixRemovedLength{ 0 };
         while (!poFileText.empty())
             {
@@ -109,112 +94,306 @@ namespace i18n_check
             poFileText.remove_prefix(entry.length());
             prefixRemovedLength = entry.length();
 
-            // load information about the string's fuzzy status and its printf format
-            entryLines.clear();
-            for (const auto& line : splitIntoLines(entry))
+            po_entry_view entryView{ read_entry(entry) };
+            // (entries are only flagged as fuzzy if fuzzy translations aren't being reviewed)
+            if (!entryView.m_has_source || entryView.m_fuzzy)
+                {
+                continue;
+                }
+
+            if (!entryView.m_context.empty())
+                {
+                entryView.m_comment.append(join_po_msg(entryView.m_context));
+                }
+
+            std::pair<std::filesystem::path, translation_catalog_entry> catEntry{
+                fileName,
+                translation_catalog_entry{
+                    join_po_msg(entryView.m_source), join_po_msg(entryView.m_source_plural),
+                    // when there is a plural, then msgstr 0-1 is where the
+                    // singular and plural translations are kept
+                    join_po_msg(entryView.m_translation.empty() ?
+                                    entryView.get_translation_plural(0) :
+                                    entryView.m_translation),
+                    join_po_msg(entryView.get_translation_plural(1)), entryView.m_po_format,
+                    std::vector<std::pair<translation_issue, std::wstring>>{},
+                    lineOfPosition(currentPos), std::move(entryView.m_comment),
+                    std::vector<std::wstring>{}, nullptr }
+            };
+
+            if (!catEntry.second.m_source_plural.empty())
                 {
-                std::match_results<std::wstring_view::const_iterator> lineMatch;
-                if (std::regex_match(line.cbegin(), line.cend(), lineMatch, entryLineRegEx))
+                // the plural translations, up to the last one in the entry
+                const auto pluralTranslationsEnd =
+                    std::find_if(entryView.m_translation_plurals.crbegin(),
+                                 entryView.m_translation_plurals.crend(),
+                                 [](const auto& translation)
+                                 { return translation.data() != nullptr; })
+                        .base();
+                for (auto translation = entryView.m_translation_plurals.cbegin();
+                     translation != pluralTranslationsEnd; ++translation)
+                    {
+                    catEntry.second.m_translation_plural_forms.push_back(
+                        join_po_msg(*translation));
+                    }
+                catEntry.second.m_plural_forms = pluralForms;
+
+                if (!pluralFormsReviewed && pluralForms != nullptr)
                     {
-                    entryLines.emplace_back(lineMatch[1].str());
+                    review_plural_forms(*pluralForms, catEntry.second.m_issues);
+                    pluralFormsReviewed = true;
                     }
                 }
 
-            po_format_string pofs{ po_format_string::no_format };
-            bool formatSpecFound{ false };
-            bool isFuzzy{ false };
-            for (const auto& entryLine : entryLines)
+            if (untranslatableNames)
                 {
-                formatFlags.clear();
-                std::copy(std::regex_token_iterator<std::wstring::const_iterator>(
-                              entryLine.cbegin(), entryLine.cend(), printfResourceRegEx, 0),
-                          std::regex_token_iterator<std::wstring::const_iterator>{},
-                          std::back_inserter(formatFlags));
-                for (const auto& formatFlag : formatFlags)
+                review_catalog_entry(catEntry, *untranslatableNames);
+                m_entryCallback(catEntry);
+                ++m_streamedEntryCount;
+                }
+            else
+                {
+                get_catalog_entries().push_back(std::move(catEntry));
+                }
+            }
+        }
+
+    //------------------------------------------------
+    po_file_review::po_entry_view po_file_review::read_entry(std::wstring_view entry) const
+        {
+        constexpr static std::wstring_view MSGID{ L"msgid \"" };
+        constexpr static std::wstring_view MSGID_PLURAL{ L"msgid_plural \"" };
+        constexpr static std::wstring_view MSGSTR{ L"msgstr \"" };
+        // followed by the plural form's index, then "] \""
+        constexpr static std::wstring_view MSGSTR_PLURAL{ L"msgstr[" };
+        constexpr static std::wstring_view MSGCTXT{ L"msgctxt \"" };
+        // type of printf formatting the string uses, and its fuzzy status
+        constexpr static std::wstring_view FLAGS_PREFIX{ L"#, " };
+        // translator comments, where they go to the end of the line
+        constexpr static std::wstring_view COMMENT_PREFIX{ L"#. " };
+
+        po_entry_view entryView;
+        bool formatSpecFound{ false };
+        // the message that continuation lines (lines that are just a quoted string) belong to
+        std::wstring_view* currentMsg{ nullptr };
+
+        const auto readFlags = [this, &entryView, &formatSpecFound](std::wstring_view flags)
+        {
+            while (!flags.empty())
+                {
+                const size_t flagStart = flags.find_first_not_of(L", -");
+                if (flagStart == std::wstring_view::npos)
                     {
-                    if (formatFlag == L"c-format" || formatFlag == L"cpp-format" ||
-                        formatFlag == L"possible-c-format")
-                        {
-                        pofs = po_format_string::cpp_format;
-                        formatSpecFound = true;
-                        }
-                    else if (formatFlag == L"qt-format" || formatFlag == L"qt-plural-format" ||
-                             formatFlag == L"kde-format")
-                        {
-                        pofs = po_format_string::qt_format;
-                        formatSpecFound = true;
-                        }
-                    else if (!is_reviewing_fuzzy_translations() && formatFlag == _DT(L"fuzzy"))
-                        {
-                        pofs = po_format_string::no_format;
-                        formatSpecFound = true;
-                        isFuzzy = true;
-                        break;
-                        }
+                    break;
+                    }
+                flags.remove_prefix(flagStart);
+                size_t flagEnd = flags.find_first_of(L", ");
+                if (flagEnd == std::wstring_view::npos)
+                    {
+                    flagEnd = flags.length();
                     }
-                // stop looking at the comment lines if we loaded a printf specification already
-                if (formatSpecFound)
+                std::wstring_view formatFlag{ flags.substr(0, flagEnd) };
+                flags.remove_prefix(flagEnd);
+                while (!formatFlag.empty() && formatFlag.back() == L'-')
                     {
+                    formatFlag.remove_suffix(1);
+                    }
+
+                if (formatFlag == L"c-format" || formatFlag == L"cpp-format" ||
+                    formatFlag == L"possible-c-format")
+                    {
+                    entryView.m_po_format = po_format_string::cpp_format;
+                    formatSpecFound = true;
+                    }
+                else if (formatFlag == L"qt-format" || formatFlag == L"qt-plural-format" ||
+                         formatFlag == L"kde-format")
+                    {
+                    entryView.m_po_format = po_format_string::qt_format;
+                    formatSpecFound = true;
+                    }
+                else if (!is_reviewing_fuzzy_translations() && formatFlag == _DT(L"fuzzy"))
+                    {
+                    entryView.m_po_format = po_format_string::no_format;
+                    formatSpecFound = true;
+                    entryView.m_fuzzy = true;
                     break;
                     }
                 }
+        };
 
-            // Load any translator comments.
-            // If a comment is multiline in the source code, then it gets separate "#." entries
-            // in the PO file. These need to be pieced back together into one string.
-            commentLines.clear();
-            for (const auto& line : splitIntoLines(entry))
+        // Reads a message's first line, which is its tag followed by a quoted string.
+        // Only a message's first occurrence in the entry is used (a message that was found,
+        // even if empty, will point into the entry).
+        const auto readMsg = [&currentMsg](std::wstring_view line, const std::wstring_view msgTag,
+                                           std::wstring_view& msg)
+        {
+            currentMsg = nullptr;
+            if (msg.data() != nullptr)
                 {
-                std::match_results<std::wstring_view::const_iterator> lineMatch;
-                if (std::regex_match(line.cbegin(), line.cend(), lineMatch, commentLineRegEx))
-                    {
-                    commentLines.emplace_back(lineMatch[1].str());
-                    }
+                return;
+                }
+            line.remove_prefix(msgTag.length());
+            const size_t closingQuote = line.rfind(L'"');
+            if (closingQuote == std::wstring_view::npos)
+                {
+                return;
                 }
-            std::wstring comment = [&commentLines]()
+            msg = line.substr(0, closingQuote);
+            currentMsg = &msg;
+        };
+
+        size_t lineStart{ 0 };
+        while (lineStart < entry.length())
             {
-                std::wstring fullComment;
-                for (const auto& str : commentLines)
-                    {
-                    fullComment.append(str).append(L" ");
-                    }
-                string_util::trim(fullComment);
-                return fullComment;
-            }();
-            // also look for a context string
-            auto [msgCTextFound, msgCText, msgCTextPos, msgCTextLen] = read_po_msg(entry, MSGCTXT);
-            if (msgCTextFound)
+            size_t lineEnd = entry.find(L'\n', lineStart);
+            if (lineEnd == std::wstring_view::npos)
                 {
-                comment.append(msgCText);
+                lineEnd = entry.length();
+                }
+            std::wstring_view line{ entry.substr(lineStart, lineEnd - lineStart) };
+            lineStart = lineEnd + 1;
+            if (!line.empty() && line.back() == L'\r')
+                {
+                line.remove_suffix(1);
                 }
 
-            // read section from catalog entry
-            auto [msgIdFound, msgId, msgPos, msgLen] = read_po_msg(entry, MSGID);
-            if (!msgIdFound)
+            if (line.starts_with(L'#'))
                 {
+                currentMsg = nullptr;
+                // stop looking at the flags if we loaded a printf specification already
+                if (line.starts_with(FLAGS_PREFIX) && !formatSpecFound &&
+                    line.length() > FLAGS_PREFIX.length() &&
+                    line.find_first_not_of(L",abcdefghijklmnopqrstuvwxyz -",
+                                           FLAGS_PREFIX.length()) == std::wstring_view::npos)
+                    {
+                    readFlags(line.substr(FLAGS_PREFIX.length()));
+                    }
+                // If a comment is multiline in the source code, then it gets separate "#."
+                // lines in the PO file. These need to be pieced back together into one string.
+                else if (line.starts_with(COMMENT_PREFIX) &&
+                         line.length() > COMMENT_PREFIX.length())
+                    {
+                    entryView.m_comment.append(line.substr(COMMENT_PREFIX.length()))
+                        .append(L" ");
+                    }
                 continue;
                 }
-            // plural is optional, translations may be one string or two (for plural)
-            auto [msgIdPluralFound, msgPluralId, msgPosPlural, msgPluralLen] =
-                read_po_msg(entry, MSGID_PLURAL);
-            auto [msgStrFound, msgStr, msgStrPos, msgStrLen] = read_po_msg(entry, MSGSTR);
-            auto [msgStr0Found, msg0Str, msgStr0Pos, msgStr0Len] = read_po_msg(entry, MSGSTR0);
-            auto [msgStr1Found, msg1Str, msgStr1Pos, msgStr1Len] = read_po_msg(entry, MSGSTR1);
 
-            if (!is_reviewing_fuzzy_translations() && isFuzzy)
+            const size_t textStart = line.find_first_not_of(L" \t");
+            if (textStart == std::wstring_view::npos)
                 {
+                currentMsg = nullptr;
                 continue;
                 }
+            line.remove_prefix(textStart);
 
-            get_catalog_entries().emplace_back(
-                fileName,
-                translation_catalog_entry{
-                    std::move(msgId), std::move(msgPluralId),
-                    // when there is a plural, then msgstr 0-1 is where the
-                    // singular and plural translations are kept
-                    msgStr.empty() ? std::move(msg0Str) : std::move(msgStr), std::move(msg1Str),
-                    pofs, std::vector<std::pair<translation_issue, std::wstring>>{},
-                    get_line_and_column(currentPos, originalPoFileText).first, comment });
+            // continuation of the current message
+            if (line.front() == L'"')
+                {
+                const size_t closingQuote = line.rfind(L'"');
+                if (currentMsg != nullptr && closingQuote > 0)
+                    {
+                    // the lines are contiguous in the entry, so just extend the view
+                    *currentMsg = std::wstring_view{
+                        currentMsg->data(),
+                        static_cast<size_t>((line.data() + closingQuote) - currentMsg->data())
+                    };
+                    }
+                }
+            else if (line.starts_with(MSGID))
+                {
+                readMsg(line, MSGID, entryView.m_source);
+                }
+            else if (line.starts_with(MSGID_PLURAL))
+                {
+                readMsg(line, MSGID_PLURAL, entryView.m_source_plural);
+                }
+            else if (line.starts_with(MSGSTR))
+                {
+                readMsg(line, MSGSTR, entryView.m_translation);
+                }
+            else if (line.starts_with(MSGSTR_PLURAL))
+                {
+                size_t indexEnd{ MSGSTR_PLURAL.length() };
+                size_t pluralIndex{ 0 };
+                while (indexEnd < line.length() && line[indexEnd] >= L'0' &&
+                       line[indexEnd] <= L'9' &&
+                       pluralIndex < plural_forms::get_max_plural_count())
+                    {
+                    pluralIndex = (pluralIndex * 10) + (line[indexEnd++] - L'0');
+                    }
+                if (indexEnd > MSGSTR_PLURAL.length() &&
+                    pluralIndex < plural_forms::get_max_plural_count() &&
+                    line.substr(indexEnd).starts_with(L"] \""))
+                    {
+                    if (pluralIndex >= entryView.m_translation_plurals.size())
+                        {
+                        entryView.m_translation_plurals.resize(pluralIndex + 1);
+                        }
+                    // (the tag is only used for its length)
+                    readMsg(line, line.substr(0, indexEnd + 3),
+                            entryView.m_translation_plurals[pluralIndex]);
+                    }
+                else
+                    {
+                    currentMsg = nullptr;
+                    }
+                }
+            else if (line.starts_with(MSGCTXT))
+                {
+                readMsg(line, MSGCTXT, entryView.m_context);
+                }
+            else
+                {
+                currentMsg = nullptr;
+                }
+            }
+
+        entryView.m_has_source = (entryView.m_source.data() != nullptr);
+        string_util::trim(entryView.m_comment);
+        return entryView;
+        }
+
+    //------------------------------------------------
+    std::wstring po_file_review::read_header_text(std::wstring_view header) const
+        {
+        const po_entry_view headerView{ read_entry(header) };
+        // the header is the translation of an empty source string
+        if (!headerView.m_has_source || !headerView.m_source.empty())
+            {
+            return std::wstring{};
+            }
+        return join_po_msg(headerView.m_translation);
+        }
+
+    //------------------------------------------------
+    std::wstring po_file_review::join_po_msg(std::wstring_view msg)
+        {
+        std::wstring joined;
+        joined.reserve(msg.length());
+        size_t segmentStart{ 0 };
+        bool escaped{ false };
+        for (size_t i = 0; i < msg.length(); ++i)
+            {
+            if (msg[i] == L'\\')
+                {
+                escaped = !escaped;
+                continue;
+                }
+            // an unescaped quote is the end of a line, so skip to the start of the next line's
+            if (msg[i] == L'"' && !escaped)
+                {
+                joined.append(msg.substr(segmentStart, i - segmentStart));
+                i = msg.find(L'"', i + 1);
+                if (i == std::wstring_view::npos)
+                    {
+                    return joined;
+                    }
+                segmentStart = i + 1;
+                }
+            escaped = false;
             }
+        joined.append(msg.substr(segmentStart));
+        return joined;
         }
     } // namespace i18n_check
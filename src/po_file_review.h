@@ -19,6 +19,7 @@
 #define PO_FILE_REVIEW_H
 
 #include "translation_catalog_review.h"
+#include <functional>
 
 namespace i18n_check
     {
@@ -49,6 +50,39 @@ namespace i18n_check
             return m_reviewFuzzy;
             }
 
+        /// @brief Callback for a catalog entry that was reviewed as it was loaded.
+        /// @details Takes the entry (and the file that it is from), with its issues.
+        using catalog_entry_callback = std::function<void(
+            const std::pair<std::filesystem::path, translation_catalog_entry>&)>;
+
+        /** @brief Reviews catalog entries as they are loaded, rather than storing them
+                for review_strings().
+            @details Each entry is passed to @c callback as soon as it is reviewed and then
+                discarded, so memory use is bounded by the largest catalog file,
+                rather than all catalogs being analyzed. Streamed entries are not available from
+                get_catalog_entries().
+            @param callback The function to pass each reviewed entry to. An empty function
+                turns streaming off (the default).*/
+        void stream_catalog_entries(catalog_entry_callback callback)
+            {
+            m_entryCallback = std::move(callback);
+            }
+
+        /// @returns The number of entries passed to the stream_catalog_entries() callback
+        ///     since the last call to clear_results().
+        [[nodiscard]]
+        size_t get_streamed_entry_count() const noexcept
+            {
+            return m_streamedEntryCount;
+            }
+
+        /// @brief Clears the results.
+        void clear_results() final
+            {
+            translation_catalog_review::clear_results();
+            m_streamedEntryCount = 0;
+            }
+
         /** @brief Finalizes the review process after all files have been loaded.
             @details Reviews the catalogs in all loaded PO files.
             @param resetCallback Callback function to tell the progress system in @c callback
@@ -63,7 +97,56 @@ namespace i18n_check
             }
 
       private:
+        /// @brief The parts of a catalog entry, as views into the PO file's text.
+        /// @details Messages are the text between their first and last quotes, so
+        ///     multiline messages still have their embedded quotes and line breaks
+        ///     (use join_po_msg() to get the full message).
+        struct po_entry_view
+            {
+            std::wstring_view m_context;
+            std::wstring_view m_source;
+            std::wstring_view m_source_plural;
+            std::wstring_view m_translation;
+            /// @brief The plural translations (i.e., @c msgstr[0], @c msgstr[1], etc.),
+            ///     up to the highest index in the entry.
+            std::vector<std::wstring_view> m_translation_plurals;
+            bool m_has_source{ false };
+            po_format_string m_po_format{ po_format_string::no_format };
+            bool m_fuzzy{ false };
+            std::wstring m_comment;
+
+            /// @returns The plural translation at @c index, or an empty view if
+            ///     the entry doesn't have one.
+            [[nodiscard]]
+            std::wstring_view get_translation_plural(const size_t index) const noexcept
+                {
+                return (index < m_translation_plurals.size()) ? m_translation_plurals[index] :
+                                                                std::wstring_view{};
+                }
+            };
+
+        /** @brief Reads the parts of a catalog entry in a single pass.
+            @param entry The catalog entry (from read_po_catalog_entry()).
+            @returns The parts of the entry.*/
+        [[nodiscard]]
+        po_entry_view read_entry(std::wstring_view entry) const;
+
+        /** @brief Reads the text of a catalog's header.
+            @param header The catalog's header entry.
+            @returns The header's text (i.e., the translation of its empty source string),
+                or an empty string if @c header isn't a header entry.*/
+        [[nodiscard]]
+        std::wstring read_header_text(std::wstring_view header) const;
+
+        /** @brief Joins the lines of a message read by read_entry().
+            @param msg The message.
+            @returns The message, with the quotes and line breaks between its lines removed.*/
+        [[nodiscard]]
+        static std::wstring join_po_msg(std::wstring_view msg);
+
         bool m_reviewFuzzy{ false };
+        catalog_entry_callback m_entryCallback;
+        size_t m_streamedEntryCount{ 0 };
         };
     } // namespace i18n_check
 
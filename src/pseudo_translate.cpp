@@ -366,19 +366,19 @@ namespace i18n_check
                 continue;
                 }
 
-            if (std::iswalnum(msg[i]) != 0)
+            if (i18n_string_util::is_alnum(msg[i]))
                 {
                 if (m_trans_type == pseudo_translation_method::all_caps)
                     {
-                    appendChar(std::towupper(msg[i]));
+                    appendChar(i18n_string_util::to_upper(msg[i]));
                     }
                 else if (m_trans_type == pseudo_translation_method::Xx_es)
                     {
-                    if (std::iswupper(msg[i]) != 0)
+                    if (i18n_string_util::is_upper(msg[i]))
                         {
                         appendChar(L'X');
                         }
-                    else if (std::iswlower(msg[i]) != 0)
+                    else if (i18n_string_util::is_lower(msg[i]))
                         {
                         appendChar(L'x');
                         }
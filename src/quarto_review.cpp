@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include "quarto_review.h"
+#include <algorithm>
 #include <future>
 #include <utility>
 
@@ -21,115 +22,35 @@ namespace i18n_check
     void quarto_review::operator()(std::wstring_view srcText, const std::filesystem::path& fileName)
         {
         m_file_name = fileName;
-        m_file_start = nullptr;
+        set_file_start(std::wstring_view{});
 
         if (srcText.empty())
             {
             return;
             }
 
-        std::wstring filteredContent{ srcText };
-
-        // remove code blocks
-        auto startPos = filteredContent.find(L"```");
-        while (startPos != std::wstring::npos)
-            {
-            auto endPos = filteredContent.find(L"```", startPos + 3);
-            if (endPos == std::wstring::npos)
-                {
-                break;
-                }
-            endPos += 3;
-            clear_section(filteredContent, startPos, endPos);
-            startPos = filteredContent.find(L"```", endPos);
-            }
-
-        // remove math blocks ($$ ... $$ first)
-        auto mathStart = filteredContent.find(L"$$");
-        while (mathStart != std::wstring::npos)
-            {
-            auto mathEnd = filteredContent.find(L"$$", mathStart + 2);
-            if (mathEnd == std::wstring::npos)
-                {
-                break;
-                }
-            mathEnd += 2;
-            clear_section(filteredContent, mathStart, mathEnd);
-            mathStart = filteredContent.find(L"$$", mathEnd);
-            }
-
-        // remove inline math ($ ... $)
-        mathStart = filteredContent.find(L'$');
-        while (mathStart != std::wstring::npos)
-            {
-            // skip escaped \$
-            if (mathStart > 0 && filteredContent[mathStart - 1] == L'\\')
-                {
-                mathStart = filteredContent.find(L'$', mathStart + 1);
-                continue;
-                }
-
-            auto mathEnd = filteredContent.find(L'$', mathStart + 1);
-            if (mathEnd == std::wstring::npos)
-                {
-                break;
-                }
-
-            clear_section(filteredContent, mathStart, mathEnd + 1);
-            mathStart = filteredContent.find(L'$', mathEnd + 1);
-            }
-
-        // remove suppression blocks
-        const std::wregex suppressBegin(L"<!--\\s*quneiform-suppress-begin\\s*-->",
-                                        std::regex_constants::ECMAScript);
-        const std::wregex suppressEnd(L"<!--\\s*quneiform-suppress-end\\s*-->",
-                                      std::regex_constants::ECMAScript);
-
-        std::size_t searchFrom{ 0 };
-        std::wsmatch matchBegin, matchEnd;
-        while (std::regex_search(filteredContent.cbegin() + searchFrom, filteredContent.cend(),
-                                 matchBegin, suppressBegin))
-            {
-            const std::size_t beginStart =
-                searchFrom + static_cast<std::size_t>(matchBegin.position(0));
-            const std::size_t beginEnd =
-                beginStart + static_cast<std::size_t>(matchBegin.length(0));
-
-            if (!std::regex_search(filteredContent.cbegin() + beginEnd, filteredContent.cend(),
-                                   matchEnd, suppressEnd))
-                {
-                break;
-                }
-
-            const std::size_t endStart = beginEnd + static_cast<std::size_t>(matchEnd.position(0));
-            const std::size_t endEnd = endStart + static_cast<std::size_t>(matchEnd.length(0));
-
-            clear_section(filteredContent, beginStart, endEnd);
-
-            searchFrom = beginStart;
-            }
+        const quarto_document document = tokenize(srcText);
 
         auto funcSameLine = std::async(std::launch::async, &quarto_review::LoadSentencesOnSameLine,
-                                       this, std::cref(filteredContent));
+                                       this, std::cref(document));
 
         auto funcSplitSentences = std::async(std::launch::async, &quarto_review::LoadSplitSentences,
-                                             this, std::cref(filteredContent));
+                                             this, std::cref(document));
 
         auto funcMalformed = std::async(std::launch::async, &quarto_review::LoadMalformedContent,
-                                        this, std::cref(filteredContent));
+                                        this, std::cref(document));
 
         auto funcSmartQuotes = std::async(std::launch::async, &quarto_review::LoadSmartQuotes, this,
-                                          std::cref(filteredContent));
+                                          std::cref(document));
 
-        auto funcRanges = std::async(std::launch::async, &quarto_review::LoadRanges, this,
-                                     std::cref(filteredContent));
+        auto funcRanges =
+            std::async(std::launch::async, &quarto_review::LoadRanges, this, std::cref(document));
 
-        auto funcMalformedImages =
-            std::async(std::launch::async, &quarto_review::LoadMalformedImages, this,
-                       std::cref(filteredContent));
+        auto funcMalformedImages = std::async(
+            std::launch::async, &quarto_review::LoadMalformedImages, this, std::cref(document));
 
         auto funcAbsolutePaths = std::async(std::launch::async, &quarto_review::LoadAbsolutePaths,
-                                            this, std::cref(filteredContent));
+                                            this, std::cref(document));
 
             {
             auto sameLineResults = funcSameLine.get();
@@ -183,54 +104,240 @@ namespace i18n_check
         }
 
     //--------------------------------------------------
-    std::vector<quarto_review::string_info>
-    quarto_review::LoadAbsolutePaths(const std::wstring& filteredContent) const
+    std::pair<size_t, size_t>
+    quarto_review::quarto_document::get_line_and_column(const size_t position) const
         {
-        std::vector<string_info> issues;
-
-        if ((get_style() & check_malformed_strings) == 0U)
-            {
-            return issues;
-            }
-
-        const std::wstring& text = filteredContent;
-        const size_t textLength = text.size();
-
-        for (size_t scanIndex = 0; scanIndex < textLength; ++scanIndex)
-            {
-            // detect start of a Markdown link or image link
-            bool isLinkStart = false;
+        // the first line always starts at zero, so this will never be the first element
+        const auto nextLineStart =
+            std::upper_bound(m_lineStarts.cbegin(), m_lineStarts.cend(), position);
+        return std::make_pair(static_cast<size_t>(std::distance(m_lineStarts.cbegin(),
+                                                                nextLineStart)),
+                              position - *std::prev(nextLineStart) + 1);
+        }
 
-            if (text[scanIndex] == L'[')
+    //--------------------------------------------------
+    quarto_review::quarto_document quarto_review::tokenize(std::wstring_view srcText)
+        {
+        quarto_document document;
+        document.m_filteredContent.assign(srcText);
+        std::wstring& text = document.m_filteredContent;
+        const std::wstring_view textView{ text };
+        const size_t textLength{ text.length() };
+
+        // Reads a comment such as "<!-- quneiform-suppress-begin -->" at the given position,
+        // returning its length (or zero if it isn't that comment).
+        const auto readSuppressionComment =
+            [&textView, textLength](size_t pos, const std::wstring_view command) -> size_t
+        {
+            const size_t commentStart{ pos };
+            if (textView.substr(pos, 4) != L"<!--")
                 {
-                isLinkStart = true;
+                return 0;
                 }
-            else if (text[scanIndex] == L'!' && scanIndex + 1 < textLength &&
-                     text[scanIndex + 1] == L'[')
+            pos += 4;
+            while (pos < textLength && i18n_string_util::is_space(textView[pos]))
                 {
-                isLinkStart = true;
+                ++pos;
                 }
+            if (textView.substr(pos, command.length()) != command)
+                {
+                return 0;
+                }
+            pos += command.length();
+            while (pos < textLength && i18n_string_util::is_space(textView[pos]))
+                {
+                ++pos;
+                }
+            if (textView.substr(pos, 3) != L"-->")
+                {
+                return 0;
+                }
+            return (pos + 3) - commentStart;
+        };
 
-            if (!isLinkStart)
+        const auto blankSection = [&document, &text](const token_type type, const size_t start,
+                                                     const size_t end)
+        {
+            document.m_tokens.push_back(quarto_token{ type, start, end - start });
+            clear_section(text, start, end);
+        };
+
+        // Once an opening delimiter has no closing counterpart, then no later one will either,
+        // so remember that rather than searching to the end of the document again.
+        bool unclosedCodeFence{ false };
+        bool unclosedDisplayMath{ false };
+        bool unclosedInlineMath{ false };
+        bool unclosedSuppression{ false };
+        size_t closingBracketPos{ 0 };
+        bool noClosingBrackets{ false };
+
+        size_t lineStart{ 0 };
+        bool lineHasProse{ false };
+        document.m_lineStarts.push_back(0);
+
+        size_t pos{ 0 };
+        while (pos < textLength)
+            {
+            const wchar_t currentChar{ text[pos] };
+            if (currentChar == L'\r' || currentChar == L'\n')
                 {
+                if (lineHasProse)
+                    {
+                    document.m_tokens.push_back(
+                        quarto_token{ token_type::prose_line, lineStart, pos - lineStart });
+                    }
+                pos += (currentChar == L'\r' && pos + 1 < textLength && text[pos + 1] == L'\n') ?
+                           2 :
+                           1;
+                lineStart = pos;
+                lineHasProse = false;
+                document.m_lineStarts.push_back(pos);
                 continue;
                 }
+            // Sections being blanked out are cleared in place; the scan then continues
+            // from the same position over the (now blank) text so that lines are still counted.
+            if (currentChar == L'`' && !unclosedCodeFence && textView.substr(pos, 3) == L"```")
+                {
+                const size_t fenceEnd = text.find(L"```", pos + 3);
+                if (fenceEnd != std::wstring::npos)
+                    {
+                    blankSection(token_type::code_block, pos, fenceEnd + 3);
+                    continue;
+                    }
+                unclosedCodeFence = true;
+                }
+            else if (currentChar == L'$')
+                {
+                if (!unclosedDisplayMath && textView.substr(pos, 2) == L"$$")
+                    {
+                    const size_t mathEnd = text.find(L"$$", pos + 2);
+                    if (mathEnd != std::wstring::npos)
+                        {
+                        blankSection(token_type::display_math, pos, mathEnd + 2);
+                        continue;
+                        }
+                    unclosedDisplayMath = true;
+                    }
+                // skip escaped \$
+                if (!unclosedInlineMath && !(pos > 0 && text[pos - 1] == L'\\'))
+                    {
+                    const size_t mathEnd = text.find(L'$', pos + 1);
+                    if (mathEnd != std::wstring::npos)
+                        {
+                        blankSection(token_type::inline_math, pos, mathEnd + 1);
+                        continue;
+                        }
+                    unclosedInlineMath = true;
+                    }
+                }
+            else if (currentChar == L'<' && !unclosedSuppression)
+                {
+                if (const size_t beginLength =
+                        readSuppressionComment(pos, _DT(L"quneiform-suppress-begin"));
+                    beginLength > 0)
+                    {
+                    size_t searchPos{ pos + beginLength };
+                    size_t suppressionEnd{ std::wstring::npos };
+                    while ((searchPos = text.find(L"<!--", searchPos)) != std::wstring::npos)
+                        {
+                        if (const size_t endLength =
+                                readSuppressionComment(searchPos, _DT(L"quneiform-suppress-end"));
+                            endLength > 0)
+                            {
+                            suppressionEnd = searchPos + endLength;
+                            break;
+                            }
+                        searchPos += 4;
+                        }
+                    if (suppressionEnd != std::wstring::npos)
+                        {
+                        blankSection(token_type::suppressed, pos, suppressionEnd);
+                        continue;
+                        }
+                    unclosedSuppression = true;
+                    }
+                }
+            else if ((currentChar == L'[' && !(pos > 0 && text[pos - 1] == L'!')) ||
+                     (currentChar == L'!' && pos + 1 < textLength && text[pos + 1] == L'['))
+                {
+                const bool isImage{ currentChar == L'!' };
+                const size_t bracketStart{ isImage ? pos + 1 : pos };
+                // reuse the last closing bracket found if it is still ahead of us
+                if (!noClosingBrackets &&
+                    (closingBracketPos <= bracketStart || text[closingBracketPos] != L']'))
+                    {
+                    closingBracketPos = text.find(L']', bracketStart + 1);
+                    noClosingBrackets = (closingBracketPos == std::wstring::npos);
+                    }
+                const bool hasDestination{ !noClosingBrackets &&
+                                           closingBracketPos + 1 < textLength &&
+                                           text[closingBracketPos + 1] == L'(' };
+                size_t tokenEnd{ 0 };
+                if (hasDestination)
+                    {
+                    const size_t pathEnd = text.find_first_of(L")\r\n", closingBracketPos + 2);
+                    tokenEnd = (pathEnd == std::wstring::npos) ? textLength :
+                               (text[pathEnd] == L')')         ? pathEnd + 1 :
+                                                                 pathEnd;
+                    }
+                else
+                    {
+                    tokenEnd = std::min(text.find_first_of(L"\r\n", pos), textLength);
+                    if (!noClosingBrackets && closingBracketPos < tokenEnd)
+                        {
+                        tokenEnd = closingBracketPos + 1;
+                        }
+                    }
+                if (isImage || hasDestination)
+                    {
+                    document.m_tokens.push_back(quarto_token{
+                        isImage ? token_type::image : token_type::link, pos, tokenEnd - pos,
+                        hasDestination ? closingBracketPos + 2 : std::wstring::npos });
+                    }
+                }
 
-            // find closing ']'
-            const size_t closingBracketIndex = text.find(L']', scanIndex + 1);
-
-            if (closingBracketIndex == std::wstring::npos)
+            if (currentChar != L' ' && currentChar != L'\t')
                 {
-                continue;
+                lineHasProse = true;
                 }
+            ++pos;
+            }
+        if (lineHasProse)
+            {
+            document.m_tokens.push_back(
+                quarto_token{ token_type::prose_line, lineStart, textLength - lineStart });
+            }
+
+        return document;
+        }
 
-            // must be followed by '('
-            if (closingBracketIndex + 1 >= textLength || text[closingBracketIndex + 1] != L'(')
+    //--------------------------------------------------
+    std::vector<quarto_review::string_info>
+    quarto_review::LoadAbsolutePaths(const quarto_document& document) const
+        {
+        std::vector<string_info> issues;
+
+        if ((get_style() & check_malformed_strings) == 0U)
+            {
+            return issues;
+            }
+
+        const std::wstring& text = document.m_filteredContent;
+        const size_t textLength = text.size();
+
+        // links nested inside of another link's text are skipped
+        size_t nextScanIndex{ 0 };
+        for (const auto& token : document.m_tokens)
+            {
+            if ((token.m_type != token_type::link && token.m_type != token_type::image) ||
+                token.m_destinationPosition == std::wstring::npos ||
+                token.m_position < nextScanIndex)
                 {
                 continue;
                 }
 
-            const size_t pathStartIndex = closingBracketIndex + 2;
+            const size_t scanIndex = token.m_position;
+            const size_t pathStartIndex = token.m_destinationPosition;
 
             // find end of the path: ')' or line break
             const size_t pathEndIndex = text.find_first_of(L")\r\n", pathStartIndex);
@@ -258,7 +365,8 @@ namespace i18n_check
                 }
             // Windows absolute paths: C:/foo/bar
             else if (pathStartIndex + 2 < pathEndIndex &&
-                     std::iswalpha(text[pathStartIndex]) != 0 && text[pathStartIndex + 1] == L':' &&
+                     i18n_string_util::is_alpha(text[pathStartIndex]) &&
+                     text[pathStartIndex + 1] == L':' &&
                      text[pathStartIndex + 2] == L'/')
                 {
                 shouldFlag = true;
@@ -266,8 +374,6 @@ namespace i18n_check
 
             if (shouldFlag)
                 {
-                const auto filePosition = get_line_and_column(scanIndex, text);
-
                 const size_t matchEndIndex =
                     (pathEndIndex < textLength && text[pathEndIndex] == L')') ? pathEndIndex + 1 :
                                                                                 pathEndIndex;
@@ -276,11 +382,11 @@ namespace i18n_check
                     text.substr(scanIndex, matchEndIndex - scanIndex),
                     string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                             std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePosition);
+                    m_file_name, document.get_line_and_column(scanIndex));
                 }
 
             // skip ahead so we don't rescan inside the same link
-            scanIndex = pathEndIndex;
+            nextScanIndex = pathEndIndex + 1;
             }
 
         return issues;
@@ -288,52 +394,49 @@ namespace i18n_check
 
     //--------------------------------------------------
     std::vector<quarto_review::string_info>
-    quarto_review::LoadMalformedImages(const std::wstring& filteredContent) const
+    quarto_review::LoadMalformedImages(const quarto_document& document) const
         {
         std::vector<string_info> issues;
 
-        const std::wregex malformedImageRE(
+        static const std::wregex malformedImageRE(
             LR"((!\[(?![^\]]*\]\[)[^\]]*$)|(!\[(?![^\]]*\]\[)[^\]]*\]\(\s*(['"])[^'\\"\r\n]+\3\s*\))|(!\[(?![^\]]*\]\[)[^\]]*\]\([^\)\r\n]*(?=\r?\n|$)))",
             std::regex_constants::ECMAScript);
 
         if ((get_style() & check_malformed_strings) != 0U)
             {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> malformedImageEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, malformedImageRE))
+            const std::wstring& text = document.m_filteredContent;
+            size_t searchFrom{ 0 };
+            std::wsmatch imageMatch;
+            for (const auto& token : document.m_tokens)
                 {
-                currentBlockOffset += stPositions.position();
-
-                const auto start = stPositions.position();
-                auto length = stPositions.length();
+                if (token.m_type != token_type::image || token.m_position < searchFrom)
+                    {
+                    continue;
+                    }
+                // the expression begins with "![", so only try it where an image starts
+                if (!std::regex_search(text.cbegin() + static_cast<ptrdiff_t>(token.m_position),
+                                       text.cend(), imageMatch, malformedImageRE,
+                                       std::regex_constants::match_continuous |
+                                           std::regex_constants::match_prev_avail))
+                    {
+                    continue;
+                    }
 
+                auto length = static_cast<size_t>(imageMatch.length());
                 // stop at end-of-line
-                const auto eol = currentTextBlock.find_first_of(L"\r\n", start);
-                if (eol != std::wstring::npos && std::cmp_less(eol, start + length))
+                const auto eol = text.find_first_of(L"\r\n", token.m_position);
+                if (eol != std::wstring::npos && eol < token.m_position + length)
                     {
-                    length = eol - start;
+                    length = eol - token.m_position;
                     }
 
-                malformedImageEntries.emplace_back(currentBlockOffset,
-                                                   currentTextBlock.substr(start, length));
-
-                currentBlockOffset += length;
-                currentTextBlock = currentTextBlock.substr(start + length);
-                }
-
-            for (const auto& imgEntry : malformedImageEntries)
-                {
-                const auto filePos = get_line_and_column(imgEntry.first, filteredContent);
                 issues.emplace_back(
-                    imgEntry.second,
+                    text.substr(token.m_position, length),
                     string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                             std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
+                    m_file_name, document.get_line_and_column(token.m_position));
+
+                searchFrom = token.m_position + length;
                 }
             }
         return issues;
@@ -341,180 +444,112 @@ namespace i18n_check
 
     //--------------------------------------------------
     std::vector<quarto_review::string_info>
-    quarto_review::LoadRanges(const std::wstring& filteredContent) const
+    quarto_review::LoadRanges(const quarto_document& document) const
         {
         std::vector<string_info> issues;
 
-        const std::wregex numericRangeHyphenRE(LR"(\b([0-9]{1,4})-([0-9]{1,4})\b)",
-                                               std::regex_constants::ECMAScript);
-        const std::wregex phoneRE(LR"(\b\d{3}-\d{4}\b)", std::regex_constants::ECMAScript);
-        const std::wregex codePageRE(LR"(^8859-(?:[1-9]|1[0-6])$)",
-                                     std::regex_constants::ECMAScript);
-
-        if ((get_style() & check_malformed_strings) != 0U)
+        if ((get_style() & check_malformed_strings) == 0U)
             {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> numericRangeEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, numericRangeHyphenRE))
-                {
-                currentBlockOffset += stPositions.position();
-
-                numericRangeEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(stPositions.position(), stPositions.length()));
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
-                }
+            return issues;
+            }
 
-            for (const auto& nrEntry : numericRangeEntries)
+        static const std::wregex numericRangeHyphenRE(LR"(\b([0-9]{1,4})-([0-9]{1,4})\b)",
+                                                      std::regex_constants::ECMAScript);
+        static const std::wregex phoneRE(LR"(\b\d{3}-\d{4}\b)", std::regex_constants::ECMAScript);
+        static const std::wregex codePageRE(LR"(^8859-(?:[1-9]|1[0-6])$)",
+                                            std::regex_constants::ECMAScript);
+        static const std::wregex alphaRangeHyphenRE(LR"(\b([A-Z])-([A-Z])\b)",
+                                                    std::regex_constants::ECMAScript);
+        static const std::wregex k12RangeHyphenRE(LR"(\b(Pre-K|K)-(8|12)\b)",
+                                                  std::regex_constants::ECMAScript);
+
+        // ranges can't span lines, so only look at prose lines that have a hyphen in them
+        const auto loadRanges = [this, &document, &issues](const std::wregex& rangeRE,
+                                                            const bool ignorePhoneNumbers)
+        {
+            for (const auto& token : document.m_tokens)
                 {
-                // ignore phone numbers and code pages
-                if (std::regex_match(nrEntry.second, phoneRE) ||
-                    std::regex_match(nrEntry.second, codePageRE))
+                const auto line = document.get_text(token);
+                if (token.m_type != token_type::prose_line ||
+                    line.find(L'-') == std::wstring_view::npos)
                     {
                     continue;
                     }
-                const auto filePos = get_line_and_column(nrEntry.first, filteredContent);
-                issues.emplace_back(
-                    nrEntry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
-                }
-            }
-
-        const std::wregex alphaRangeHyphenRE(LR"(\b([A-Z])-([A-Z])\b)",
-                                             std::regex_constants::ECMAScript);
-
-        if ((get_style() & check_malformed_strings) != 0U)
-            {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> alphaRangeEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, alphaRangeHyphenRE))
-                {
-                currentBlockOffset += stPositions.position();
-
-                alphaRangeEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(stPositions.position(), stPositions.length()));
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
-                }
-
-            for (const auto& arEntry : alphaRangeEntries)
-                {
-                const auto filePos = get_line_and_column(arEntry.first, filteredContent);
-                issues.emplace_back(
-                    arEntry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
+                for (auto rangeMatch = std::regex_iterator<std::wstring_view::const_iterator>(
+                         line.cbegin(), line.cend(), rangeRE);
+                     rangeMatch != std::regex_iterator<std::wstring_view::const_iterator>{};
+                     ++rangeMatch)
+                    {
+                    const std::wstring range{ rangeMatch->str() };
+                    // ignore phone numbers and code pages
+                    if (ignorePhoneNumbers &&
+                        (std::regex_match(range, phoneRE) || std::regex_match(range, codePageRE)))
+                        {
+                        continue;
+                        }
+                    issues.emplace_back(
+                        range,
+                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                                std::wstring{}, std::wstring{}, std::wstring{}),
+                        m_file_name,
+                        document.get_line_and_column(
+                            token.m_position + static_cast<size_t>(rangeMatch->position())));
+                    }
                 }
-            }
-
-        const std::wregex k12RangeHyphenRE(LR"(\b(Pre-K|K)-(8|12)\b)",
-                                           std::regex_constants::ECMAScript);
+        };
 
-        if ((get_style() & check_malformed_strings) != 0U)
-            {
-            auto currentTextBlock{ filteredContent };
+        loadRanges(numericRangeHyphenRE, true);
+        loadRanges(alphaRangeHyphenRE, false);
+        loadRanges(k12RangeHyphenRE, false);
 
-            std::vector<std::pair<size_t, std::wstring>> k12RangeEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, k12RangeHyphenRE))
-                {
-                currentBlockOffset += stPositions.position();
-
-                k12RangeEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(stPositions.position(), stPositions.length()));
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
-                }
-
-            for (const auto& k12Entry : k12RangeEntries)
-                {
-                const auto filePos = get_line_and_column(k12Entry.first, filteredContent);
-                issues.emplace_back(
-                    k12Entry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
-                }
-            }
         return issues;
         }
 
     //--------------------------------------------------
     std::vector<quarto_review::string_info>
-    quarto_review::LoadSmartQuotes(const std::wstring& filteredContent) const
+    quarto_review::LoadSmartQuotes(const quarto_document& document) const
         {
         std::vector<string_info> issues;
         // quneiform-suppress-begin
-        const std::wregex smartQuotesRE(
+        static const std::wregex smartQuotesRE(
             LR"(([A-Za-z0-9_"'-]*[\u2018\u2019\u201C\u201D][A-Za-z0-9_"'-]*))",
             std::regex_constants::ECMAScript);
         // quneiform-suppress-end
 
         if ((get_style() & check_malformed_strings) != 0U)
             {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> smartQuotesEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, smartQuotesRE))
+            for (const auto& token : document.m_tokens)
                 {
-                currentBlockOffset += stPositions.position();
-
-                auto token{ currentTextBlock.substr(stPositions.position(), stPositions.length()) };
-
-                const bool isSingleQuoteChar =
-                    token.length() == 3 && (token.starts_with(L"'") || token.starts_with(L"\"")) &&
-                    (token.ends_with(L"'") || token.ends_with(L"\""));
-
-                if (!isSingleQuoteChar)
+                const auto line = document.get_text(token);
+                if (token.m_type != token_type::prose_line ||
+                    line.find_first_of(L"\u2018\u2019\u201C\u201D") == std::wstring_view::npos)
                     {
-                    smartQuotesEntries.emplace_back(currentBlockOffset, token);
+                    continue;
+                    }
+                for (auto quoteMatch = std::regex_iterator<std::wstring_view::const_iterator>(
+                         line.cbegin(), line.cend(), smartQuotesRE);
+                     quoteMatch != std::regex_iterator<std::wstring_view::const_iterator>{};
+                     ++quoteMatch)
+                    {
+                    const std::wstring quoteToken{ quoteMatch->str() };
+
+                    const bool isSingleQuoteChar =
+                        quoteToken.length() == 3 &&
+                        (quoteToken.starts_with(L"'") || quoteToken.starts_with(L"\"")) &&
+                        (quoteToken.ends_with(L"'") || quoteToken.ends_with(L"\""));
+
+                    if (!isSingleQuoteChar)
+                        {
+                        issues.emplace_back(
+                            quoteToken,
+                            string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                                    std::wstring{}, std::wstring{},
+                                                    std::wstring{}),
+                            m_file_name,
+                            document.get_line_and_column(
+                                token.m_position + static_cast<size_t>(quoteMatch->position())));
+                        }
                     }
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
-                }
-
-            for (const auto& sqEntry : smartQuotesEntries)
-                {
-                const auto filePos = get_line_and_column(sqEntry.first, filteredContent);
-                issues.emplace_back(
-                    sqEntry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
                 }
             }
         return issues;
@@ -522,44 +557,51 @@ namespace i18n_check
 
     //--------------------------------------------------
     std::vector<quarto_review::string_info>
-    quarto_review::LoadMalformedContent(const std::wstring& filteredContent) const
+    quarto_review::LoadMalformedContent(const quarto_document& document) const
         {
         std::vector<string_info> issues;
 
-        const std::wregex malformedContentRE(
+        static const std::wregex malformedContentRE(
             LR"((\{\{\s*[<%]\s*(?:pagebreak|include|video|embed|placeholder|lipsum)\b[^}\r\n]*[>%]\s*\}\})(?=\r?\n(?!$)[^\S\r\n]*\S))",
             std::regex_constants::ECMAScript);
 
         if ((get_style() & check_malformed_strings) != 0U)
             {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> malformedEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, malformedContentRE))
+            const std::wstring& text = document.m_filteredContent;
+            size_t searchFrom{ 0 };
+            std::wsmatch shortcodeMatch;
+            for (const auto& token : document.m_tokens)
                 {
-                currentBlockOffset += stPositions.position();
-
-                malformedEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(stPositions.position(), stPositions.length()));
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
-                }
-
-            for (const auto& mcEntry : malformedEntries)
-                {
-                const auto filePos = get_line_and_column(mcEntry.first, filteredContent);
-                issues.emplace_back(
-                    mcEntry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
+                if (token.m_type != token_type::prose_line)
+                    {
+                    continue;
+                    }
+                // the expression begins with "{{", so only try it where a shortcode starts
+                // (the match itself can look ahead to the next line)
+                const size_t lineEnd{ token.m_position + token.m_length };
+                size_t shortcodeStart{ std::max(token.m_position, searchFrom) };
+                while (shortcodeStart < lineEnd &&
+                       (shortcodeStart = text.find(L"{{", shortcodeStart)) < lineEnd)
+                    {
+                    if (std::regex_search(text.cbegin() + static_cast<ptrdiff_t>(shortcodeStart),
+                                          text.cend(), shortcodeMatch, malformedContentRE,
+                                          std::regex_constants::match_continuous |
+                                              std::regex_constants::match_prev_avail))
+                        {
+                        issues.emplace_back(
+                            shortcodeMatch.str(),
+                            string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                                    std::wstring{}, std::wstring{},
+                                                    std::wstring{}),
+                            m_file_name, document.get_line_and_column(shortcodeStart));
+                        shortcodeStart += static_cast<size_t>(shortcodeMatch.length());
+                        searchFrom = shortcodeStart;
+                        }
+                    else
+                        {
+                        ++shortcodeStart;
+                        }
+                    }
                 }
             }
         return issues;
@@ -567,59 +609,77 @@ namespace i18n_check
 
     //--------------------------------------------------
     std::vector<quarto_review::string_info>
-    quarto_review::LoadSplitSentences(const std::wstring& filteredContent) const
+    quarto_review::LoadSplitSentences(const quarto_document& document) const
         {
         std::vector<string_info> issues;
 
-        const std::wregex splitLineSentenceRE(LR"(([A-Za-z]+)\r?\n([A-Za-z])([A-Za-z]| ))",
-                                              std::regex_constants::ECMAScript);
-
-        if ((get_style() & check_l10n_strings) != 0U)
+        if ((get_style() & check_l10n_strings) == 0U)
             {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> splitSentenceEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, splitLineSentenceRE))
-                {
-                currentBlockOffset += stPositions.position();
-
-                splitSentenceEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(stPositions.position(), stPositions.length()));
+            return issues;
+            }
 
-                currentBlockOffset += stPositions.length();
+        const auto isLetter = [](const wchar_t chr) noexcept
+        { return (chr >= L'a' && chr <= L'z') || (chr >= L'A' && chr <= L'Z'); };
 
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
+        // Looks for a line ending with a word, followed by a line starting with one
+        // (i.e., "([A-Za-z]+)\r?\n([A-Za-z])([A-Za-z]| )").
+        const std::wstring& text = document.m_filteredContent;
+        size_t previousMatchEnd{ 0 };
+        for (const auto& token : document.m_tokens)
+            {
+            if (token.m_type != token_type::prose_line)
+                {
+                continue;
                 }
-
-            for (const auto& ssEntry : splitSentenceEntries)
+            const size_t lineEnd{ token.m_position + token.m_length };
+            size_t nextLineStart{ lineEnd };
+            if (nextLineStart < text.length() && text[nextLineStart] == L'\r')
                 {
-                const auto filePos = get_line_and_column(ssEntry.first, filteredContent);
-                issues.emplace_back(
-                    ssEntry.second.length() > 32 ? ssEntry.second.substr(0, 29) + _DT(L"...") :
-                                                   ssEntry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
+                ++nextLineStart;
+                }
+            if (nextLineStart >= text.length() || text[nextLineStart] != L'\n')
+                {
+                continue;
+                }
+            ++nextLineStart;
+            if (nextLineStart + 1 >= text.length() || !isLetter(text[nextLineStart]) ||
+                !(isLetter(text[nextLineStart + 1]) || text[nextLineStart + 1] == L' '))
+                {
+                continue;
+                }
+            // the last word on the line (that wasn't part of the previous match)
+            const size_t wordStartLimit{ std::max(token.m_position, previousMatchEnd) };
+            size_t wordStart{ lineEnd };
+            while (wordStart > wordStartLimit && isLetter(text[wordStart - 1]))
+                {
+                --wordStart;
+                }
+            if (wordStart == lineEnd)
+                {
+                continue;
                 }
+            previousMatchEnd = nextLineStart + 2;
+
+            const std::wstring matchedText{ text.substr(wordStart, previousMatchEnd - wordStart) };
+            issues.emplace_back(
+                matchedText.length() > 32 ? matchedText.substr(0, 29) + _DT(L"...") : matchedText,
+                string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                        std::wstring{}, std::wstring{}, std::wstring{}),
+                m_file_name, document.get_line_and_column(wordStart));
             }
         return issues;
         }
 
     //--------------------------------------------------
     std::vector<quarto_review::string_info>
-    quarto_review::LoadSentencesOnSameLine(const std::wstring& filteredContent) const
+    quarto_review::LoadSentencesOnSameLine(const quarto_document& document) const
         {
         std::vector<string_info> issues;
 
-        const std::wregex multiSentenceLineRE(
+        static const std::wregex multiSentenceLineRE(
             LR"(([A-Za-zÀ-ÖØ-öø-ÿ]{2,}(?:\.[A-Za-zÀ-ÖØ-öø-ÿ]+)*\.)[”’"'»)\]]*[ \t]+[“"'(]*[A-ZÀ-ÖØ-Þ0-9])",
             std::regex_constants::ECMAScript);
-        const std::wregex abbrevRE(
+        static const std::wregex abbrevRE(
             L"\\b(?:(?:"
             // Country / organization abbreviations
             "(?:U\\.S\\.A|U\\.S|U\\.K|E\\.U|U\\.N|N\\.A\\.T\\.O|F\\.B\\.I|C\\.I\\.A|A\\.T\\.M)"
@@ -641,41 +701,39 @@ namespace i18n_check
 
         if ((get_style() & check_l10n_strings) != 0U)
             {
-            auto currentTextBlock{ filteredContent };
-
-            std::vector<std::pair<size_t, std::wstring>> multiSentenceEntries;
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, multiSentenceLineRE))
+            // sentences can't be on the same line without a period on it
+            for (const auto& token : document.m_tokens)
                 {
-                currentBlockOffset += stPositions.position();
-
-                const std::wstring lastWord = (stPositions.size() > 1) ? stPositions[1].str() : L"";
-
-                // flag if not an abbreviation, meaning that this is really the end of a sentence
-                if (!std::regex_match(lastWord, abbrevRE))
+                const auto line = document.get_text(token);
+                if (token.m_type != token_type::prose_line ||
+                    line.find(L'.') == std::wstring_view::npos)
                     {
-                    multiSentenceEntries.emplace_back(
-                        currentBlockOffset,
-                        currentTextBlock.substr(stPositions.position(), stPositions.length()));
+                    continue;
+                    }
+                for (auto sentenceMatch = std::regex_iterator<std::wstring_view::const_iterator>(
+                         line.cbegin(), line.cend(), multiSentenceLineRE);
+                     sentenceMatch != std::regex_iterator<std::wstring_view::const_iterator>{};
+                     ++sentenceMatch)
+                    {
+                    const std::wstring lastWord =
+                        (sentenceMatch->size() > 1) ? (*sentenceMatch)[1].str() : L"";
+
+                    // flag if not an abbreviation, meaning that this is really the end of a
+                    // sentence
+                    if (std::regex_match(lastWord, abbrevRE))
+                        {
+                        continue;
+                        }
+                    const std::wstring matchedText{ sentenceMatch->str() };
+                    issues.emplace_back(
+                        matchedText.length() > 32 ? matchedText.substr(0, 29) + _DT(L"...") :
+                                                    matchedText,
+                        string_info::usage_info(string_info::usage_info::usage_type::orphan,
+                                                std::wstring{}, std::wstring{}, std::wstring{}),
+                        m_file_name,
+                        document.get_line_and_column(
+                            token.m_position + static_cast<size_t>(sentenceMatch->position())));
                     }
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock =
-                    currentTextBlock.substr(stPositions.position() + stPositions.length());
-                }
-
-            for (const auto& mlEntry : multiSentenceEntries)
-                {
-                const auto filePos = get_line_and_column(mlEntry.first, filteredContent);
-                issues.emplace_back(
-                    mlEntry.second.length() > 32 ? mlEntry.second.substr(0, 29) + _DT(L"...") :
-                                                   mlEntry.second,
-                    string_info::usage_info(string_info::usage_info::usage_type::orphan,
-                                            std::wstring{}, std::wstring{}, std::wstring{}),
-                    m_file_name, filePos);
                 }
             }
         return issues;
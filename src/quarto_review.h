@@ -19,6 +19,8 @@
 #define QUARTO_I18N_REVIEW_H
 
 #include "i18n_review.h"
+#include <string_view>
+#include <utility>
 #include <vector>
 
 /// @brief Classes for checking source code for internationalization/localization issues.
@@ -98,21 +100,103 @@ namespace i18n_check
             m_absolute_path_links.clear();
             }
 
+        /// @brief Removes the results from a file.
+        /// @param file The file to remove the results for.
+        void clear_file_results(const std::filesystem::path& file) final
+            {
+            i18n_review::clear_file_results(file);
+            const auto isFromFile = [&file](const auto& str) { return str.m_file_name == file; };
+            std::erase_if(m_sentencesOnSameLine, isFromFile);
+            std::erase_if(m_sentencesSplitOnDifferentLines, isFromFile);
+            std::erase_if(m_malformedContent, isFromFile);
+            std::erase_if(m_smartQuotes, isFromFile);
+            std::erase_if(m_rangeDashIssues, isFromFile);
+            std::erase_if(m_malformedImageLinks, isFromFile);
+            std::erase_if(m_absolute_path_links, isFromFile);
+            }
+
       private:
+        /// @brief The types of sections that a Quarto document is broken into.
+        enum class token_type
+            {
+            /// @brief A fenced (```) code block.
+            code_block,
+            /// @brief A display (<tt>$$</tt>) math block.
+            display_math,
+            /// @brief An inline (<tt>$</tt>) math section.
+            inline_math,
+            /// @brief A section between suppression comments.
+            suppressed,
+            /// @brief A link with a destination (e.g., <tt>[text](path)</tt>).
+            link,
+            /// @brief An image link (e.g., <tt>![alt](path)</tt>), which may be malformed.
+            image,
+            /// @brief A line with prose on it (code, math, and suppressed sections are blanked).
+            prose_line
+            };
+
+        /// @brief A section of a Quarto document.
+        struct quarto_token
+            {
+            /// @brief The type of section.
+            token_type m_type{ token_type::prose_line };
+            /// @brief The offset of the section in the document.
+            size_t m_position{ 0 };
+            /// @brief The length of the section.
+            size_t m_length{ 0 };
+            /// @brief For links and images, the offset of the destination
+            ///     (i.e., the text after <tt>](</tt>).
+            size_t m_destinationPosition{ std::wstring::npos };
+            };
+
+        /// @brief A Quarto document, broken into tokens.
+        struct quarto_document
+            {
+            /// @brief The document's text, with code, math, and suppressed sections blanked out.
+            std::wstring m_filteredContent;
+            /// @brief The tokens. Tokens of the same type are in document order.
+            std::vector<quarto_token> m_tokens;
+            /// @brief The offsets of the start of each line.
+            std::vector<size_t> m_lineStarts;
+
+            /// @returns The text of a token (from the filtered content).
+            /// @param token The token.
+            [[nodiscard]]
+            std::wstring_view get_text(const quarto_token& token) const
+                {
+                return std::wstring_view{ m_filteredContent }.substr(token.m_position,
+                                                                     token.m_length);
+                }
+
+            /// @returns The (one-indexed) line and column of a position in the document.
+            /// @param position The offset in the document.
+            [[nodiscard]]
+            std::pair<size_t, size_t> get_line_and_column(const size_t position) const;
+            };
+
+        /** @brief Breaks a Quarto document into tokens in a single pass.
+            @details Fenced code, display and inline math, and suppressed sections are
+                blanked out of the filtered content as they are found (earliest one wins),
+                and links, images, and prose lines are recorded from what remains.
+            @param srcText The Quarto text.
+            @returns The tokenized document.*/
+        [[nodiscard]]
+        static quarto_document tokenize(std::wstring_view srcText);
+
         [[nodiscard]]
-        std::vector<string_info> LoadSentencesOnSameLine(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadSentencesOnSameLine(const quarto_document& document) const;
         [[nodiscard]]
-        std::vector<string_info> LoadSplitSentences(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadSplitSentences(const quarto_document& document) const;
         [[nodiscard]]
-        std::vector<string_info> LoadMalformedContent(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadMalformedContent(const quarto_document& document) const;
         [[nodiscard]]
-        std::vector<string_info> LoadSmartQuotes(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadSmartQuotes(const quarto_document& document) const;
         [[nodiscard]]
-        std::vector<string_info> LoadRanges(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadRanges(const quarto_document& document) const;
         [[nodiscard]]
-        std::vector<string_info> LoadMalformedImages(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadMalformedImages(const quarto_document& document) const;
         [[nodiscard]]
-        std::vector<string_info> LoadAbsolutePaths(const std::wstring& filteredContent) const;
+        std::vector<string_info> LoadAbsolutePaths(const quarto_document& document) const;
 
         std::vector<string_info> m_sentencesOnSameLine;
         std::vector<string_info> m_sentencesSplitOnDifferentLines;
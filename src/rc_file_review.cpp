@@ -12,9 +12,11 @@
  ********************************************************************************/
 
 #include "rc_file_review.h"
+#include <array>
 
 namespace i18n_check
     {
+    //------------------------------------------------
     void rc_file_review::operator()(const std::wstring_view rcFileText,
                                     const std::filesystem::path& fileName)
         {
@@ -25,184 +27,112 @@ namespace i18n_check
             return;
             }
 
+        std::vector<string_table_entry> tableEntries;
+        std::vector<font_entry> fontEntries;
+        lex_resource_file(rcFileText, tableEntries, fontEntries);
+
         if (static_cast<bool>(get_style() & check_l10n_strings))
             {
-            /* This regex:
-
-               STRINGTABLE[[:space:]]*(BEGIN|\{)[\n\r]*([[:space:]]*[A-Za-z0-9_]+[,]?[[:space:]]*[L]?"[^\n\r]*[\n\r]*)+(END|\}))
-
-               can find a full string table, but causes an error_stack exception with std::regex
-               with some files, so need to more crudely parse string tables by looking for the start
-               and end tags.*/
-            std::vector<std::pair<size_t, std::wstring>> stringTables;
-            const std::wregex stringTableRegEx{
-                LR"(STRINGTABLE[[:space:]]*(BEGIN|\{)[[:space:]]*)"
-            };
-            const std::wregex stringTableEndRegEx{ LR"([\r\n]+[[:space:]]*(END|\}))" };
-
-            auto currentTextBlock{ rcFileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            std::match_results<decltype(currentTextBlock)::const_iterator> endPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, stringTableRegEx))
-                {
-                currentBlockOffset += stPositions.position();
-                currentTextBlock = currentTextBlock.substr(stPositions.position());
-                if (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                      endPositions, stringTableEndRegEx))
-                    {
-                    stringTables.emplace_back(
-                        currentBlockOffset, currentTextBlock.substr(0, endPositions.position() +
-                                                                           endPositions.length()));
-
-                    currentBlockOffset += endPositions.length();
-
-                    currentTextBlock = currentTextBlock.substr(endPositions.length());
-                    }
-                else
-                    {
-                    break;
-                    }
-                }
-
-            std::vector<std::pair<size_t, std::wstring>> tableEntries;
-            const std::wregex tableEntryRE{ LR"("([^\n\r]*))" };
-            for (std::pair<size_t, std::wstring> sTab : stringTables)
-                {
-                size_t matchLengthOffset{ 0 };
-                std::wsmatch tabEntryResults;
-                while (std::regex_search(sTab.second, tabEntryResults, tableEntryRE))
-                    {
-                    tableEntries.emplace_back(sTab.first + tabEntryResults.position(1) +
-                                                  matchLengthOffset,
-                                              tabEntryResults.str(1));
-                    sTab.second.erase(0, tabEntryResults.position(1) + tabEntryResults.length(1));
-                    matchLengthOffset += tabEntryResults.position(1) + tabEntryResults.length(1);
-                    }
-                }
-
             // review table entries
-            for (auto& tableEntry : tableEntries)
+            for (const auto& entry : tableEntries)
                 {
-                // strip off trailing quote
-                if (!tableEntry.second.empty())
-                    {
-                    tableEntry.second.pop_back();
-                    }
-                if (is_untranslatable_string(tableEntry.second, false).first)
+                const std::wstring tableEntry{ entry.m_string };
+                if (is_untranslatable_string(tableEntry, false).first)
                     {
                     m_unsafe_localizable_strings.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
                 else
                     {
                     m_localizable_strings.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
 
                 if ((m_review_styles & check_l10n_contains_url) != 0)
                     {
                     std::wsmatch results;
-                    if (std::regex_search(tableEntry.second, results, m_url_email_regex))
+                    if (std::regex_search(tableEntry, results, m_url_email_regex))
                         {
                         m_localizable_strings_with_urls.emplace_back(
-                            tableEntry.second,
+                            tableEntry,
                             string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                     std::wstring{}, std::wstring{}, std::wstring{}),
-                            m_file_name,
-                            std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                           std::wstring::npos));
+                            m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                         }
                     }
 
                 if ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0)
                     {
                     const auto [isunTranslatable, translatableContentLength] =
-                        is_untranslatable_string(tableEntry.second, false);
+                        is_untranslatable_string(tableEntry, false);
                     if (((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0) &&
                         !isunTranslatable &&
-                        tableEntry.second.length() > (translatableContentLength * 3))
+                        tableEntry.length() > (translatableContentLength * 3))
                         {
                         m_localizable_strings_with_unlocalizable_content.emplace_back(
-                            tableEntry.second,
+                            tableEntry,
                             string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                     std::wstring{}, std::wstring{}, std::wstring{}),
-                            m_file_name,
-                            std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                           std::wstring::npos));
+                            m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                         }
                     }
 
                 if (((m_review_styles & check_multipart_strings) != 0) &&
-                    is_string_multipart(tableEntry.second))
+                    is_string_multipart(tableEntry))
                     {
                     m_multipart_strings.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
 
                 if (((m_review_styles & check_pluralization) != 0) &&
-                    is_string_faux_plural(tableEntry.second))
+                    is_string_faux_plural(tableEntry))
                     {
                     m_faux_plural_strings.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
 
                 if (((m_review_styles & check_articles_proceeding_placeholder) != 0) &&
-                    (is_string_article_issue(tableEntry.second) ||
-                     is_string_pronoun(tableEntry.second)))
+                    (is_string_article_issue(tableEntry) ||
+                     is_string_pronoun(tableEntry)))
                     {
                     m_article_issue_strings.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
 
                 if (((m_review_styles & check_l10n_concatenated_strings) != 0) &&
-                    has_surrounding_spaces(tableEntry.second))
+                    has_surrounding_spaces(tableEntry))
                     {
                     m_localizable_strings_being_concatenated.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
 
                 if (((m_review_styles & check_halfwidth) != 0) &&
-                    !load_matches(tableEntry.second, m_halfwidth_range_regex).empty())
+                    (i18n_string_util::get_char_classes(tableEntry) &
+                     i18n_string_util::char_class_halfwidth) != 0)
                     {
                     m_localizable_strings_with_halfwidths.emplace_back(
-                        tableEntry.second,
+                        tableEntry,
                         string_info::usage_info(string_info::usage_info::usage_type::orphan,
                                                 std::wstring{}, std::wstring{}, std::wstring{}),
-                        m_file_name,
-                        std::make_pair(get_line_and_column(tableEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        m_file_name, std::make_pair(entry.m_line, std::wstring::npos));
                     }
                 }
             }
@@ -210,38 +140,10 @@ namespace i18n_check
         // read the fonts
         if (static_cast<bool>(get_style() & check_fonts))
             {
-            std::vector<std::pair<size_t, std::wstring>> fontEntries;
-            const std::wregex fontRE{ L"\\bFONT[ ]*([0-9]+),[ ]*\"([^\"]*)\"" };
-
-            auto currentTextBlock{ rcFileText };
-            std::match_results<decltype(currentTextBlock)::const_iterator> stPositions;
-            size_t currentBlockOffset{ 0 };
-            while (std::regex_search(currentTextBlock.cbegin(), currentTextBlock.cend(),
-                                     stPositions, fontRE))
-                {
-                currentBlockOffset += stPositions.position();
-                currentTextBlock = currentTextBlock.substr(stPositions.position());
-
-                fontEntries.emplace_back(
-                    currentBlockOffset,
-                    currentTextBlock.substr(0, stPositions.position() + stPositions.length()));
-
-                currentBlockOffset += stPositions.length();
-
-                currentTextBlock = currentTextBlock.substr(stPositions.length());
-                }
-
-            std::vector<std::wstring> fontParts;
             for (const auto& fontEntry : fontEntries)
                 {
-                fontParts.clear();
-                auto theFontEntry{ fontEntry.second };
-                std::copy(std::regex_token_iterator<
-                              std::remove_reference_t<decltype(theFontEntry)>::const_iterator>(
-                              theFontEntry.cbegin(), theFontEntry.cend(), fontRE, { 1, 2 }),
-                          std::regex_token_iterator<
-                              std::remove_reference_t<decltype(theFontEntry)>::const_iterator>{},
-                          std::back_inserter(fontParts));
+                const std::array<std::wstring, 2> fontParts{ std::wstring{ fontEntry.m_size },
+                                                             std::wstring{ fontEntry.m_name } };
 
                 const auto fontSize = [&fontParts]()
                 {
@@ -278,8 +180,7 @@ namespace i18n_check
 #endif
                         },
                         fileName,
-                        std::make_pair(get_line_and_column(fontEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        std::make_pair(fontEntry.m_line, std::wstring::npos));
                     }
 
                 if (fontParts[1] != L"MS Shell Dlg" && fontParts[1] != L"MS Shell Dlg 2")
@@ -298,10 +199,198 @@ namespace i18n_check
                                                      "Shell Dlg is recommended).") },
 #endif
                         fileName,
-                        std::make_pair(get_line_and_column(fontEntry.first, rcFileText).first,
-                                       std::wstring::npos));
+                        std::make_pair(fontEntry.m_line, std::wstring::npos));
+                    }
+                }
+            }
+        }
+
+    //------------------------------------------------
+    void rc_file_review::lex_resource_file(std::wstring_view rcFileText,
+                                           std::vector<string_table_entry>& tableEntries,
+                                           std::vector<font_entry>& fontEntries)
+        {
+        enum class lexer_state
+            {
+            outside_string_table,
+            string_table_header,
+            inside_string_table
+            };
+
+        const auto isWordChar = [](const wchar_t chr) noexcept
+        {
+            return (chr >= L'a' && chr <= L'z') || (chr >= L'A' && chr <= L'Z') ||
+                   (chr >= L'0' && chr <= L'9') || chr == L'_';
+        };
+        const auto isNewLine = [](const wchar_t chr) noexcept
+        { return chr == L'\n' || chr == L'\r'; };
+
+        size_t currentPos{ 0 };
+        size_t currentLine{ 1 };
+
+        // steps over a newline, treating CRLF as one line break
+        const auto stepOverNewLine = [&rcFileText, &currentPos, &currentLine]()
+        {
+            if (rcFileText[currentPos] == L'\r' && currentPos + 1 < rcFileText.length() &&
+                rcFileText[currentPos + 1] == L'\n')
+                {
+                ++currentPos;
+                }
+            ++currentPos;
+            ++currentLine;
+        };
+
+        // Finds the end of a string literal starting at the character after its opening quote.
+        // Both "" and backslash escapes are stepped over. A string not closed by the end of
+        // its line is ended there (a stray quote shouldn't swallow the rest of the file).
+        const auto findStringEnd = [&rcFileText, &isNewLine](size_t pos)
+        {
+            while (pos < rcFileText.length() && !isNewLine(rcFileText[pos]))
+                {
+                if (rcFileText[pos] == L'\\' && pos + 1 < rcFileText.length() &&
+                    !isNewLine(rcFileText[pos + 1]))
+                    {
+                    pos += 2;
+                    continue;
+                    }
+                if (rcFileText[pos] == L'"')
+                    {
+                    if (pos + 1 < rcFileText.length() && rcFileText[pos + 1] == L'"')
+                        {
+                        pos += 2;
+                        continue;
+                        }
+                    break;
+                    }
+                ++pos;
+                }
+            return pos;
+        };
+
+        const auto skipBlanks = [&rcFileText](size_t pos)
+        {
+            while (pos < rcFileText.length() &&
+                   (rcFileText[pos] == L' ' || rcFileText[pos] == L'\t'))
+                {
+                ++pos;
+                }
+            return pos;
+        };
+
+        lexer_state state{ lexer_state::outside_string_table };
+        while (currentPos < rcFileText.length())
+            {
+            const wchar_t currentChar{ rcFileText[currentPos] };
+            if (isNewLine(currentChar))
+                {
+                stepOverNewLine();
+                }
+            else if (currentChar == L'/' && currentPos + 1 < rcFileText.length() &&
+                     rcFileText[currentPos + 1] == L'/')
+                {
+                while (currentPos < rcFileText.length() && !isNewLine(rcFileText[currentPos]))
+                    {
+                    ++currentPos;
                     }
                 }
+            else if (currentChar == L'/' && currentPos + 1 < rcFileText.length() &&
+                     rcFileText[currentPos + 1] == L'*')
+                {
+                currentPos += 2;
+                while (currentPos < rcFileText.length() &&
+                       !(rcFileText[currentPos] == L'*' && currentPos + 1 < rcFileText.length() &&
+                         rcFileText[currentPos + 1] == L'/'))
+                    {
+                    if (isNewLine(rcFileText[currentPos]))
+                        {
+                        stepOverNewLine();
+                        }
+                    else
+                        {
+                        ++currentPos;
+                        }
+                    }
+                currentPos = std::min(currentPos + 2, rcFileText.length());
+                }
+            else if (currentChar == L'"')
+                {
+                const size_t stringEnd = findStringEnd(currentPos + 1);
+                if (state == lexer_state::inside_string_table)
+                    {
+                    tableEntries.push_back(string_table_entry{
+                        rcFileText.substr(currentPos + 1, stringEnd - (currentPos + 1)),
+                        currentPos + 1, currentLine });
+                    }
+                // step over the closing quote (if the string was terminated)
+                currentPos = (stringEnd < rcFileText.length() && rcFileText[stringEnd] == L'"') ?
+                                 stringEnd + 1 :
+                                 stringEnd;
+                }
+            else if (isWordChar(currentChar))
+                {
+                const size_t wordStart{ currentPos };
+                while (currentPos < rcFileText.length() && isWordChar(rcFileText[currentPos]))
+                    {
+                    ++currentPos;
+                    }
+                const std::wstring_view word{ rcFileText.substr(wordStart,
+                                                                currentPos - wordStart) };
+                if (state == lexer_state::outside_string_table && word == L"STRINGTABLE")
+                    {
+                    state = lexer_state::string_table_header;
+                    }
+                else if (state == lexer_state::string_table_header && word == L"BEGIN")
+                    {
+                    state = lexer_state::inside_string_table;
+                    }
+                else if (state == lexer_state::inside_string_table && word == L"END")
+                    {
+                    state = lexer_state::outside_string_table;
+                    }
+                // FONT pointsize, "typeface"[, weight, italic, charset]
+                else if (state == lexer_state::outside_string_table && word == L"FONT")
+                    {
+                    size_t pos = skipBlanks(currentPos);
+                    const size_t sizeStart{ pos };
+                    while (pos < rcFileText.length() && isWordChar(rcFileText[pos]))
+                        {
+                        ++pos;
+                        }
+                    const std::wstring_view fontSize{ rcFileText.substr(sizeStart,
+                                                                        pos - sizeStart) };
+                    pos = skipBlanks(pos);
+                    if (!fontSize.empty() && pos < rcFileText.length() &&
+                        rcFileText[pos] == L',')
+                        {
+                        pos = skipBlanks(pos + 1);
+                        if (pos < rcFileText.length() && rcFileText[pos] == L'"')
+                            {
+                            const size_t nameEnd = findStringEnd(pos + 1);
+                            if (nameEnd < rcFileText.length() && rcFileText[nameEnd] == L'"')
+                                {
+                                fontEntries.push_back(font_entry{
+                                    fontSize, rcFileText.substr(pos + 1, nameEnd - (pos + 1)),
+                                    wordStart, currentLine });
+                                currentPos = nameEnd + 1;
+                                }
+                            }
+                        }
+                    }
+                }
+            else if (currentChar == L'{' && state == lexer_state::string_table_header)
+                {
+                state = lexer_state::inside_string_table;
+                ++currentPos;
+                }
+            else if (currentChar == L'}' && state == lexer_state::inside_string_table)
+                {
+                state = lexer_state::outside_string_table;
+                ++currentPos;
+                }
+            else
+                {
+                ++currentPos;
+                }
             }
         }
     } // namespace i18n_check
@@ -19,6 +19,7 @@
 #define RC_FILE_REVIEW_H
 
 #include "i18n_review.h"
+#include <string_view>
 #include <vector>
 
 /// @brief Class for reviewing a Microsoft Windows resource file (*.RC).
@@ -60,7 +61,52 @@ namespace i18n_check
             m_nonSystemFontNames.clear();
             }
 
+        /// @brief Removes the results from a file.
+        /// @param file The file to remove the results for.
+        void clear_file_results(const std::filesystem::path& file) final
+            {
+            i18n_review::clear_file_results(file);
+            const auto isFromFile = [&file](const auto& str) { return str.m_file_name == file; };
+            std::erase_if(m_badFontSizes, isFromFile);
+            std::erase_if(m_nonSystemFontNames, isFromFile);
+            }
+
       private:
+        /// @brief A string literal found inside of a string table.
+        struct string_table_entry
+            {
+            /// @brief The string, without its surrounding quotes.
+            std::wstring_view m_string;
+            /// @brief The offset of the string's first character in the file.
+            size_t m_position{ 0 };
+            /// @brief The (one-indexed) line that the string is on.
+            size_t m_line{ 0 };
+            };
+
+        /// @brief A dialog font declaration (e.g., <tt>FONT 8, "MS Shell Dlg"</tt>).
+        struct font_entry
+            {
+            /// @brief The point size, as it appears in the file.
+            std::wstring_view m_size;
+            /// @brief The font name, without its surrounding quotes.
+            std::wstring_view m_name;
+            /// @brief The offset of the @c FONT statement in the file.
+            size_t m_position{ 0 };
+            /// @brief The (one-indexed) line that the statement is on.
+            size_t m_line{ 0 };
+            };
+
+        /** @brief Tokenizes an RC file in a single pass.
+            @details Comments are skipped, string literals are stepped over as whole tokens
+                (so keywords inside of them are ignored), and STRINGTABLE blocks and
+                FONT statements are recognized from the keywords around them.
+            @param rcFileText The RC file's text.
+            @param[out] tableEntries The strings found inside of STRINGTABLE blocks.
+            @param[out] fontEntries The FONT statements found in dialog definitions.*/
+        static void lex_resource_file(std::wstring_view rcFileText,
+                                      std::vector<string_table_entry>& tableEntries,
+                                      std::vector<font_entry>& fontEntries);
+
         std::vector<string_info> m_badFontSizes;
         std::vector<string_info> m_nonSystemFontNames;
         };
@@ -18,6 +18,8 @@
 #ifndef WISTERIA_STRING_UTIL_H
 #define WISTERIA_STRING_UTIL_H
 
+#include "i18n_string_util.h"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cctype>
@@ -30,10 +32,13 @@
 #include <cwctype>
 #include <format>
 #include <functional>
+#include <initializer_list>
 #include <memory>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <utility>
 
 /// @brief String helper functions and classes.
@@ -44,7 +49,7 @@ namespace string_util
     inline int tolower(char c) { return std::tolower(static_cast<unsigned char>(c)); }
 
     /// @private
-    inline wchar_t tolower(wchar_t c) { return std::towlower(c); }
+    inline wchar_t tolower(wchar_t c) { return i18n_string_util::to_lower(c); }
 
     template<typename T>
     concept wide_string_like = std::is_same_v<typename T::value_type, wchar_t> &&
@@ -380,7 +385,7 @@ namespace string_util
         const wchar_t* end{ wcstodEnd };
 
         // step over any space like wcstod would have done
-        while (buffer < end && std::iswspace(*buffer) != 0)
+        while (buffer < end && i18n_string_util::is_space(*buffer))
             {
             ++buffer;
             }
@@ -640,12 +645,12 @@ namespace string_util
             wchar_t ch2 = secondString[secondStringIndex];
 
             // skip leading spaces
-            while (std::iswspace(ch1) != 0)
+            while (i18n_string_util::is_space(ch1))
                 {
                 ch1 = firstString[++firstStringIndex];
                 }
 
-            while (std::iswspace(ch2) != 0)
+            while (i18n_string_util::is_space(ch2))
                 {
                 ch2 = secondString[++secondStringIndex];
                 }
@@ -1002,7 +1007,7 @@ namespace string_util
             {
             return nullptr;
             }
-        while (*stringToSearch != 0 && numberOfCharacters > 0)
+        while (numberOfCharacters > 0 && *stringToSearch != 0)
             {
             // if on an escape character, then step over that
             if (*stringToSearch == L'\\')
@@ -1021,7 +1026,7 @@ namespace string_util
             ++stringToSearch;
             --numberOfCharacters;
             }
-        return (*stringToSearch == 0 || numberOfCharacters <= 0) ? nullptr : stringToSearch;
+        return (numberOfCharacters <= 0 || *stringToSearch == 0) ? nullptr : stringToSearch;
         }
 
     /** @brief Searches for a single character in a string that does not have a `\\` in front of it,
@@ -1161,8 +1166,8 @@ namespace string_util
                     {
                     return start;
                     }
-                if (std::iswspace(haystack[start + needle.length()]) != 0 ||
-                    std::iswpunct(haystack[start + needle.length()]) != 0)
+                if (i18n_string_util::is_space(haystack[start + needle.length()]) ||
+                    i18n_string_util::is_punctuation(haystack[start + needle.length()]))
                     {
                     return start;
                     }
@@ -1176,8 +1181,8 @@ namespace string_util
                     {
                     return start;
                     }
-                if (std::iswspace(haystack[start - 1]) != 0 ||
-                    std::iswpunct(haystack[start - 1]) != 0)
+                if (i18n_string_util::is_space(haystack[start - 1]) ||
+                    i18n_string_util::is_punctuation(haystack[start - 1]))
                     {
                     return start;
                     }
@@ -1189,10 +1194,10 @@ namespace string_util
                 {
                 return start;
                 }
-            if ((std::iswspace(haystack[start + needle.length()]) != 0 ||
-                 std::iswpunct(haystack[start + needle.length()]) != 0) &&
-                (std::iswspace(haystack[start - 1]) != 0 ||
-                 std::iswpunct(haystack[start - 1]) != 0))
+            if ((i18n_string_util::is_space(haystack[start + needle.length()]) ||
+                 i18n_string_util::is_punctuation(haystack[start + needle.length()])) &&
+                (i18n_string_util::is_space(haystack[start - 1]) ||
+                 i18n_string_util::is_punctuation(haystack[start - 1])))
                 {
                 return start;
                 }
@@ -1256,6 +1261,106 @@ namespace string_util
             }
         };
 
+    /** @brief Hash set of strings which are looked up case insensitively.
+        @details Keys are case folded when they are inserted, so a lookup only needs to fold
+            the string being searched for (on the stack, for short strings) and then does
+            a regular hashed lookup. This is much faster than a @c std::set of
+            @c case_insensitive_wstring, which folds both strings character by character
+            for every comparison while walking the tree.*/
+    class case_folded_wstring_set
+        {
+      public:
+        /// @private
+        case_folded_wstring_set() = default;
+
+        /// @brief Constructor.
+        /// @param strs The initial strings to add.
+        case_folded_wstring_set(std::initializer_list<std::wstring_view> strs)
+            {
+            m_keys.reserve(strs.size());
+            for (const auto& str : strs)
+                {
+                insert(str);
+                }
+            }
+
+        /// @brief Adds a string to the set.
+        /// @param str The string to add.
+        void insert(const std::wstring_view str)
+            {
+            std::wstring folded{ str };
+            fold(folded.data(), str);
+            m_keys.insert(std::move(folded));
+            m_longest_key = std::max(m_longest_key, str.length());
+            }
+
+        /// @returns @c true if the set contains @c str (case insensitively).
+        /// @param str The string to look for.
+        [[nodiscard]]
+        bool contains(const std::wstring_view str) const
+            {
+            // nothing that long was inserted, so don't bother folding it
+            if (str.length() > m_longest_key)
+                {
+                return false;
+                }
+            if (str.length() <= STACK_FOLD_LENGTH)
+                {
+                std::array<wchar_t, STACK_FOLD_LENGTH> buffer{};
+                fold(buffer.data(), str);
+                return m_keys.contains(std::wstring_view{ buffer.data(), str.length() });
+                }
+            std::wstring folded{ str };
+            fold(folded.data(), str);
+            return m_keys.contains(folded);
+            }
+
+        /// @returns The number of strings in the set.
+        [[nodiscard]]
+        size_t size() const noexcept
+            {
+            return m_keys.size();
+            }
+
+        /// @returns @c true if the set is empty.
+        [[nodiscard]]
+        bool empty() const noexcept
+            {
+            return m_keys.empty();
+            }
+
+        /// @brief Removes all strings from the set.
+        void clear() noexcept
+            {
+            m_keys.clear();
+            m_longest_key = 0;
+            }
+
+      private:
+        static void fold(wchar_t* dest, const std::wstring_view str) noexcept
+            {
+            for (const auto chr : str)
+                {
+                *dest++ = i18n_string_util::to_lower(chr);
+                }
+            }
+
+        struct wstring_view_hash
+            {
+            using is_transparent = void;
+
+            [[nodiscard]]
+            size_t operator()(const std::wstring_view str) const noexcept
+                {
+                return std::hash<std::wstring_view>{}(str);
+                }
+            };
+
+        constexpr static size_t STACK_FOLD_LENGTH{ 64 };
+        std::unordered_set<std::wstring, wstring_view_hash, std::equal_to<>> m_keys;
+        size_t m_longest_key{ 0 };
+        };
+
     /** @brief Performs a heuristic check on a buffer to see if it's 7-bit or 8-bit ASCII.
         @details
             This function is intended as a lightweight heuristic when scanning raw binary
@@ -1327,7 +1432,7 @@ namespace string_util
     void ltrim(string_typeT& str)
         {
         str.erase(str.begin(), std::find_if(str.begin(), str.end(), [](wchar_t ch) noexcept
-                                            { return std::iswspace(ch) == 0; }));
+                                            { return !i18n_string_util::is_space(ch); }));
         }
 
     /// @brief Trims right side of @c str (in-place).
@@ -1337,7 +1442,7 @@ namespace string_util
     void rtrim(string_typeT& str)
         {
         str.erase(std::find_if(str.rbegin(), str.rend(),
-                               [](wchar_t ch) noexcept { return std::iswspace(ch) == 0; })
+                               [](wchar_t ch) noexcept { return !i18n_string_util::is_space(ch); })
                       .base(),
                   str.end());
         }
@@ -1368,13 +1473,13 @@ namespace string_util
                 {
                 return {};
                 }
-            if (std::iswspace(*left) == 0)
+            if (!i18n_string_util::is_space(*left))
                 {
                 break;
                 }
             }
         std::wstring_view::const_iterator right = std::prev(str.cend());
-        for (; right > left && std::iswspace(*right) != 0; --right)
+        for (; right > left && i18n_string_util::is_space(*right); --right)
             {
             }
         return str.substr(std::distance(str.cbegin(), left), std::distance(left, right) + 1);
@@ -1387,7 +1492,8 @@ namespace string_util
     void ltrim_punct(string_typeT& str)
         {
         str.erase(str.begin(), std::find_if(str.begin(), str.end(),
-                                            [](wchar_t ch) { return std::iswpunct(ch) == 0; }));
+                                            [](wchar_t ch)
+                                            { return !i18n_string_util::is_punctuation(ch); }));
         }
 
     /// @brief Trims punctuation from right side of @c str (in-place).
@@ -1397,7 +1503,7 @@ namespace string_util
     void rtrim_punct(string_typeT& str)
         {
         str.erase(std::find_if(str.rbegin(), str.rend(),
-                               [](wchar_t ch) { return std::iswpunct(ch) == 0; })
+                               [](wchar_t ch) { return !i18n_string_util::is_punctuation(ch); })
                       .base(),
                   str.end());
         }
@@ -1714,12 +1820,12 @@ namespace string_util
             {
             // if this is the first space found after the current
             // word then it's OK--just leave it
-            if (std::iswspace(text[i]) != 0 && !alreadyHasSpace)
+            if (i18n_string_util::is_space(text[i]) && !alreadyHasSpace)
                 {
                 alreadyHasSpace = true;
                 }
             // this is extra space right after another--get rid of it
-            else if (std::iswspace(text[i]) != 0 && alreadyHasSpace)
+            else if (i18n_string_util::is_space(text[i]) && alreadyHasSpace)
                 {
                 // make sure it isn't a Windows \r\n
                 if (i && !(text[i - 1] == 13 && text[i] == 10))
@@ -1729,7 +1835,7 @@ namespace string_util
                     }
                 }
             // we are starting another word--reset
-            else if (std::iswspace(text[i]) == 0)
+            else if (!i18n_string_util::is_space(text[i]))
                 {
                 alreadyHasSpace = false;
                 }
@@ -12,6 +12,8 @@
  ********************************************************************************/
 
 #include "translation_catalog_review.h"
+#include <algorithm>
+#include <span>
 
 namespace i18n_check
     {
@@ -23,614 +25,773 @@ namespace i18n_check
     void translation_catalog_review::review_strings(const analyze_callback_reset& resetCallback,
                                                     const analyze_callback& callback)
         {
-        std::vector<std::wstring> printfStrings1, printfStrings2;
-        std::wstring errorInfo;
+        // compile the names once, so that each string is only scanned once for all of them
+        const i18n_string_util::whole_word_matcher untranslatableNames{
+            get_untranslatable_names()
+        };
 
-        std::vector<std::wstring> srcResults;
-        std::vector<std::wstring> transResults;
-        std::wsmatch reMatches;
+        // The source checks only look at the source strings and comment, which are the same
+        // for a message in every language's catalog. Those checks are run once for each
+        // unique message, and their results are shared by all the catalogs that have it.
+        std::unordered_map<std::wstring, std::vector<std::pair<translation_issue, std::wstring>>>
+            sourceIssues;
+        std::wstring sourceKey;
 
-        const auto unrollStrings = [](const auto& strs)
-        {
-            std::wstring result;
-            for (const auto& str : strs)
+        // only the entries loaded since the last review need to be reviewed
+        resetCallback(m_catalog_entries.size() - m_reviewed_entry_count);
+        size_t currentCatalogIndex{ 0 };
+        for (auto& catEntry : std::span{ m_catalog_entries }.subspan(m_reviewed_entry_count))
+            {
+            if (!callback(++currentCatalogIndex, std::wstring{}))
                 {
-                result.append(str).append(L"; ");
+                return;
                 }
-            if (result.length() >= 2)
+            get_source_key(catEntry.second, sourceKey);
+            const auto [sourceEntry, isNewSource] = sourceIssues.try_emplace(sourceKey);
+            if (isNewSource)
                 {
-                result.erase(result.length() - 2);
+                review_catalog_entry_source(catEntry.second, sourceEntry->second);
                 }
-            return result;
-        };
+            catEntry.second.m_issues.insert(catEntry.second.m_issues.cend(),
+                                            sourceEntry->second.cbegin(),
+                                            sourceEntry->second.cend());
+            review_catalog_entry_translation(catEntry, untranslatableNames);
+            ++m_reviewed_entry_count;
+            }
+        }
 
-        resetCallback(m_catalog_entries.size());
-        size_t currentCatalogIndex{ 0 };
-        for (auto& catEntry : m_catalog_entries)
+    //------------------------------------------------
+    void translation_catalog_review::clear_file_results(const std::filesystem::path& file)
+        {
+        i18n_review::clear_file_results(file);
+        const auto isFromFile = [&file](const auto& catEntry) { return catEntry.first == file; };
+        m_reviewed_entry_count -= static_cast<size_t>(std::count_if(
+            m_catalog_entries.cbegin(),
+            std::next(m_catalog_entries.cbegin(), static_cast<ptrdiff_t>(m_reviewed_entry_count)),
+            isFromFile));
+        std::erase_if(m_catalog_entries, isFromFile);
+        }
+
+    //------------------------------------------------
+    std::shared_ptr<const plural_forms>
+    translation_catalog_review::load_plural_forms(std::wstring_view headerText,
+                                                  std::wstring_view lineEnd)
+        {
+        constexpr static std::wstring_view PLURAL_FORMS{ L"Plural-Forms:" };
+
+        size_t pluralFormsStart = headerText.find(PLURAL_FORMS);
+        if (pluralFormsStart == std::wstring_view::npos)
             {
-            if (!callback(++currentCatalogIndex, std::wstring{}))
+            return nullptr;
+            }
+        pluralFormsStart += PLURAL_FORMS.length();
+        std::wstring pluralFormsText{ headerText.substr(
+            pluralFormsStart, headerText.find(lineEnd, pluralFormsStart) - pluralFormsStart) };
+        string_util::trim(pluralFormsText);
+
+        const auto [cachedPluralForms, isNew] = m_pluralFormsCache.try_emplace(pluralFormsText);
+        if (isNew)
+            {
+            cachedPluralForms->second = std::make_shared<const plural_forms>(pluralFormsText);
+            }
+        return cachedPluralForms->second;
+        }
+
+    //------------------------------------------------
+    void translation_catalog_review::review_plural_forms(
+        const plural_forms& pluralForms,
+        std::vector<std::pair<translation_issue, std::wstring>>& issues) const
+        {
+        if (!static_cast<bool>(m_review_styles & check_malformed_strings))
+            {
+            return;
+            }
+
+        if (!pluralForms.is_valid())
+            {
+            issues.emplace_back(translation_issue::malformed_translation,
+                                _WXTRANS_WSTR(L"The catalog's Plural-Forms header "
+                                              "could not be read."));
+            return;
+            }
+        if (pluralForms.get_first_out_of_range_number() != plural_forms::npos)
+            {
+            issues.emplace_back(
+                translation_issue::malformed_translation,
+                _WXTRANS_WSTR(L"The catalog's Plural-Forms expression does not select a "
+                              "valid plural form for n = ") +
+                    std::to_wstring(pluralForms.get_first_out_of_range_number()) + L".");
+            }
+        const auto& sampleNumbers = pluralForms.get_sample_numbers();
+        for (size_t i = 0; i < sampleNumbers.size(); ++i)
+            {
+            if (sampleNumbers[i] == plural_forms::npos)
                 {
-                return;
+                issues.emplace_back(
+                    translation_issue::malformed_translation,
+                    L"msgstr[" + std::to_wstring(i) + L"]: " +
+                        _WXTRANS_WSTR(L"plural form is never selected by the catalog's "
+                                      "Plural-Forms expression (for n = 0-1000)."));
                 }
-            if (static_cast<bool>(m_review_styles & check_l10n_strings))
+            }
+        }
+
+    //------------------------------------------------
+    void translation_catalog_review::review_catalog_entry_source(
+        const translation_catalog_entry& entry,
+        std::vector<std::pair<translation_issue, std::wstring>>& issues) const
+        {
+        if (static_cast<bool>(m_review_styles & check_l10n_strings))
+            {
+            if (is_untranslatable_string(entry.m_source, false).first)
                 {
-                if (is_untranslatable_string(catEntry.second.m_source, false).first)
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source);
-                    }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    is_untranslatable_string(catEntry.second.m_source_plural, false).first)
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source_plural);
-                    }
+                issues.emplace_back(translation_issue::suspect_source_issue, entry.m_source);
                 }
-            if (static_cast<bool>(m_review_styles & check_l10n_contains_url))
+            if (!entry.m_source_plural.empty() &&
+                is_untranslatable_string(entry.m_source_plural, false).first)
                 {
-                std::wsmatch results;
+                issues.emplace_back(translation_issue::suspect_source_issue, entry.m_source_plural);
+                }
+            }
+        if (static_cast<bool>(m_review_styles & check_l10n_contains_url))
+            {
+            std::wsmatch results;
 
-                if (std::regex_search(catEntry.second.m_source, results, m_url_email_regex))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source);
-                    }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    std::regex_search(catEntry.second.m_source_plural, results, m_url_email_regex))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::suspect_source_issue,
-                                                          catEntry.second.m_source_plural);
-                    }
+            if (std::regex_search(entry.m_source, results, m_url_email_regex))
+                {
+                issues.emplace_back(translation_issue::suspect_source_issue, entry.m_source);
                 }
-            if (static_cast<bool>(m_review_styles & check_l10n_contains_excessive_nonl10n_content))
+            if (!entry.m_source_plural.empty() &&
+                std::regex_search(entry.m_source_plural, results, m_url_email_regex))
                 {
-                if (const auto [isUntranslatable, translatableContentLength] =
-                        is_untranslatable_string(catEntry.second.m_source, false);
-                    ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0) &&
-                    !isUntranslatable &&
-                    catEntry.second.m_source.length() > (translatableContentLength * 3) &&
-                    catEntry.second.m_comment.empty())
-                    {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::excessive_nonl10n_content, catEntry.second.m_source);
-                    }
+                issues.emplace_back(translation_issue::suspect_source_issue, entry.m_source_plural);
+                }
+            }
+        if (static_cast<bool>(m_review_styles & check_l10n_contains_excessive_nonl10n_content))
+            {
+            if (const auto [isUntranslatable, translatableContentLength] =
+                    is_untranslatable_string(entry.m_source, false);
+                ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0) &&
+                !isUntranslatable && entry.m_source.length() > (translatableContentLength * 3) &&
+                entry.m_comment.empty())
+                {
+                issues.emplace_back(translation_issue::excessive_nonl10n_content, entry.m_source);
+                }
 
-                if (const auto [isUntranslatable, translatableContentLength] =
-                        is_untranslatable_string(catEntry.second.m_source_plural, false);
-                    ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0) &&
-                    !isUntranslatable &&
-                    catEntry.second.m_source_plural.length() > (translatableContentLength * 3) &&
-                    catEntry.second.m_comment.empty())
-                    {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::excessive_nonl10n_content,
-                        catEntry.second.m_source_plural);
-                    }
+            if (const auto [isUntranslatable, translatableContentLength] =
+                    is_untranslatable_string(entry.m_source_plural, false);
+                ((m_review_styles & check_l10n_contains_excessive_nonl10n_content) != 0) &&
+                !isUntranslatable &&
+                entry.m_source_plural.length() > (translatableContentLength * 3) &&
+                entry.m_comment.empty())
+                {
+                issues.emplace_back(translation_issue::excessive_nonl10n_content,
+                                    entry.m_source_plural);
                 }
-            if (static_cast<bool>(m_review_styles & check_l10n_concatenated_strings))
+            }
+        if (static_cast<bool>(m_review_styles & check_l10n_concatenated_strings))
+            {
+            if (has_surrounding_spaces(entry.m_source))
                 {
-                if (has_surrounding_spaces(catEntry.second.m_source))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::concatenation_issue,
-                                                          catEntry.second.m_source);
-                    }
-                if (!catEntry.second.m_source_plural.empty() &&
-                    has_surrounding_spaces(catEntry.second.m_source_plural))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::concatenation_issue,
-                                                          catEntry.second.m_source_plural);
-                    }
+                issues.emplace_back(translation_issue::concatenation_issue, entry.m_source);
                 }
-            if (static_cast<bool>(m_review_styles & check_needing_context))
+            if (!entry.m_source_plural.empty() && has_surrounding_spaces(entry.m_source_plural))
                 {
-                if (catEntry.second.m_comment.empty() &&
-                    is_string_ambiguous(catEntry.second.m_source))
-                    {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::source_needing_context_issue, catEntry.second.m_source);
-                    }
+                issues.emplace_back(translation_issue::concatenation_issue, entry.m_source_plural);
                 }
-            if (static_cast<bool>(m_review_styles & check_multipart_strings))
+            }
+        if (static_cast<bool>(m_review_styles & check_needing_context))
+            {
+            if (entry.m_comment.empty() && is_string_ambiguous(entry.m_source))
                 {
-                if (is_string_multipart(catEntry.second.m_source))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::multipart_string,
-                                                          catEntry.second.m_source);
-                    }
+                issues.emplace_back(translation_issue::source_needing_context_issue,
+                                    entry.m_source);
                 }
-            if (static_cast<bool>(m_review_styles & check_pluralization))
+            }
+        if (static_cast<bool>(m_review_styles & check_multipart_strings))
+            {
+            if (is_string_multipart(entry.m_source))
                 {
-                if (is_string_faux_plural(catEntry.second.m_source))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::pluralization,
-                                                          catEntry.second.m_source);
-                    }
+                issues.emplace_back(translation_issue::multipart_string, entry.m_source);
                 }
-            if (static_cast<bool>(m_review_styles & check_articles_proceeding_placeholder))
+            }
+        if (static_cast<bool>(m_review_styles & check_pluralization))
+            {
+            if (is_string_faux_plural(entry.m_source))
                 {
-                if (is_string_article_issue(catEntry.second.m_source) ||
-                    is_string_pronoun(catEntry.second.m_source))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::article_issue,
-                                                          catEntry.second.m_source);
-                    }
+                issues.emplace_back(translation_issue::pluralization, entry.m_source);
                 }
-            if (static_cast<bool>(m_review_styles & check_mismatching_printf_commands))
+            }
+        if (static_cast<bool>(m_review_styles & check_articles_proceeding_placeholder))
+            {
+            if (is_string_article_issue(entry.m_source) || is_string_pronoun(entry.m_source))
                 {
-                if (catEntry.second.m_po_format == po_format_string::cpp_format)
-                    {
-                    // only look at strings that have a translation
-                    if (!catEntry.second.m_translation.empty())
-                        {
-                        printfStrings1 =
-                            load_cpp_printf_commands(catEntry.second.m_source, errorInfo);
-                        printfStrings2 =
-                            load_cpp_printf_commands(catEntry.second.m_translation, errorInfo);
+                issues.emplace_back(translation_issue::article_issue, entry.m_source);
+                }
+            }
+        }
 
-                        if (!printfStrings1.empty() || !printfStrings2.empty())
-                            {
-                            if (printfStrings1 != printfStrings2)
-                                {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::printf_issue,
-                                    L"'" + catEntry.second.m_source + _WXTRANS_WSTR(L"' vs. '") +
-                                        catEntry.second.m_translation + L"'" + errorInfo);
-                                }
-                            }
-                        }
+    //------------------------------------------------
+    void translation_catalog_review::review_catalog_entry(
+        std::pair<std::filesystem::path, translation_catalog_entry>& catEntry,
+        const i18n_string_util::whole_word_matcher& untranslatableNames) const
+        {
+        review_catalog_entry_source(catEntry.second, catEntry.second.m_issues);
+        review_catalog_entry_translation(catEntry, untranslatableNames);
+        }
 
-                    if (!catEntry.second.m_translation_plural.empty())
-                        {
-                        printfStrings1 =
-                            load_cpp_printf_commands(catEntry.second.m_source_plural, errorInfo);
-                        printfStrings2 = load_cpp_printf_commands(
-                            catEntry.second.m_translation_plural, errorInfo);
+    //------------------------------------------------
+    void translation_catalog_review::review_catalog_entry_translation(
+        std::pair<std::filesystem::path, translation_catalog_entry>& catEntry,
+        const i18n_string_util::whole_word_matcher& untranslatableNames) const
+        {
+        std::vector<std::wstring> printfStrings1, printfStrings2;
+        std::wstring errorInfo;
 
-                        if (!printfStrings1.empty() || !printfStrings2.empty())
+        std::vector<std::wstring> srcResults;
+        std::vector<std::wstring> transResults;
+        std::wsmatch reMatches;
+
+        const auto unrollStrings = [](const auto& strs)
+        {
+            std::wstring result;
+            for (const auto& str : strs)
+                {
+                result.append(str).append(L"; ");
+                }
+            if (result.length() >= 2)
+                {
+                result.erase(result.length() - 2);
+                }
+            return result;
+        };
+
+        if (static_cast<bool>(m_review_styles & check_mismatching_printf_commands))
+            {
+            if (catEntry.second.m_po_format == po_format_string::cpp_format)
+                {
+                // only look at strings that have a translation
+                if (!catEntry.second.m_translation.empty())
+                    {
+                    printfStrings1 =
+                        load_cpp_printf_commands(catEntry.second.m_source, errorInfo);
+                    printfStrings2 =
+                        load_cpp_printf_commands(catEntry.second.m_translation, errorInfo);
+
+                    if (!printfStrings1.empty() || !printfStrings2.empty())
+                        {
+                        if (printfStrings1 != printfStrings2)
                             {
-                            if (printfStrings1 != printfStrings2)
-                                {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::printf_issue,
-                                    L"'" + catEntry.second.m_source_plural +
-                                        _WXTRANS_WSTR(L"' vs. '") +
-                                        catEntry.second.m_translation_plural + L"'" + errorInfo);
-                                }
+                            catEntry.second.m_issues.emplace_back(
+                                translation_issue::printf_issue,
+                                L"'" + catEntry.second.m_source + _WXTRANS_WSTR(L"' vs. '") +
+                                    catEntry.second.m_translation + L"'" + errorInfo);
                             }
                         }
                     }
 
-                if (catEntry.second.m_po_format == po_format_string::qt_format)
+                if (!catEntry.second.m_translation_plural.empty())
                     {
-                    const auto reviewPositionals =
-                        [&catEntry, &printfStrings1, &printfStrings2,
-                         &unrollStrings](const auto& src, const auto& trans)
-                    {
-                        // only look at strings that have a translation
-                        if (!trans.empty())
-                            {
-                            printfStrings1 = load_positional_commands(src);
-                            printfStrings2 = load_positional_commands(trans);
+                    printfStrings1 =
+                        load_cpp_printf_commands(catEntry.second.m_source_plural, errorInfo);
+                    printfStrings2 = load_cpp_printf_commands(
+                        catEntry.second.m_translation_plural, errorInfo);
 
-                            if (!printfStrings1.empty() || !printfStrings2.empty())
-                                {
-                                if (printfStrings1 != printfStrings2)
-                                    {
-                                    catEntry.second.m_issues.emplace_back(
-                                        translation_issue::printf_issue,
-                                        _WXTRANS_WSTR(L"Positional values differences: '") +
-                                            unrollStrings(printfStrings1) +
-                                            _WXTRANS_WSTR(L"' vs. '") +
-                                            unrollStrings(printfStrings2) + L"'");
-                                    }
-                                }
+                    if (!printfStrings1.empty() || !printfStrings2.empty())
+                        {
+                        if (printfStrings1 != printfStrings2)
+                            {
+                            catEntry.second.m_issues.emplace_back(
+                                translation_issue::printf_issue,
+                                L"'" + catEntry.second.m_source_plural +
+                                    _WXTRANS_WSTR(L"' vs. '") +
+                                    catEntry.second.m_translation_plural + L"'" + errorInfo);
                             }
-                    };
-
-                    reviewPositionals(catEntry.second.m_source, catEntry.second.m_translation);
-                    reviewPositionals(catEntry.second.m_source_plural,
-                                      catEntry.second.m_translation_plural);
+                        }
                     }
                 }
 
-            if (static_cast<bool>(m_review_styles & check_accelerators) ||
-                static_cast<bool>(m_review_styles & check_malformed_strings))
+            if (catEntry.second.m_po_format == po_format_string::qt_format)
                 {
-                const auto reviewAccelerators = [&catEntry, &srcResults, &transResults, &reMatches,
-                                                 this](const auto& src, const auto& trans)
+                const auto reviewPositionals =
+                    [&catEntry, &printfStrings1, &printfStrings2,
+                     &unrollStrings](const auto& src, const auto& trans)
                 {
+                    // only look at strings that have a translation
                     if (!trans.empty())
                         {
-                        srcResults.clear();
-                        transResults.clear();
-                        std::wstring::const_iterator searchSrcStart{ src.cbegin() };
-                        std::wstring::const_iterator searchTransStart{ trans.cbegin() };
-                        while (std::regex_search(searchSrcStart, src.cend(), reMatches,
-                                                 m_keyboard_accelerator_regex))
-                            {
-                            srcResults.push_back(reMatches[0]);
-                            searchSrcStart = reMatches.suffix().first;
-                            }
-                        while (std::regex_search(searchTransStart, trans.cend(), reMatches,
-                                                 m_keyboard_accelerator_regex))
-                            {
-                            transResults.push_back(reMatches[0]);
-                            searchTransStart = reMatches.suffix().first;
-                            }
+                        printfStrings1 = load_positional_commands(src);
+                        printfStrings2 = load_positional_commands(trans);
 
-                        if ((srcResults.size() == 1 && transResults.size() != 1) ||
-                            (srcResults.size() != 1 && transResults.size() == 1))
+                        if (!printfStrings1.empty() || !printfStrings2.empty())
                             {
-                            if (static_cast<bool>(m_review_styles & check_accelerators))
-                                {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::accelerator_issue,
-                                    std::wstring{ L"'" }
-                                        .append(src)
-                                        .append(_WXTRANS_WSTR(L"' vs. '"))
-                                        .append(trans)
-                                        .append(L"'"));
-                                }
-                            // if source has an accelerator key but the translation does not,
-                            // but it does have a %, then that probably was meant to be an &
-                            if (static_cast<bool>(m_review_styles & check_malformed_strings) &&
-                                srcResults.size() == 1 && src.find(L'%') == std::wstring::npos &&
-                                trans.find(L'%') != std::wstring::npos)
+                            if (printfStrings1 != printfStrings2)
                                 {
                                 catEntry.second.m_issues.emplace_back(
-                                    translation_issue::malformed_translation,
-                                    std::wstring{ L"'" }
-                                        .append(src)
-                                        .append(_WXTRANS_WSTR(L"' vs. '"))
-                                        .append(trans)
-                                        .append(L"'"));
+                                    translation_issue::printf_issue,
+                                    _WXTRANS_WSTR(L"Positional values differences: '") +
+                                        unrollStrings(printfStrings1) +
+                                        _WXTRANS_WSTR(L"' vs. '") +
+                                        unrollStrings(printfStrings2) + L"'");
                                 }
                             }
                         }
                 };
 
-                reviewAccelerators(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewAccelerators(catEntry.second.m_source_plural,
-                                   catEntry.second.m_translation_plural);
+                reviewPositionals(catEntry.second.m_source, catEntry.second.m_translation);
+                reviewPositionals(catEntry.second.m_source_plural,
+                                  catEntry.second.m_translation_plural);
                 }
+            }
 
-            if (static_cast<bool>(m_review_styles & check_length))
-                {
-                // the length that a translation can be longer than the source
-                const double lengthFactor{ (get_translation_length_threshold() + 100) /
-                                           static_cast<double>(100) };
-                if (catEntry.second.m_source != L"translator-credits" &&
-                    catEntry.second.m_translation.length() >
-                        (catEntry.second.m_source.length() * lengthFactor))
-                    {
-                    catEntry.second.m_issues.emplace_back(translation_issue::length_issue,
-                                                          L"'" + catEntry.second.m_source +
-                                                              _WXTRANS_WSTR(L"' vs. '") +
-                                                              catEntry.second.m_translation + L"'");
-                    }
-
-                if (catEntry.second.m_source_plural != L"translator-credits" &&
-                    catEntry.second.m_translation_plural.length() >
-                        (catEntry.second.m_source_plural.length() * lengthFactor))
+        if (static_cast<bool>(m_review_styles & check_accelerators) ||
+            static_cast<bool>(m_review_styles & check_malformed_strings))
+            {
+            const auto reviewAccelerators = [&catEntry, &srcResults, &transResults, &reMatches,
+                                             this](const auto& src, const auto& trans)
+            {
+                if (!trans.empty())
                     {
-                    catEntry.second.m_issues.emplace_back(
-                        translation_issue::length_issue,
-                        L"'" + catEntry.second.m_source_plural + _WXTRANS_WSTR(L"' vs. '") +
-                            catEntry.second.m_translation_plural + L"'");
-                    }
-                }
-
-            if (static_cast<bool>(m_review_styles & check_halfwidth))
-                {
-                const auto reviewHW = [&catEntry, &srcResults, &transResults,
-                                       &unrollStrings](const auto& src, const auto& trans)
-                {
-                    if (!src.empty())
+                    srcResults.clear();
+                    transResults.clear();
+                    std::wstring::const_iterator searchSrcStart{ src.cbegin() };
+                    std::wstring::const_iterator searchTransStart{ trans.cbegin() };
+                    while (std::regex_search(searchSrcStart, src.cend(), reMatches,
+                                             m_keyboard_accelerator_regex))
                         {
-                        srcResults = load_matches(src, m_halfwidth_range_regex);
-
-                        if (!srcResults.empty())
-                            {
-                            catEntry.second.m_issues.emplace_back(translation_issue::halfwidth,
-                                                                  unrollStrings(srcResults));
-                            }
+                        srcResults.push_back(reMatches[0]);
+                        searchSrcStart = reMatches.suffix().first;
                         }
-
-                    if (!trans.empty())
+                    while (std::regex_search(searchTransStart, trans.cend(), reMatches,
+                                             m_keyboard_accelerator_regex))
                         {
-                        transResults = load_matches(trans, m_halfwidth_range_regex);
+                        transResults.push_back(reMatches[0]);
+                        searchTransStart = reMatches.suffix().first;
+                        }
 
-                        if (!transResults.empty())
+                    if ((srcResults.size() == 1 && transResults.size() != 1) ||
+                        (srcResults.size() != 1 && transResults.size() == 1))
+                        {
+                        if (static_cast<bool>(m_review_styles & check_accelerators))
                             {
-                            catEntry.second.m_issues.emplace_back(translation_issue::halfwidth,
-                                                                  unrollStrings(transResults));
+                            catEntry.second.m_issues.emplace_back(
+                                translation_issue::accelerator_issue,
+                                std::wstring{ L"'" }
+                                    .append(src)
+                                    .append(_WXTRANS_WSTR(L"' vs. '"))
+                                    .append(trans)
+                                    .append(L"'"));
+                            }
+                        // if source has an accelerator key but the translation does not,
+                        // but it does have a %, then that probably was meant to be an &
+                        if (static_cast<bool>(m_review_styles & check_malformed_strings) &&
+                            srcResults.size() == 1 && src.find(L'%') == std::wstring::npos &&
+                            trans.find(L'%') != std::wstring::npos)
+                            {
+                            catEntry.second.m_issues.emplace_back(
+                                translation_issue::malformed_translation,
+                                std::wstring{ L"'" }
+                                    .append(src)
+                                    .append(_WXTRANS_WSTR(L"' vs. '"))
+                                    .append(trans)
+                                    .append(L"'"));
                             }
                         }
-                };
+                    }
+            };
 
-                reviewHW(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewHW(catEntry.second.m_source_plural, catEntry.second.m_translation_plural);
-                }
+            reviewAccelerators(catEntry.second.m_source, catEntry.second.m_translation);
+            reviewAccelerators(catEntry.second.m_source_plural,
+                               catEntry.second.m_translation_plural);
+            }
 
-            if (static_cast<bool>(m_review_styles & check_numbers))
+        if (static_cast<bool>(m_review_styles & check_length))
+            {
+            // the length that a translation can be longer than the source
+            const double lengthFactor{ (get_translation_length_threshold() + 100) /
+                                       static_cast<double>(100) };
+            if (catEntry.second.m_source != L"translator-credits" &&
+                catEntry.second.m_translation.length() >
+                    (catEntry.second.m_source.length() * lengthFactor))
                 {
-                const auto reviewNumbers = [&catEntry, &printfStrings1, &printfStrings2,
-                                            &unrollStrings](auto src, auto trans)
+                catEntry.second.m_issues.emplace_back(translation_issue::length_issue,
+                                                      L"'" + catEntry.second.m_source +
+                                                          _WXTRANS_WSTR(L"' vs. '") +
+                                                          catEntry.second.m_translation + L"'");
+                }
+
+            if (catEntry.second.m_source_plural != L"translator-credits" &&
+                catEntry.second.m_translation_plural.length() >
+                    (catEntry.second.m_source_plural.length() * lengthFactor))
                 {
-                    // only look at strings that have a translation
-                    if (!trans.empty())
+                catEntry.second.m_issues.emplace_back(
+                    translation_issue::length_issue,
+                    L"'" + catEntry.second.m_source_plural + _WXTRANS_WSTR(L"' vs. '") +
+                        catEntry.second.m_translation_plural + L"'");
+                }
+            }
+
+        if (static_cast<bool>(m_review_styles & check_halfwidth))
+            {
+            const auto reviewHW = [&catEntry, &srcResults, &transResults,
+                                   &unrollStrings](const auto& src, const auto& trans)
+            {
+                if (!src.empty())
+                    {
+                    srcResults = load_matches(src, m_halfwidth_range_regex);
+
+                    if (!srcResults.empty())
                         {
-                        std::for_each(src.begin(), src.end(),
-                                      [](wchar_t& chr) { chr = std::towlower(chr); });
-                        std::for_each(trans.begin(), trans.end(),
-                                      [](wchar_t& chr) { chr = std::towlower(chr); });
-                        printfStrings1 = load_numbers(src);
-                        printfStrings2 = load_numbers(trans);
+                        catEntry.second.m_issues.emplace_back(translation_issue::halfwidth,
+                                                              unrollStrings(srcResults));
+                        }
+                    }
 
-                        if (!printfStrings1.empty() || !printfStrings2.empty())
-                            {
-                            if (printfStrings1 != printfStrings2)
-                                {
-                                if (src == L"translator-credits")
-                                    {
-                                    return;
-                                    }
-                                // ignore where source is an imperial measurement and
-                                // translation is metric
-                                if ((src.ends_with(L" in") || src.ends_with(L" inch") ||
-                                     src.ends_with(L" inches")) &&
-                                    (trans.ends_with(L" cm") || trans.ends_with(L" mm")))
-                                    {
-                                    return;
-                                    }
-                                // common word to number translations can be ignored
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"1" &&
-                                    (src.find(L"once") != std::wstring::npos ||
-                                     src.find(L"first") != std::wstring::npos ||
-                                     src.find(L"home") != std::wstring::npos ||
-                                     src.find(L"single") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"2" &&
-                                    (src.find(L"twice") != std::wstring::npos ||
-                                     src.find(L"second") != std::wstring::npos ||
-                                     src.find(L"half") != std::wstring::npos ||
-                                     src.find(L"double") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"3" &&
-                                    (src.find(L"thrice") != std::wstring::npos ||
-                                     src.find(L"third") != std::wstring::npos ||
-                                     src.find(L"triple") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
-                                    printfStrings2[1] == L"3" &&
-                                    src.find(L"third") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"4" &&
-                                    (src.find(L"fourth") != std::wstring::npos ||
-                                     src.find(L"quarter") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
-                                    printfStrings2[1] == L"4" &&
-                                    (src.find(L"fourth") != std::wstring::npos ||
-                                     src.find(L"quarter") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"5" &&
-                                    src.find(L"fifth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"6" &&
-                                    src.find(L"sixth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"7" &&
-                                    src.find(L"seventh") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"8" &&
-                                    src.find(L"eighth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"9" &&
-                                    src.find(L"ninth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"10" &&
-                                    src.find(L"tenth") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
-                                    printfStrings2[1] == L"10" &&
-                                    src.find(L"tenths") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"11" &&
-                                    src.find(L"eleven") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"12" &&
-                                    (src.find(L"twelve") != std::wstring::npos ||
-                                     src.find(L"twelfth") != std::wstring::npos))
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"13" &&
-                                    src.find(L"thirteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"14" &&
-                                    src.find(L"fourteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"15" &&
-                                    src.find(L"fifteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"16" &&
-                                    src.find(L"sixteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"17" &&
-                                    src.find(L"seventeen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"18" &&
-                                    src.find(L"eighteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"19" &&
-                                    src.find(L"nineteen") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                if (printfStrings2.size() == 1 && printfStrings2[0] == L"20" &&
-                                    src.find(L"twent") != std::wstring::npos)
-                                    {
-                                    return;
-                                    }
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::number_issue,
-                                    _WXTRANS_WSTR(L"Number differences: '") +
-                                        unrollStrings(printfStrings1) + _WXTRANS_WSTR(L"' vs. '") +
-                                        unrollStrings(printfStrings2) + L"'");
-                                }
-                            }
+                if (!trans.empty())
+                    {
+                    transResults = load_matches(trans, m_halfwidth_range_regex);
+
+                    if (!transResults.empty())
+                        {
+                        catEntry.second.m_issues.emplace_back(translation_issue::halfwidth,
+                                                              unrollStrings(transResults));
                         }
-                };
+                    }
+            };
 
-                reviewNumbers(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewNumbers(catEntry.second.m_source_plural,
-                              catEntry.second.m_translation_plural);
-                }
+            reviewHW(catEntry.second.m_source, catEntry.second.m_translation);
+            reviewHW(catEntry.second.m_source_plural, catEntry.second.m_translation_plural);
+            }
 
-            if (static_cast<bool>(m_review_styles & check_consistency))
-                {
-                const auto reviewConsistency =
-                    [&catEntry, &srcResults, &transResults](auto src, auto trans)
-                {
-                    if (!src.empty() && !trans.empty())
+        if (static_cast<bool>(m_review_styles & check_numbers))
+            {
+            const auto reviewNumbers = [&catEntry, &printfStrings1, &printfStrings2,
+                                        &unrollStrings](auto src, auto trans)
+            {
+                // only look at strings that have a translation
+                if (!trans.empty())
+                    {
+                    std::for_each(src.begin(), src.end(),
+                                  [](wchar_t& chr) { chr = i18n_string_util::to_lower(chr); });
+                    std::for_each(trans.begin(), trans.end(),
+                                  [](wchar_t& chr) { chr = i18n_string_util::to_lower(chr); });
+                    printfStrings1 = load_numbers(src);
+                    printfStrings2 = load_numbers(trans);
+
+                    if (!printfStrings1.empty() || !printfStrings2.empty())
                         {
-                        const wchar_t lastSrcChar{ src.back() };
-                        const wchar_t lastTransChar{ trans.back() };
-
-                        const bool srcIsStop{ i18n_string_util::is_period(lastSrcChar) ||
-                                              i18n_string_util::is_exclamation(lastSrcChar) ||
-                                              i18n_string_util::is_question(lastSrcChar) };
-                        const bool transIsStop{ i18n_string_util::is_period(lastTransChar) ||
-                                                i18n_string_util::is_exclamation(lastTransChar) ||
-                                                i18n_string_util::is_question(lastTransChar) };
-
-                        if ((std::iswspace(lastSrcChar) && !std::iswspace(lastTransChar)) ||
-                            (!std::iswspace(lastSrcChar) && std::iswspace(lastTransChar)) ||
-                            // note that it is allowable for source to not have full stop, but for
-                            // translation too
-                            (srcIsStop && !transIsStop) ||
-                            // mismatching colons
-                            (i18n_string_util::is_colon(lastSrcChar) &&
-                             !i18n_string_util::is_colon(lastTransChar)) ||
-                            (i18n_string_util::is_colon(lastTransChar) &&
-                             !i18n_string_util::is_colon(lastSrcChar)))
+                        if (printfStrings1 != printfStrings2)
                             {
-                            // if source is an exclamation and the translation is not,
-                            // then that is OK
-                            if ((!i18n_string_util::is_exclamation(lastSrcChar) || transIsStop) &&
-                                // translation ending with ')' is OK also if source has a full stop
-                                !(srcIsStop &&
-                                  i18n_string_util::is_close_parenthesis(lastTransChar)))
+                            if (src == L"translator-credits")
                                 {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::consistency_issue,
-                                    _WXTRANS_WSTR(L"Different ending punctuation."));
+                                return;
+                                }
+                            // ignore where source is an imperial measurement and
+                            // translation is metric
+                            if ((src.ends_with(L" in") || src.ends_with(L" inch") ||
+                                 src.ends_with(L" inches")) &&
+                                (trans.ends_with(L" cm") || trans.ends_with(L" mm")))
+                                {
+                                return;
+                                }
+                            // common word to number translations can be ignored
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"1" &&
+                                (src.find(L"once") != std::wstring::npos ||
+                                 src.find(L"first") != std::wstring::npos ||
+                                 src.find(L"home") != std::wstring::npos ||
+                                 src.find(L"single") != std::wstring::npos))
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"2" &&
+                                (src.find(L"twice") != std::wstring::npos ||
+                                 src.find(L"second") != std::wstring::npos ||
+                                 src.find(L"half") != std::wstring::npos ||
+                                 src.find(L"double") != std::wstring::npos))
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"3" &&
+                                (src.find(L"thrice") != std::wstring::npos ||
+                                 src.find(L"third") != std::wstring::npos ||
+                                 src.find(L"triple") != std::wstring::npos))
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
+                                printfStrings2[1] == L"3" &&
+                                src.find(L"third") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"4" &&
+                                (src.find(L"fourth") != std::wstring::npos ||
+                                 src.find(L"quarter") != std::wstring::npos))
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
+                                printfStrings2[1] == L"4" &&
+                                (src.find(L"fourth") != std::wstring::npos ||
+                                 src.find(L"quarter") != std::wstring::npos))
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"5" &&
+                                src.find(L"fifth") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"6" &&
+                                src.find(L"sixth") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"7" &&
+                                src.find(L"seventh") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"8" &&
+                                src.find(L"eighth") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"9" &&
+                                src.find(L"ninth") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"10" &&
+                                src.find(L"tenth") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 2 && printfStrings2[0] == L"1" &&
+                                printfStrings2[1] == L"10" &&
+                                src.find(L"tenths") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"11" &&
+                                src.find(L"eleven") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"12" &&
+                                (src.find(L"twelve") != std::wstring::npos ||
+                                 src.find(L"twelfth") != std::wstring::npos))
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"13" &&
+                                src.find(L"thirteen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"14" &&
+                                src.find(L"fourteen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"15" &&
+                                src.find(L"fifteen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"16" &&
+                                src.find(L"sixteen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"17" &&
+                                src.find(L"seventeen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"18" &&
+                                src.find(L"eighteen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"19" &&
+                                src.find(L"nineteen") != std::wstring::npos)
+                                {
+                                return;
+                                }
+                            if (printfStrings2.size() == 1 && printfStrings2[0] == L"20" &&
+                                src.find(L"twent") != std::wstring::npos)
+                                {
+                                return;
                                 }
-                            }
-                        else if (std::iswupper(src.front()) && std::iswlower(trans.front()))
-                            {
                             catEntry.second.m_issues.emplace_back(
-                                translation_issue::consistency_issue,
-                                _WXTRANS_WSTR(L"Different casing of first word."));
+                                translation_issue::number_issue,
+                                _WXTRANS_WSTR(L"Number differences: '") +
+                                    unrollStrings(printfStrings1) + _WXTRANS_WSTR(L"' vs. '") +
+                                    unrollStrings(printfStrings2) + L"'");
                             }
+                        }
+                    }
+            };
+
+            reviewNumbers(catEntry.second.m_source, catEntry.second.m_translation);
+            reviewNumbers(catEntry.second.m_source_plural,
+                          catEntry.second.m_translation_plural);
+            }
 
-                        // see if the number of pipe or tabs (not literal, but embedded 't'
-                        // characters) match
-                        static const std::wregex embeddedTabs{ LR"(\\t|\|)" };
-                        srcResults = load_matches(src, embeddedTabs);
-                        transResults = load_matches(trans, embeddedTabs);
-                        if (srcResults.size() != transResults.size())
+        if (static_cast<bool>(m_review_styles & check_consistency))
+            {
+            const auto reviewConsistency =
+                [&catEntry, &srcResults, &transResults, &untranslatableNames](auto src,
+                                                                              auto trans)
+            {
+                if (!src.empty() && !trans.empty())
+                    {
+                    const wchar_t lastSrcChar{ src.back() };
+                    const wchar_t lastTransChar{ trans.back() };
+
+                    const bool srcIsStop{ i18n_string_util::is_period(lastSrcChar) ||
+                                          i18n_string_util::is_exclamation(lastSrcChar) ||
+                                          i18n_string_util::is_question(lastSrcChar) };
+                    const bool transIsStop{ i18n_string_util::is_period(lastTransChar) ||
+                                            i18n_string_util::is_exclamation(lastTransChar) ||
+                                            i18n_string_util::is_question(lastTransChar) };
+
+                    if ((i18n_string_util::is_space(lastSrcChar) &&
+                         !i18n_string_util::is_space(lastTransChar)) ||
+                        (!i18n_string_util::is_space(lastSrcChar) &&
+                         i18n_string_util::is_space(lastTransChar)) ||
+                        // note that it is allowable for source to not have full stop, but for
+                        // translation too
+                        (srcIsStop && !transIsStop) ||
+                        // mismatching colons
+                        (i18n_string_util::is_colon(lastSrcChar) &&
+                         !i18n_string_util::is_colon(lastTransChar)) ||
+                        (i18n_string_util::is_colon(lastTransChar) &&
+                         !i18n_string_util::is_colon(lastSrcChar)))
+                        {
+                        // if source is an exclamation and the translation is not,
+                        // then that is OK
+                        if ((!i18n_string_util::is_exclamation(lastSrcChar) || transIsStop) &&
+                            // translation ending with ')' is OK also if source has a full stop
+                            !(srcIsStop &&
+                              i18n_string_util::is_close_parenthesis(lastTransChar)))
                             {
                             catEntry.second.m_issues.emplace_back(
                                 translation_issue::consistency_issue,
-                                _WXTRANS_WSTR(L"Different number of pipe or tab characters."));
+                                _WXTRANS_WSTR(L"Different ending punctuation."));
                             }
+                        }
+                    else if (i18n_string_util::is_upper(src.front()) &&
+                             i18n_string_util::is_lower(trans.front()))
+                        {
+                        catEntry.second.m_issues.emplace_back(
+                            translation_issue::consistency_issue,
+                            _WXTRANS_WSTR(L"Different casing of first word."));
+                        }
+
+                    // see if the number of pipe or tabs (not literal, but embedded 't'
+                    // characters) match
+                    static const std::wregex embeddedTabs{ LR"(\\t|\|)" };
+                    srcResults = load_matches(src, embeddedTabs);
+                    transResults = load_matches(trans, embeddedTabs);
+                    if (srcResults.size() != transResults.size())
+                        {
+                        catEntry.second.m_issues.emplace_back(
+                            translation_issue::consistency_issue,
+                            _WXTRANS_WSTR(L"Different number of pipe or tab characters."));
+                        }
 
-                        // check for names that shouldn't be translated
-                        for (const auto& unsafeWord : get_untranslatable_names())
+                    // check for names that shouldn't be translated
+                    const auto srcNameCounts = untranslatableNames.count(src);
+                    const auto transNameCounts = srcNameCounts.empty() ?
+                                                     srcNameCounts :
+                                                     untranslatableNames.count(trans);
+                    for (const auto& [nameIndex, srcCount] : srcNameCounts)
+                        {
+                        const auto transNameCount = std::find_if(
+                            transNameCounts.cbegin(), transNameCounts.cend(),
+                            [nameIndex](const auto& nameCount)
+                            { return nameCount.first == nameIndex; });
+                        if (transNameCount == transNameCounts.cend() ||
+                            srcCount > transNameCount->second)
                             {
-                            size_t stcInstanceCount{ 0 };
-                            size_t wordIndex{ 0 };
-                            while (wordIndex != std::wstring::npos)
-                                {
-                                wordIndex =
-                                    string_util::find_whole_word(src, unsafeWord, wordIndex);
-                                if (wordIndex == std::wstring::npos)
-                                    {
-                                    break;
-                                    }
-                                ++stcInstanceCount;
-                                wordIndex += unsafeWord.length();
-                                }
-                            size_t transInstanceCount{ 0 };
-                            wordIndex = 0;
-                            while (wordIndex != std::wstring::npos)
-                                {
-                                wordIndex =
-                                    string_util::find_whole_word(trans, unsafeWord, wordIndex);
-                                if (wordIndex == std::wstring::npos)
-                                    {
-                                    break;
-                                    }
-                                ++transInstanceCount;
-                                wordIndex += unsafeWord.length();
-                                }
-                            if (stcInstanceCount > transInstanceCount)
-                                {
-                                catEntry.second.m_issues.emplace_back(
-                                    translation_issue::consistency_issue,
-                                    L"'" + unsafeWord + L"'" +
-                                        _WXTRANS_WSTR(L" appears more times in the source "
-                                                      "string than in the translation."));
-                                }
+                            catEntry.second.m_issues.emplace_back(
+                                translation_issue::consistency_issue,
+                                L"'" + get_untranslatable_names()[nameIndex] + L"'" +
+                                    _WXTRANS_WSTR(L" appears more times in the source "
+                                                  "string than in the translation."));
                             }
                         }
-                };
+                    }
+            };
 
-                reviewConsistency(catEntry.second.m_source, catEntry.second.m_translation);
-                reviewConsistency(catEntry.second.m_source_plural,
-                                  catEntry.second.m_translation_plural);
+            reviewConsistency(catEntry.second.m_source, catEntry.second.m_translation);
+            reviewConsistency(catEntry.second.m_source_plural,
+                              catEntry.second.m_translation_plural);
+            }
+
+        // review every plural form that the catalog's Plural-Forms header uses,
+        // not just the first two
+        const auto& pluralTranslations = catEntry.second.m_translation_plural_forms;
+        if (catEntry.second.m_plural_forms != nullptr &&
+            catEntry.second.m_plural_forms->is_valid() &&
+            std::any_of(pluralTranslations.cbegin(), pluralTranslations.cend(),
+                        [](const auto& translation) { return !translation.empty(); }))
+            {
+            const auto& sampleNumbers = catEntry.second.m_plural_forms->get_sample_numbers();
+            for (size_t i = 0; i < sampleNumbers.size(); ++i)
+                {
+                // (unused plural forms are reported for the whole catalog)
+                if (sampleNumbers[i] == plural_forms::npos)
+                    {
+                    continue;
+                    }
+                if (i >= pluralTranslations.size() || pluralTranslations[i].empty())
+                    {
+                    if (static_cast<bool>(m_review_styles & check_malformed_strings))
+                        {
+                        catEntry.second.m_issues.emplace_back(
+                            translation_issue::malformed_translation,
+                            L"msgstr[" + std::to_wstring(i) + L"]: " +
+                                _WXTRANS_WSTR(L"missing translation for plural form used for "
+                                              "n = ") +
+                                std::to_wstring(sampleNumbers[i]) + L" ('" +
+                                catEntry.second.m_source_plural + L"').");
+                        }
+                    continue;
+                    }
+                // the first two forms were compared with the source strings already
+                if (i < 2 ||
+                    !static_cast<bool>(m_review_styles & check_mismatching_printf_commands))
+                    {
+                    continue;
+                    }
+                if (catEntry.second.m_po_format == po_format_string::cpp_format)
+                    {
+                    printfStrings1 =
+                        load_cpp_printf_commands(catEntry.second.m_source_plural, errorInfo);
+                    printfStrings2 = load_cpp_printf_commands(pluralTranslations[i], errorInfo);
+                    }
+                else if (catEntry.second.m_po_format == po_format_string::qt_format)
+                    {
+                    printfStrings1 = load_positional_commands(catEntry.second.m_source_plural);
+                    printfStrings2 = load_positional_commands(pluralTranslations[i]);
+                    }
+                else
+                    {
+                    continue;
+                    }
+                // a form only used for one number can spell it out instead (e.g., "one file")
+                if (printfStrings1 != printfStrings2 &&
+                    !(printfStrings2.empty() &&
+                      catEntry.second.m_plural_forms->is_used_by_one_number(i)))
+                    {
+                    catEntry.second.m_issues.emplace_back(
+                        translation_issue::printf_issue,
+                        L"'" + catEntry.second.m_source_plural + _WXTRANS_WSTR(L"' vs. '") +
+                            pluralTranslations[i] + L"'" + errorInfo);
+                    }
                 }
             }
         }
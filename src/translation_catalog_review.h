@@ -20,7 +20,9 @@
 
 #include "i18n_review.h"
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -63,6 +65,36 @@ namespace i18n_check
             return m_untranslatable_names;
             }
 
+        /// @returns @c true if @c issue is from reviewing a catalog entry's source strings,
+        ///     rather than its translations.\n
+        ///     These issues will be the same for a message in every catalog that has it.
+        /// @param issue The issue to review.
+        [[nodiscard]]
+        static constexpr bool is_source_issue(const translation_issue issue) noexcept
+            {
+            return (issue == translation_issue::suspect_source_issue ||
+                    issue == translation_issue::excessive_nonl10n_content ||
+                    issue == translation_issue::concatenation_issue ||
+                    issue == translation_issue::source_needing_context_issue ||
+                    issue == translation_issue::multipart_string ||
+                    issue == translation_issue::pluralization ||
+                    issue == translation_issue::article_issue);
+            }
+
+        /** @brief Builds the key that identifies a message by its source strings and
+                comment, which are the same for the message in every language's catalog.
+            @param entry The catalog entry.
+            @param[out] key The key (which is assigned to, so that its storage can be reused).*/
+        static void get_source_key(const translation_catalog_entry& entry, std::wstring& key)
+            {
+            // (NUL won't appear in a message, so it separates the parts of the key)
+            key.assign(entry.m_source)
+                .append(1, L'\0')
+                .append(entry.m_source_plural)
+                .append(1, L'\0')
+                .append(entry.m_comment);
+            }
+
         /** @brief Reviews the loaded translation catalog entries for issues.
             @param resetCallback Callback function to tell the progress system in @c callback
                 how many items to expect to be processed.
@@ -72,13 +104,77 @@ namespace i18n_check
         void review_strings(const analyze_callback_reset& resetCallback,
                             const analyze_callback& callback) override;
 
+        /// @brief Clears the results, including the loaded catalog entries.
+        void clear_results() override
+            {
+            i18n_review::clear_results();
+            m_catalog_entries.clear();
+            m_reviewed_entry_count = 0;
+            }
+
+        /** @brief Removes the results from a file, including its loaded catalog entries.
+            @details Catalogs loaded after this are reviewed by the next call to
+                review_strings(), without reviewing the other catalogs' entries again.
+            @param file The file to remove the results for.*/
+        void clear_file_results(const std::filesystem::path& file) override;
+
+      protected:
+        /** @brief Reviews a single catalog entry, adding any issues found to it.
+            @param[in,out] catEntry The catalog entry (and the file that it is from).
+            @param untranslatableNames The names from get_untranslatable_names(),
+                compiled for matching.*/
+        void review_catalog_entry(
+            std::pair<std::filesystem::path, translation_catalog_entry>& catEntry,
+            const i18n_string_util::whole_word_matcher& untranslatableNames) const;
+
+        /** @brief Compiles the @c Plural-Forms from a catalog's header.
+            @details Catalogs for the same language usually have the same header,
+                so the compiled forms are cached by their expression.
+            @param headerText The text of the catalog's header entry
+                (i.e., the translation of its empty source string).
+            @param lineEnd What ends each line of the header. This is an escaped
+                newline in PO files and a newline in MO files.
+            @returns The compiled plural forms, or null if the header doesn't have any.*/
+        [[nodiscard]]
+        std::shared_ptr<const plural_forms> load_plural_forms(std::wstring_view headerText,
+                                                              std::wstring_view lineEnd);
+
+        /** @brief Reviews a catalog's plural forms for problems, such as plural forms
+                that are never used.
+            @param pluralForms The catalog's compiled @c Plural-Forms header.
+            @param[out] issues Where to add any issues found.*/
+        void review_plural_forms(
+            const plural_forms& pluralForms,
+            std::vector<std::pair<translation_issue, std::wstring>>& issues) const;
+
       private:
+        /** @brief Reviews the source strings of a catalog entry.
+            @details These checks only look at the source strings and comment,
+                not the translations.
+            @param entry The catalog entry.
+            @param[out] issues Where to add any issues found.*/
+        void review_catalog_entry_source(
+            const translation_catalog_entry& entry,
+            std::vector<std::pair<translation_issue, std::wstring>>& issues) const;
+
+        /** @brief Reviews the translations of a catalog entry against their
+                source strings, adding any issues found to it.
+            @param[in,out] catEntry The catalog entry (and the file that it is from).
+            @param untranslatableNames The names from get_untranslatable_names(),
+                compiled for matching.*/
+        void review_catalog_entry_translation(
+            std::pair<std::filesystem::path, translation_catalog_entry>& catEntry,
+            const i18n_string_util::whole_word_matcher& untranslatableNames) const;
+
         void operator()([[maybe_unused]] std::wstring_view strView,
                         [[maybe_unused]] const std::filesystem::path& filesPath) override
             {
             }
 
         std::vector<std::pair<std::filesystem::path, translation_catalog_entry>> m_catalog_entries;
+        // entries before this were already reviewed (entries loaded later are appended)
+        size_t m_reviewed_entry_count{ 0 };
+        std::unordered_map<std::wstring, std::shared_ptr<const plural_forms>> m_pluralFormsCache;
         static std::vector<std::wstring> m_untranslatable_names;
         };
     } // namespace i18n_check
@@ -0,0 +1,572 @@
+#include "../src/analyze.h"
+#include "../src/analyze_server.h"
+#include "../src/analyze_watcher.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#ifndef _WIN32
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+#ifndef _WIN32
+namespace
+	{
+	// connects to a server's socket (waiting for it to start listening), or returns -1
+	int connect_to_server(const std::filesystem::path& socketPath)
+		{
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		const std::string socketName{ socketPath.string() };
+		std::copy(socketName.cbegin(), socketName.cend(), std::begin(address.sun_path));
+		for (int attempt = 0; attempt < 100; ++attempt)
+			{
+			const int connection{ ::socket(AF_UNIX, SOCK_STREAM, 0) };
+			if (connection >= 0 &&
+				::connect(connection, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+				{
+				// don't wait forever if the server never answers
+				const timeval timeout{ 10, 0 };
+				::setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+				return connection;
+				}
+			if (connection >= 0)
+				{
+				::close(connection);
+				}
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+			}
+		return -1;
+		}
+
+	// reads until the server closes the connection
+	std::string read_response(const int connection)
+		{
+		std::string response;
+		char buffer[1024];
+		ssize_t bytesRead{ 0 };
+		while ((bytesRead = ::recv(connection, buffer, sizeof(buffer), 0)) > 0)
+			{
+			response.append(buffer, static_cast<size_t>(bytesRead));
+			}
+		return response;
+		}
+	}
+#endif
+
+// clang-format off
+TEST_CASE("File buffers", "[analyze]")
+	{
+	SECTION("Records")
+		{
+		const auto buffers = batch_analyze::read_file_buffers("src/a.cpp\n3\nabc\nsrc/b.cpp\n0\n\n");
+		REQUIRE(buffers.size() == 2);
+		CHECK(buffers[0].first == std::filesystem::path{ L"src/a.cpp" });
+		CHECK(buffers[0].second == "abc");
+		CHECK(buffers[1].first == std::filesystem::path{ L"src/b.cpp" });
+		CHECK(buffers[1].second.empty());
+
+		CHECK(batch_analyze::read_file_buffers("").empty());
+		}
+
+	SECTION("Multiple records")
+		{
+		// with and without a newline between the records
+		const auto buffers = batch_analyze::read_file_buffers(
+			"a.cpp\n4\nabc\n\nb.cpp\n3\ndefc.cpp\n2\ngh\n");
+		REQUIRE(buffers.size() == 3);
+		CHECK(buffers[0].first == std::filesystem::path{ L"a.cpp" });
+		CHECK(buffers[0].second == "abc\n");
+		CHECK(buffers[1].first == std::filesystem::path{ L"b.cpp" });
+		CHECK(buffers[1].second == "def");
+		CHECK(buffers[2].first == std::filesystem::path{ L"c.cpp" });
+		CHECK(buffers[2].second == "gh");
+		}
+
+	SECTION("CRLF records")
+		{
+		// the path and length lines can end with CRLF, but the content is kept as-is
+		const auto buffers = batch_analyze::read_file_buffers(
+			"a.cpp\r\n5\r\nab\r\nc\r\nb.cpp\r\n1\r\nd");
+		REQUIRE(buffers.size() == 2);
+		CHECK(buffers[0].first == std::filesystem::path{ L"a.cpp" });
+		CHECK(buffers[0].second == "ab\r\nc");
+		CHECK(buffers[1].first == std::filesystem::path{ L"b.cpp" });
+		CHECK(buffers[1].second == "d");
+		}
+
+	SECTION("Binary content")
+		{
+		// content is read by its length, so embedded NULs and newlines are kept
+		const std::string content{ "a\0b\nc\0", 6 };
+		const auto buffers = batch_analyze::read_file_buffers("a.cpp\n6\n" + content + "\nb.cpp\n1\nd");
+		REQUIRE(buffers.size() == 2);
+		CHECK(buffers[0].second == content);
+		CHECK(buffers[1].second == "d");
+
+		// UTF-16 content isn't decoded until it is analyzed
+		const std::string utf16Content{ "\xFF\xFE" "a\0\n\0", 6 };
+		const auto utf16Buffers = batch_analyze::read_file_buffers("a.cpp\n6\n" + utf16Content);
+		REQUIRE(utf16Buffers.size() == 1);
+		CHECK(utf16Buffers[0].second == utf16Content);
+		bool startsWithBom{ false };
+		CHECK(decode_content(utf16Buffers[0].second, startsWithBom).second == L"a\n");
+		}
+
+	SECTION("UTF-8 paths")
+		{
+		const auto buffers = batch_analyze::read_file_buffers("caf\xC3\xA9" ".cpp\n1\na");
+		REQUIRE(buffers.size() == 1);
+		CHECK(buffers[0].first.u8string() == u8"caf\u00E9.cpp");
+		}
+
+	SECTION("Malformed records")
+		{
+		// missing the length or the content
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp"), std::runtime_error);
+		// lengths that aren't a number of bytes
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\nabc\nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n-1\nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n\nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n 3\nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n3 \nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n99999999999999999999999\nabc"),
+			std::runtime_error);
+		// content that is shorter than its length
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n10\nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n1\n"), std::runtime_error);
+		// a second record that is truncated
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("src/a.cpp\n1\na\nsrc/b.cpp\n3\nab"),
+			std::runtime_error);
+		// an empty path
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("\n3\nabc"), std::runtime_error);
+		CHECK_THROWS_AS(batch_analyze::read_file_buffers("\r\n3\r\nabc"), std::runtime_error);
+		}
+
+	SECTION("Decode content")
+		{
+		bool startsWithBom{ false };
+		auto [isUtf8, text] = decode_content("abc\nd\xC3\xA9" "f", startsWithBom);
+		CHECK(isUtf8);
+		CHECK_FALSE(startsWithBom);
+		CHECK(text == L"abc\nd\u00E9f\n");
+
+		// the signature is kept, like when reading a file
+		std::tie(isUtf8, text) = decode_content("\xEF\xBB\xBF" "abc\n", startsWithBom);
+		CHECK(isUtf8);
+		CHECK(startsWithBom);
+		CHECK(text == L"\uFEFFabc\n");
+
+		std::tie(isUtf8, text) = decode_content("", startsWithBom);
+		CHECK(isUtf8);
+		CHECK(text.empty());
+
+		const std::string utf16Content{ "\xFF\xFE" "a\0b\0", 6 };
+		std::tie(isUtf8, text) = decode_content(utf16Content, startsWithBom);
+		CHECK_FALSE(isUtf8);
+		CHECK_FALSE(startsWithBom);
+		CHECK(text == L"ab");
+
+		std::tie(isUtf8, text) = decode_content("d\xE9" "f", startsWithBom);
+		CHECK_FALSE(isUtf8);
+		CHECK(text == L"d\u00E9f");
+		}
+
+	SECTION("Analyze buffers")
+		{
+		cpp_i18n_review cpp(false);
+		rc_file_review rc(false);
+		po_file_review po(false);
+		mo_file_review mo(false);
+		csharp_i18n_review csharp(false);
+		info_plist_file_review infoPlist(false);
+		quarto_review quarto;
+		batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quarto);
+
+		const std::string source{ "auto str = _(L\"Visit www.example.com for more information.\");\n" };
+		analyzer.analyze_buffers({ { L"unsaved/editor.cpp", source } }, [](const size_t) {},
+			[](const size_t, const std::filesystem::path&) { return true; });
+		REQUIRE(cpp.get_localizable_strings_with_urls().size() == 1);
+		CHECK(cpp.get_localizable_strings_with_urls()[0].m_file_name == std::filesystem::path{ L"unsaved/editor.cpp" });
+		CHECK(cpp.get_localizable_strings_with_urls()[0].m_line == 1);
+
+		// each batch replaces the previous one
+		analyzer.analyze_buffers({ { L"unsaved/other.cpp", "int val = 5;\n" } }, [](const size_t) {},
+			[](const size_t, const std::filesystem::path&) { return true; });
+		CHECK(cpp.get_localizable_strings_with_urls().empty());
+
+		// files that aren't a supported type aren't reviewed as source code
+		analyzer.analyze_buffers({ { L"unsaved/notes.txt", source }, { L"unsaved/Makefile", source } },
+			[](const size_t) {}, [](const size_t, const std::filesystem::path&) { return true; });
+		CHECK(cpp.get_localizable_strings_with_urls().empty());
+		}
+
+	SECTION("Cache hit rates")
+		{
+		cpp_i18n_review cpp(true);
+		rc_file_review rc(true);
+		po_file_review po(true);
+		mo_file_review mo(true);
+		csharp_i18n_review csharp(true);
+		info_plist_file_review infoPlist(true);
+		quarto_review quarto;
+		batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quarto);
+
+		const std::string source{ "auto str = _(L\"Open the file.\");\nauto str2 = _(L\"Open the file.\");\n" };
+		const std::string csharpSource{ "var str = \"Open the file.\";\nvar str2 = \"Open the file.\";\n" };
+		analyzer.analyze_buffers({ { L"unsaved/editor.cpp", source }, { L"unsaved/editor.cs", csharpSource } },
+			[](const size_t) {}, [](const size_t, const std::filesystem::path&) { return true; });
+		REQUIRE(cpp.get_string_classification_lookups() > 0);
+		REQUIRE(csharp.get_string_classification_lookups() > 0);
+		// each type of source file reports its own rate
+		const std::wstring summary{ analyzer.format_summary(true).str() };
+		CHECK(summary.find(L"String check cache hit rate within C/C++ source files: ") != std::wstring::npos);
+		CHECK(summary.find(L"String check cache hit rate within C# source files: ") != std::wstring::npos);
+		}
+	}
+
+TEST_CASE("Analyze changes", "[analyze]")
+	{
+	const std::filesystem::path folder{ std::filesystem::temp_directory_path() / L"quneiform-analyze-changes" };
+	std::filesystem::remove_all(folder);
+	std::filesystem::create_directories(folder);
+	const auto writeFile = [&folder](const std::wstring& name, const std::string& content)
+		{
+		std::ofstream(folder / name) << content;
+		return folder / name;
+		};
+	const auto appFile = writeFile(L"app.cpp", "wxIMPLEMENT_APP(MyApp);\nbool MyApp::OnInit()\n    {\n    return true;\n    }\n");
+	const auto localeFile = writeFile(L"locale.cpp", "void InitLocale()\n    {\n    wxUILocale::UseDefault();\n    }\n");
+	const auto stringsFile = writeFile(L"strings.cpp", "auto str = _(L\"Visit www.example.com for more information.\");\n");
+
+	cpp_i18n_review cpp(false);
+	rc_file_review rc(false);
+	po_file_review po(false);
+	mo_file_review mo(false);
+	csharp_i18n_review csharp(false);
+	info_plist_file_review infoPlist(false);
+	quarto_review quarto;
+	batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quarto);
+	const auto resetCallback = [](const size_t) {};
+	const auto callback = [](const size_t, const std::filesystem::path&) { return true; };
+	const auto uiLocaleWarningCount = [&cpp]()
+		{
+		return std::count_if(cpp.get_suspect_i18n_usage().cbegin(), cpp.get_suspect_i18n_usage().cend(),
+			[](const auto& str) { return str.m_usage.m_value.starts_with(L"wxUILocale::UseDefault()"); });
+		};
+
+	analyzer.analyze({ appFile, localeFile, stringsFile }, resetCallback, callback);
+	CHECK(uiLocaleWarningCount() == 0);
+	REQUIRE(cpp.get_localizable_strings_with_urls().size() == 1);
+
+	SECTION("Removed files")
+		{
+		// the file that initialized the locale is gone, so OnInit() is reported now
+		analyzer.analyze_changes({}, { localeFile }, resetCallback, callback);
+		CHECK(uiLocaleWarningCount() == 1);
+		CHECK(cpp.get_localizable_strings_with_urls().size() == 1);
+
+		analyzer.analyze_changes({}, { stringsFile }, resetCallback, callback);
+		CHECK(cpp.get_localizable_strings_with_urls().empty());
+		CHECK(uiLocaleWarningCount() == 1);
+
+		// and is no longer reported once it is added back
+		analyzer.analyze_changes({ localeFile }, {}, resetCallback, callback);
+		CHECK(uiLocaleWarningCount() == 0);
+		}
+
+	SECTION("Added and changed files")
+		{
+		const auto addedFile = writeFile(L"added.cpp", "auto str = _(L\"See www.example.org to learn more.\");\n");
+		analyzer.analyze_changes({ addedFile }, {}, resetCallback, callback);
+		// the unchanged file's results are kept (and not reviewed again)
+		REQUIRE(cpp.get_localizable_strings_with_urls().size() == 2);
+		CHECK(cpp.get_localizable_strings_with_urls()[0].m_file_name == stringsFile);
+		CHECK(cpp.get_localizable_strings_with_urls()[1].m_file_name == addedFile);
+		CHECK(uiLocaleWarningCount() == 0);
+
+		// the locale is no longer initialized in the changed file
+		writeFile(L"locale.cpp", "void InitLocale()\n    {\n    }\n");
+		analyzer.analyze_changes({ localeFile }, {}, resetCallback, callback);
+		CHECK(uiLocaleWarningCount() == 1);
+		CHECK(cpp.get_localizable_strings_with_urls().size() == 2);
+		}
+
+	std::filesystem::remove_all(folder);
+	}
+
+TEST_CASE("Catalog results by message", "[analyze]")
+	{
+	cpp_i18n_review cpp(false);
+	rc_file_review rc(false);
+	po_file_review po(false);
+	mo_file_review mo(false);
+	csharp_i18n_review csharp(false);
+	info_plist_file_review infoPlist(false);
+	quarto_review quarto;
+	batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quarto);
+	analyzer.group_catalog_results_by_message(true);
+
+	const std::string header{ "msgid \"\"\nmsgstr \"\"\n\"Content-Type: text/plain; charset=UTF-8\\n\"\n" };
+	const std::string message{ "\n#: ../src/help.cpp:12\nmsgid \"Visit www.example.com for more information.\"\nmsgstr \"www.example.com\"\n" };
+	const std::string commentedMessage{ "\n#. Shown on the help page\n#: ../src/help.cpp:30\nmsgid \"Visit www.example.com for more information.\"\nmsgstr \"www.example.com\"\n" };
+	// the Spanish catalog has the message twice, along with a commented one
+	analyzer.analyze_buffers({ { L"es.po", header + message + message + commentedMessage },
+							   { L"fr.po", header + message } },
+		[](const size_t) {}, [](const size_t, const std::filesystem::path&) { return true; });
+	const std::wstring results{ analyzer.format_results().str() };
+
+	// the message is reported once, counting the catalogs that have it (rather than its entries)
+	CHECK(results.find(L"(Catalogs with this issue: 2)") != std::wstring::npos);
+	CHECK(results.find(L"Catalogs with this issue: 3") == std::wstring::npos);
+	CHECK(results.find(L"Catalogs with this issue: 4") == std::wstring::npos);
+	// the commented message has the same source strings, but is its own message
+	size_t sourceIssueRows{ 0 };
+	for (size_t position = results.find(L"[suspectL10NString]"); position != std::wstring::npos;
+		 position = results.find(L"[suspectL10NString]", position + 1))
+		{
+		++sourceIssueRows;
+		}
+	CHECK(sourceIssueRows == 2);
+	}
+
+TEST_CASE("Watcher results diff", "[analyze]")
+	{
+	const std::wstring header{ L"File\tLine\tColumn\tValue\tExplanation\tWarning ID\n" };
+	const std::wstring previousResults{ header +
+		L"a.cpp\t3\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+		L"a.cpp\t8\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+		L"b.cpp\t1\t1\t\"Goodbye\"\t\"Explanation\"\t[suspectL10NString]\n" };
+
+	SECTION("No changes")
+		{
+		CHECK(analyze_watcher::format_results_diff(previousResults, previousResults).empty());
+		CHECK(analyze_watcher::format_results_diff(L"", L"").empty());
+		}
+
+	SECTION("Moved rows")
+		{
+		// lines added above the issues only change their positions
+		const std::wstring currentResults{ header +
+			L"a.cpp\t4\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+			L"a.cpp\t9\t7\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+			L"b.cpp\t1\t1\t\"Goodbye\"\t\"Explanation\"\t[suspectL10NString]\n" };
+		CHECK(analyze_watcher::format_results_diff(previousResults, currentResults).empty());
+		}
+
+	SECTION("Added and removed rows")
+		{
+		const std::wstring currentResults{ header +
+			L"a.cpp\t4\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+			L"a.cpp\t9\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+			L"c.cpp\t2\t3\t\"Welcome\"\t\"Explanation\"\t[suspectL10NString]\n" };
+		// new rows have their current position, removed ones have none
+		CHECK(analyze_watcher::format_results_diff(previousResults, currentResults) ==
+			L"+\tc.cpp\t2\t3\t\"Welcome\"\t\"Explanation\"\t[suspectL10NString]\n"
+			L"-\tb.cpp\t\t\t\"Goodbye\"\t\"Explanation\"\t[suspectL10NString]\n");
+		}
+
+	SECTION("Repeated rows")
+		{
+		// one of the two occurrences was fixed
+		std::wstring currentResults{ header +
+			L"a.cpp\t3\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n"
+			L"b.cpp\t1\t1\t\"Goodbye\"\t\"Explanation\"\t[suspectL10NString]\n" };
+		CHECK(analyze_watcher::format_results_diff(previousResults, currentResults) ==
+			L"-\ta.cpp\t\t\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n");
+
+		// a third occurrence was added
+		currentResults = previousResults +
+			L"a.cpp\t12\t1\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n";
+		CHECK(analyze_watcher::format_results_diff(previousResults, currentResults) ==
+			L"+\ta.cpp\t12\t1\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n");
+
+		// the same issue in another file is a different row
+		currentResults = previousResults +
+			L"d.cpp\t3\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n";
+		CHECK(analyze_watcher::format_results_diff(previousResults, currentResults) ==
+			L"+\td.cpp\t3\t5\t\"Hello\"\t\"Explanation\"\t[suspectL10NString]\n");
+		}
+	}
+
+TEST_CASE("Analyze server", "[analyze]")
+	{
+	cpp_i18n_review cpp(false);
+	rc_file_review rc(false);
+	po_file_review po(false);
+	mo_file_review mo(false);
+	csharp_i18n_review csharp(false);
+	info_plist_file_review infoPlist(false);
+	quarto_review quarto;
+	batch_analyze analyzer(&cpp, &rc, &po, &mo, &csharp, &infoPlist, &quarto);
+
+	size_t rescanCount{ 0 };
+	analyze_server server(analyzer,
+		input_filter{ std::filesystem::temp_directory_path() / L"quneiform-server-tests",
+					  { L"ignored" }, {} },
+		std::vector<std::filesystem::path>{},
+		[&rescanCount]()
+		{
+			++rescanCount;
+			return std::vector<std::filesystem::path>{};
+		});
+
+	SECTION("Buffers")
+		{
+		const std::string source{ "auto str = _(L\"Visit www.example.com for more information.\");\n" };
+		const std::string response{ server.handle_request("buffers\nunsaved/editor.cpp\n" +
+			std::to_string(source.length()) + "\n" + source) };
+		CHECK_THAT(response, StartsWith("ok\n"));
+		CHECK_THAT(response, ContainsSubstring("unsaved/editor.cpp"));
+		CHECK_THAT(response, ContainsSubstring("[urlInL10NString]"));
+		}
+
+	SECTION("Buffers that wouldn't be analyzed")
+		{
+		const std::string source{ "auto str = _(L\"Visit www.example.com for more information.\");\n" };
+		const std::string record{ std::to_string(source.length()) + "\n" + source };
+		const std::string response{ server.handle_request("buffers\nunsaved/notes.txt\n" + record +
+			"ignored/editor.cpp\n" + record + "unsaved/editor.cpp\n" + record) };
+		CHECK_THAT(response, StartsWith("ok\n"));
+		CHECK_THAT(response, ContainsSubstring("unsaved/editor.cpp"));
+		CHECK_THAT(response, !ContainsSubstring("notes.txt"));
+		CHECK_THAT(response, !ContainsSubstring("ignored/editor.cpp"));
+		}
+
+	SECTION("Malformed buffers")
+		{
+		CHECK_THAT(server.handle_request("buffers\nunsaved/editor.cpp\nxyz\n"), StartsWith("error\t"));
+		CHECK_THAT(server.handle_request("buffers\nunsaved/editor.cpp\n100\nabc"), StartsWith("error\t"));
+		}
+
+	SECTION("Analyze")
+		{
+		// no files listed and none in the input folder
+		const std::string response{ server.handle_request("analyze\r\n") };
+		CHECK_THAT(response, StartsWith("ok\n"));
+		CHECK_THAT(response, !ContainsSubstring("[urlInL10NString]"));
+		}
+
+	SECTION("Analyze files that wouldn't be analyzed")
+		{
+		const std::filesystem::path inputFolder{ std::filesystem::temp_directory_path() /
+												 L"quneiform-server-tests" };
+		std::filesystem::create_directories(inputFolder / L"ignored");
+		const std::string source{ "auto str = _(L\"Visit www.example.com for more information.\");\n" };
+		std::ofstream(inputFolder / L"editor.cpp") << source;
+		std::ofstream(inputFolder / L"notes.txt") << source;
+		std::ofstream(inputFolder / L"ignored" / L"editor.cpp") << source;
+
+		// relative paths are relative to the input folder, and are filtered like buffers
+		std::string response{ server.handle_request(
+			"analyze\nnotes.txt\nignored/editor.cpp\neditor.cpp\n") };
+		CHECK_THAT(response, StartsWith("ok\n"));
+		CHECK_THAT(response, ContainsSubstring("editor.cpp"));
+		CHECK_THAT(response, ContainsSubstring("[urlInL10NString]"));
+		CHECK_THAT(response, !ContainsSubstring("notes.txt"));
+		CHECK_THAT(response, !ContainsSubstring("ignored"));
+
+		// listing only excluded files doesn't analyze every file instead
+		analyze_server serverWithFiles(analyzer, input_filter{ inputFolder, { L"ignored" }, {} },
+			std::vector<std::filesystem::path>{ inputFolder / L"editor.cpp" },
+			[]() { return std::vector<std::filesystem::path>{}; });
+		response = serverWithFiles.handle_request("analyze\nnotes.txt\n");
+		CHECK_THAT(response, StartsWith("ok\n"));
+		CHECK_THAT(response, !ContainsSubstring("[urlInL10NString]"));
+		CHECK_THAT(serverWithFiles.handle_request("analyze\n"), ContainsSubstring("[urlInL10NString]"));
+
+		std::filesystem::remove_all(inputFolder);
+		}
+
+	SECTION("Rescan and shutdown")
+		{
+		CHECK(server.handle_request("rescan\n") == "ok\n");
+		CHECK(rescanCount == 1);
+		CHECK_FALSE(server.is_shutdown_requested());
+		CHECK(server.handle_request("shutdown") == "ok\n");
+		CHECK(server.is_shutdown_requested());
+		}
+
+	SECTION("Unknown request")
+		{
+		CHECK(server.handle_request("bogus\n") == "error\tUnknown request: bogus\n");
+		CHECK(server.handle_request("") == "error\tUnknown request: \n");
+		}
+
+#ifndef _WIN32
+	SECTION("Socket path is not a socket")
+		{
+		const std::filesystem::path filePath{ std::filesystem::temp_directory_path() /
+											  L"quneiform-not-a-socket.txt" };
+		std::ofstream(filePath) << "keep me";
+		// capture the error, rather than mixing wide and narrow output on the console
+		std::wostringstream errorOutput;
+		auto* const consoleBuffer = std::wcout.rdbuf(errorOutput.rdbuf());
+		const bool served{ server.serve(filePath) };
+		std::wcout.rdbuf(consoleBuffer);
+		CHECK_FALSE(served);
+		CHECK(errorOutput.str().find(L"is not a socket") != std::wstring::npos);
+		CHECK(std::filesystem::is_regular_file(filePath));
+		std::filesystem::remove(filePath);
+		}
+
+	SECTION("Stalled and disconnected clients")
+		{
+		const std::filesystem::path socketPath{ std::filesystem::temp_directory_path() /
+												L"quneiform-server-tests.sock" };
+		server.set_request_timeout(std::chrono::milliseconds{ 200 });
+		bool served{ false };
+		std::thread serverThread([&server, &socketPath, &served]() { served = server.serve(socketPath); });
+
+		// a client that never finishes its request is dropped without a response
+		const int stalledConnection{ connect_to_server(socketPath) };
+		CHECK(stalledConnection >= 0);
+		if (stalledConnection >= 0)
+			{
+			const auto start{ std::chrono::steady_clock::now() };
+			CHECK(::send(stalledConnection, "analyze\n", 8, 0) == 8);
+			CHECK(read_response(stalledConnection).empty());
+			CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds{ 5 });
+			::close(stalledConnection);
+			}
+
+		// a client that leaves before its response shouldn't stop the server
+		// (or the process, from writing to the closed connection)
+		const int closedConnection{ connect_to_server(socketPath) };
+		CHECK(closedConnection >= 0);
+		if (closedConnection >= 0)
+			{
+			CHECK(::send(closedConnection, "analyze\n", 8, 0) == 8);
+			::shutdown(closedConnection, SHUT_WR);
+			::close(closedConnection);
+			}
+
+		// the server still answers the next client
+		const int connection{ connect_to_server(socketPath) };
+		CHECK(connection >= 0);
+		if (connection >= 0)
+			{
+			CHECK(::send(connection, "shutdown\n", 9, 0) == 9);
+			::shutdown(connection, SHUT_WR);
+			CHECK(read_response(connection) == "ok\n");
+			::close(connection);
+			}
+		serverThread.join();
+		CHECK(served);
+		CHECK_FALSE(std::filesystem::exists(socketPath));
+		}
+#endif
+	}
+// clang-format on
+// NOLINTEND
@@ -197,6 +197,27 @@ str.LoadString(ID);
         cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
         CHECK(cpp.get_suspect_i18n_usage().size() == 2);
         }
+    SECTION("LoadString and non-literals")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(check_suspect_i18n_usage);
+        const wchar_t* code = LR"(auto label = _(userName);
+::LoadStringW(hInst, IDS_TITLE, buffer, 256);
+MyLoadString(hInst, IDS_TITLE, buffer, 256);
+_LoadString(hInst, IDS_TITLE, buffer, 256);
+auto msg = wxPLURAL(fileCount, "files", n);)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_suspect_i18n_usage().size() == 3);
+        // ::LoadString() results come first
+        CHECK(cpp.get_suspect_i18n_usage().at(0).m_string ==
+              std::wstring{ L"::LoadStringW(hInst, IDS_TITLE, buffer, 256)" });
+        CHECK(cpp.get_suspect_i18n_usage().at(0).m_line == 2);
+        CHECK(cpp.get_suspect_i18n_usage().at(1).m_string == std::wstring{ L"userName" });
+        CHECK(cpp.get_suspect_i18n_usage().at(1).m_line == 1);
+        CHECK(cpp.get_suspect_i18n_usage().at(2).m_string == std::wstring{ L"fileCount" });
+        CHECK(cpp.get_suspect_i18n_usage().at(2).m_line == 5);
+        }
     }
 
 TEST_CASE("<<", "[cpp][i18n]")
@@ -362,6 +383,63 @@ TEST_CASE("Raw Strings", "[cpp][i18n]")
         }
     }
 
+TEST_CASE("Text views", "[cpp][i18n]")
+    {
+    // the code is a view into part of a larger buffer, so nothing after it should be read
+    const auto codeUpTo = [](const std::wstring& buffer, const std::wstring_view end)
+        { return std::wstring_view{ buffer }.substr(0, buffer.find(end) + end.length()); };
+
+    SECTION("Statement")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring buffer{ L"auto var = _(L\"Hello world\");\nauto other = L\"Goodbye cruel world\";" };
+        cpp(codeUpTo(buffer, L");"), L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_localizable_strings().size() == 1);
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    SECTION("Unterminated string")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring buffer{ L"auto var = L\"Hello world\";" };
+        cpp(codeUpTo(buffer, L"Hello"), L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    SECTION("Unterminated raw string")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring buffer{ L"auto var = LR\"(Hello world)\";" };
+        cpp(codeUpTo(buffer, L"Hello"), L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    SECTION("Line comment")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring buffer{ L"// some comment\nauto var = L\"Hello world\";" };
+        cpp(codeUpTo(buffer, L"comment"), L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    SECTION("Define")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring buffer{ L"#define GREETING \"Hello world\"\n" };
+        cpp(codeUpTo(buffer, L"Hello"), L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    SECTION("Assembly")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring buffer{ L"int i = 0;\nasm (\"movl $1, %eax\");\nauto var = L\"Hello world\";" };
+        cpp(codeUpTo(buffer, L"movl"), L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_not_available_for_localization_strings().size() == 0);
+        }
+    }
+
 TEST_CASE("QLabel", "[cpp][i18n][qt]")
     {
     cpp_i18n_review cpp(false);
@@ -441,6 +519,140 @@ void TestCLass::TestCase2()
     CHECK(cpp.get_internal_strings()[7].m_usage.m_value == std::wstring{ L"QApplication::trUtf8" });
     }
 
+TEST_CASE("Sibling string arguments", "[cpp][i18n]")
+    {
+    cpp_i18n_review cpp(false);
+    cpp.set_style(review_style::all_i18n_checks);
+    const wchar_t* code = LR"(void Setup()
+    {
+    SetLabels(L"First label here", L"Second label here",
+              L"Third label here");
+    const wchar_t* names[] = { L"Alpha value here", L"Beta value here" };
+    })";
+    cpp(code, L"");
+    cpp.review_strings([](size_t) {},
+                       [](size_t, const std::filesystem::path&) { return true; });
+
+    REQUIRE(cpp.get_not_available_for_localization_strings().size() == 5);
+    CHECK(cpp.get_not_available_for_localization_strings()[0].m_string == std::wstring{ L"First label here" });
+    CHECK(cpp.get_not_available_for_localization_strings()[0].m_usage.m_value == std::wstring{ L"SetLabels" });
+    CHECK(cpp.get_not_available_for_localization_strings()[1].m_string == std::wstring{ L"Second label here" });
+    CHECK(cpp.get_not_available_for_localization_strings()[1].m_usage.m_value == std::wstring{ L"SetLabels" });
+    CHECK(cpp.get_not_available_for_localization_strings()[2].m_string == std::wstring{ L"Third label here" });
+    CHECK(cpp.get_not_available_for_localization_strings()[2].m_usage.m_value == std::wstring{ L"SetLabels" });
+    CHECK(cpp.get_not_available_for_localization_strings()[2].m_line == 4);
+    CHECK(cpp.get_not_available_for_localization_strings()[3].m_string == std::wstring{ L"Alpha value here" });
+    CHECK(cpp.get_not_available_for_localization_strings()[3].m_usage.m_value == std::wstring{ L"names" });
+    CHECK(cpp.get_not_available_for_localization_strings()[4].m_string == std::wstring{ L"Beta value here" });
+    CHECK(cpp.get_not_available_for_localization_strings()[4].m_usage.m_value == std::wstring{ L"names" });
+    }
+
+TEST_CASE("Large initializer lists", "[cpp][i18n]")
+    {
+    // Loads a list of the given number of strings (either plain or inside
+    // nested braces) and checks how far the strings' backward scans went.
+    // Each string is connected to the variable by scanning backwards, which
+    // (if earlier scans aren't reused) makes loading quadratic. With reuse,
+    // each scan only steps back to where the previous string's scan went.
+    const auto loadList = [](const size_t itemCount, const bool nested)
+        {
+        std::wstring code{ L"const wchar_t* names[] = {\n" };
+        for (size_t i = 0; i < itemCount; ++i)
+            {
+            code += nested ? L"{ L\"Alpha value here\", 1 },\n" : L"L\"Alpha value here\",\n";
+            }
+        code += L"};\n";
+
+        cpp_i18n_review cpp(false);
+        cpp(code, L"");
+        REQUIRE(cpp.get_not_available_for_localization_strings().size() == itemCount);
+        CHECK(cpp.get_not_available_for_localization_strings().back().m_usage.m_value ==
+              std::wstring{ L"names" });
+        CHECK(cpp.get_not_available_for_localization_strings().back().m_line == itemCount + 1);
+        CHECK(cpp.get_backward_scan_steps() < code.length() * 2);
+        return cpp.get_backward_scan_steps();
+        };
+
+    // quadrupling the list should take four times as many steps, not sixteen
+    SECTION("Plain strings")
+        {
+        const size_t smallList{ loadList(1'000, false) };
+        const size_t largeList{ loadList(4'000, false) };
+        CHECK(largeList < smallList * 5);
+        }
+
+    SECTION("Nested braces")
+        {
+        const size_t smallList{ loadList(1'000, true) };
+        const size_t largeList{ loadList(4'000, true) };
+        CHECK(largeList < smallList * 5);
+        }
+
+    SECTION("Steps are reset")
+        {
+        cpp_i18n_review cpp(false);
+        cpp(L"const wchar_t* names[] = { L\"Alpha value here\" };", L"");
+        CHECK(cpp.get_backward_scan_steps() > 0);
+        cpp.clear_results();
+        CHECK(cpp.get_backward_scan_steps() == 0);
+        }
+    }
+
+TEST_CASE("Repeated strings", "[cpp][i18n]")
+    {
+    cpp_i18n_review cpp(false);
+    cpp.set_style(static_cast<review_style>(check_l10n_strings | check_l10n_contains_url));
+    const wchar_t* code = LR"(void Setup()
+    {
+    SetLabel(_("Contact us at www.company.com"));
+    SetTitle(_("Contact us at www.company.com"));
+    SetStatus(_("Contact us by phone"));
+    })";
+    cpp(code, L"");
+    cpp.review_strings([](size_t) {},
+                       [](size_t, const std::filesystem::path&) { return true; });
+
+    REQUIRE(cpp.get_localizable_strings_with_urls().size() == 2);
+    CHECK(cpp.get_localizable_strings_with_urls()[0].m_line == 3);
+    CHECK(cpp.get_localizable_strings_with_urls()[1].m_line == 4);
+    // the second occurrence's untranslatable and URL verdicts are reused
+    CHECK(cpp.get_string_classification_lookups() == 6);
+    CHECK(cpp.get_string_classification_cache_hits() == 2);
+
+    cpp.clear_results();
+    CHECK(cpp.get_string_classification_lookups() == 0);
+    CHECK(cpp.get_string_classification_cache_hits() == 0);
+    }
+
+TEST_CASE("Custom functions", "[cpp][i18n]")
+    {
+    cpp_i18n_review cpp(false);
+    const std::wstring translationFunction{ L"MyTranslate" };
+    const std::wstring ignoredFunction{ L"MyTrace" };
+    const wchar_t* code = LR"(auto var = MyTranslate("Hello there, world");
+auto var2 = Helpers::MyTranslate("Goodbye for now, world");
+MyTrace("Entering the main loop now");)";
+    cpp(code, L"");
+    cpp.review_strings([](size_t) {},
+                       [](size_t, const std::filesystem::path&) { return true; });
+    CHECK(cpp.get_localizable_strings().empty());
+    CHECK(cpp.get_not_available_for_localization_strings().size() == 3);
+
+    // functions added afterwards are picked up (including by their base name)
+    cpp.clear_results();
+    cpp.add_translation_extraction_function(translationFunction);
+    cpp.add_function_to_ignore(ignoredFunction);
+    cpp(code, L"");
+    cpp.review_strings([](size_t) {},
+                       [](size_t, const std::filesystem::path&) { return true; });
+    REQUIRE(cpp.get_localizable_strings().size() == 2);
+    CHECK(cpp.get_localizable_strings()[0].m_string == std::wstring{ L"Hello there, world" });
+    CHECK(cpp.get_localizable_strings()[1].m_string == std::wstring{ L"Goodbye for now, world" });
+    CHECK(cpp.get_not_available_for_localization_strings().empty());
+    REQUIRE(cpp.get_internal_strings().size() == 1);
+    CHECK(cpp.get_internal_strings()[0].m_string == std::wstring{ L"Entering the main loop now" });
+    }
+
 TEST_CASE("IDs", "[cpp][i18n]")
     {
     SECTION("ID assignments")
@@ -463,6 +675,20 @@ UINT ID_PRINT_ALL(wxID_HIGHEST+1);)";
         CHECK(cpp.get_ids_assigned_number()[3].m_string == L"1003 assigned to ID_EXPORT");
         }
 
+    SECTION("ID assignments in comments and strings")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::all_i18n_checks);
+        const wchar_t* code = LR"(/* UINT MENU_ID_OLD = 999; */
+auto str = "UINT MENU_ID_QUOTED = 998;";
+UINT MENU_ID_NEW = 1000 /* the first menu ID */;)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_ids_assigned_number().size() == 1);
+        CHECK(cpp.get_ids_assigned_number()[0].m_string == L"1000 assigned to MENU_ID_NEW");
+        CHECK(cpp.get_ids_assigned_number()[0].m_line == 3);
+        }
+
     SECTION("ID assignment define")
         {
         cpp_i18n_review cpp(false);
@@ -698,6 +924,87 @@ static int const MENU_ID_EXPORT = wxID_ANY;)";
         CHECK(cpp.get_ids_assigned_number().size() == 0);
         CHECK(cpp.get_duplicates_value_assigned_to_ids().size() == 0);
         }
+
+    SECTION("ID assignment line numbers")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::all_i18n_checks);
+        const wchar_t* code = L"#define ID_FIRST 1000\r\n\r\n#define ID_SECOND 1000\n"
+                              L"int val = 5;\r#define ID_THIRD 1002";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_ids_assigned_number().size() == 3);
+        CHECK(cpp.get_ids_assigned_number()[0].m_line == 1);
+        CHECK(cpp.get_ids_assigned_number()[1].m_line == 3);
+        CHECK(cpp.get_ids_assigned_number()[2].m_line == 5);
+        REQUIRE(cpp.get_duplicates_value_assigned_to_ids().size() == 1);
+        CHECK(cpp.get_duplicates_value_assigned_to_ids()[0].m_line == 3);
+        }
+
+    SECTION("Duplicate ID values across files")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::check_duplicate_value_assigned_to_ids);
+        const wchar_t* code1 = LR"(#define ID_OPEN 5000)";
+        const wchar_t* code2 = LR"(#define ID_CLOSE 5000)";
+        cpp(code1, L"first.h");
+        cpp(code2, L"second.h");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_duplicates_value_assigned_to_ids().size() == 0);
+
+        cpp.clear_results();
+        cpp.review_duplicate_ids_across_files(true);
+        cpp(code1, L"first.h");
+        cpp(code2, L"second.h");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_duplicates_value_assigned_to_ids().size() == 1);
+        CHECK(cpp.get_duplicates_value_assigned_to_ids()[0].m_string == L"5000 has been assigned to multiple ID variables.");
+        CHECK(cpp.get_duplicates_value_assigned_to_ids()[0].m_file_name == L"second.h");
+
+        // IDs from the previous batch are forgotten
+        cpp.clear_results();
+        cpp(code2, L"second.h");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_duplicates_value_assigned_to_ids().size() == 0);
+        }
+
+    SECTION("Reloading a file")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(static_cast<review_style>(check_duplicate_value_assigned_to_ids |
+                                                check_l10n_contains_url));
+        cpp.review_duplicate_ids_across_files(true);
+        const wchar_t* code1 = LR"(#define ID_OPEN 5000)";
+        const wchar_t* code2 = LR"(#define ID_CLOSE 5000)";
+        const wchar_t* code3 = LR"(auto str = _(L"Visit www.example.com for more information.");)";
+        cpp(code1, L"first.h");
+        cpp(code2, L"second.h");
+        cpp(code3, L"third.cpp");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_duplicates_value_assigned_to_ids().size() == 1);
+        CHECK(cpp.get_duplicates_value_assigned_to_ids()[0].m_file_name == L"second.h");
+        CHECK(cpp.get_localizable_strings_with_urls().size() == 1);
+
+        // the other file's ID is no longer a duplicate
+        cpp.clear_file_results(L"first.h");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_duplicates_value_assigned_to_ids().size() == 0);
+
+        // reloaded files are reported the same as in a full batch
+        cpp(code1, L"first.h");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_duplicates_value_assigned_to_ids().size() == 1);
+        CHECK(cpp.get_duplicates_value_assigned_to_ids()[0].m_file_name == L"second.h");
+
+        // only the reloaded file's strings are reviewed again
+        cpp.clear_file_results(L"third.cpp");
+        CHECK(cpp.get_localizable_strings().size() == 0);
+        CHECK(cpp.get_localizable_strings_with_urls().size() == 0);
+        cpp(code3, L"third.cpp");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_localizable_strings().size() == 1);
+        CHECK(cpp.get_localizable_strings_with_urls().size() == 1);
+        }
     }
 
 TEST_CASE("Qt", "[cpp][i18n]")
@@ -982,6 +1289,41 @@ wxStrlen)";
         CHECK(cpp.get_deprecated_macros()[0].m_line == 2);
         CHECK(cpp.get_deprecated_macros()[0].m_usage.m_value == L"Use std::wcslen() or (wrap in a std::wstring_view) instead of wxStrlen().");
         }
+
+    SECTION("Comments and strings are skipped")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(review_style::check_deprecated_macros);
+        const wchar_t* code = LR"(// wxStrlen(theString);
+/* wxStrlen(theString); */auto var = wxStrlen(theString);
+auto str = "call wxStrlen() here";
+var = /*comment*/wxStrlen(str);)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_deprecated_macros().size() == 2);
+        CHECK(cpp.get_deprecated_macros()[0].m_line == 2);
+        CHECK(cpp.get_deprecated_macros()[0].m_column == 38);
+        CHECK(cpp.get_deprecated_macros()[1].m_line == 4);
+        CHECK(cpp.get_deprecated_macros()[1].m_column == 18);
+        }
+
+    SECTION("Masked comments are read as blanks")
+        {
+        cpp_i18n_review cpp(false);
+        const std::wstring code{ LR"(MessageBox(/* ( */ _("Open the " /* , */ "file"));
+/* auto str = "(" */ wxString msg = _("Save the file");)" };
+        const std::wstring originalCode{ code };
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(code == originalCode);
+        REQUIRE(cpp.get_localizable_strings().size() == 2);
+        CHECK(cpp.get_localizable_strings()[0].m_string == L"Open the file");
+        CHECK(cpp.get_localizable_strings()[0].m_usage.m_value == L"_");
+        CHECK(cpp.get_localizable_strings()[0].m_line == 1);
+        CHECK(cpp.get_localizable_strings()[1].m_string == L"Save the file");
+        CHECK(cpp.get_localizable_strings()[1].m_usage.m_value == L"_");
+        CHECK(cpp.get_localizable_strings()[1].m_line == 2);
+        }
     }
 
 TEST_CASE("Code generator strings", "[i18n]")
@@ -1487,7 +1829,58 @@ TEST_CASE("Ignore", "[cpp]")
         CHECK(cpp.get_internal_strings()[0].m_string == std::wstring(L"Direct2D failed"));
         CHECK(cpp.get_internal_strings()[0].m_usage.m_value == std::wstring(L"DX_MSG"));
         CHECK(cpp.get_internal_strings()[0].m_usage.m_type == cpp_i18n_review::string_info::usage_info::usage_type::variable);
-        i18n_review::get_ignored_variable_patterns().clear();
+        i18n_review::clear_ignored_variable_patterns();
+        }
+
+    SECTION("Variable pattern added between files")
+        {
+        cpp_i18n_review cpp(false);
+        const wchar_t* code = LR"(std::wstring trackingMessage = "The file could not be opened.";)";
+        cpp(code, L"");
+        cpp.add_variable_name_pattern_to_ignore(std::wregex(L"tracking.*"));
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        // the first file was reviewed before the pattern was added
+        CHECK(cpp.get_localizable_strings().size() == 0);
+        REQUIRE(cpp.get_not_available_for_localization_strings().size() == 1);
+        REQUIRE(cpp.get_internal_strings().size() == 1);
+        CHECK(cpp.get_internal_strings()[0].m_usage.m_value == L"trackingMessage");
+        i18n_review::clear_ignored_variable_patterns();
+        }
+
+    SECTION("Variable patterns with literal text")
+        {
+        cpp_i18n_review cpp(false);
+        // the built-in patterns are shared, and aren't added again
+        const size_t patternCount{ i18n_review::get_ignored_variable_patterns().size() };
+        cpp_i18n_review cpp2(false);
+        CHECK(i18n_review::get_ignored_variable_patterns().size() == patternCount);
+
+        cpp.add_variable_name_pattern_to_ignore(L"^TRACE.*$", std::regex_constants::icase);
+        cpp.add_variable_name_pattern_to_ignore(L"Colou?r[A-Za-z]+Name");
+        cpp.add_variable_name_pattern_to_ignore(LR"(msg\d)");
+        cpp.add_variable_name_pattern_to_ignore(LR"(msg\d)");
+        CHECK(i18n_review::get_ignored_variable_patterns().size() == patternCount + 3);
+        const wchar_t* code = LR"(std::wstring traceMessage = "The file could not be opened.";
+std::wstring TraceLog = "The file could not be opened.";
+std::wstring myTrace = "The file could not be opened.";
+std::wstring ColorTableName = "The file could not be opened.";
+std::wstring ColourXName = "The file could not be opened.";
+std::wstring ColorName = "The file could not be opened.";
+std::wstring msg1 = "The file could not be opened.";)";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        std::vector<std::wstring> ignoredNames;
+        for (const auto& str : cpp.get_internal_strings())
+            {
+            ignoredNames.push_back(str.m_usage.m_value);
+            }
+        CHECK(ignoredNames == std::vector<std::wstring>{ L"traceMessage", L"TraceLog", L"ColorTableName", L"ColourXName", L"msg1" });
+        REQUIRE(cpp.get_not_available_for_localization_strings().size() == 2);
+        CHECK(cpp.get_not_available_for_localization_strings()[0].m_usage.m_value == L"myTrace");
+        CHECK(cpp.get_not_available_for_localization_strings()[1].m_usage.m_value == L"ColorName");
+        i18n_review::clear_ignored_variable_patterns();
+        CHECK(i18n_review::get_ignored_variable_patterns().empty());
         }
 
     SECTION("Var types to ignore")
@@ -2271,7 +2664,7 @@ TEST_CASE("Variable Assignment", "[cpp]")
         CHECK(cpp.get_internal_strings()[0].m_string == L"Enter your ID.");
         CHECK(cpp.get_internal_strings()[0].m_usage.m_value == L"testMessage");
         CHECK(cpp.get_internal_strings()[0].m_usage.m_variableInfo.m_type == L"std::string");
-        i18n_review::get_ignored_variable_patterns().clear();
+        i18n_review::clear_ignored_variable_patterns();
         }
 
     SECTION("Variable assignment array")
@@ -2996,6 +3389,73 @@ if (std::regex_match(str, m_html_regex) ||
         }
     }
 
+TEST_CASE("Line Formatting", "[cpp]")
+    {
+    SECTION("Tabs and trailing spaces")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(static_cast<review_style>(check_tabs | check_trailing_spaces));
+        const wchar_t* code = L"int a; \r\nint\tb;\r\n// note \n\tauto c = \"x\ty\";";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_trailing_spaces().size() == 2);
+        CHECK(cpp.get_trailing_spaces()[0].m_string == L"int a;");
+        CHECK(cpp.get_trailing_spaces()[0].m_line == 1);
+        CHECK(cpp.get_trailing_spaces()[0].m_column == 7);
+        CHECK(cpp.get_trailing_spaces()[1].m_string == L"// note");
+        CHECK(cpp.get_trailing_spaces()[1].m_line == 3);
+        REQUIRE(cpp.get_tabs().size() == 3);
+        CHECK(cpp.get_tabs()[0].m_line == 2);
+        CHECK(cpp.get_tabs()[0].m_column == 4);
+        CHECK(cpp.get_tabs()[1].m_line == 4);
+        CHECK(cpp.get_tabs()[1].m_column == 1);
+        CHECK(cpp.get_tabs()[2].m_line == 4);
+        CHECK(cpp.get_tabs()[2].m_column == 13);
+        }
+
+    SECTION("Wide lines")
+        {
+        cpp_i18n_review cpp(false);
+        cpp.set_style(check_line_width);
+        const std::wstring code = L"auto first = " + std::wstring(120, L'a') + L";\n" +
+            L"auto raw = LR\"(" + std::wstring(120, L'b') + L")\";\n" +
+            L"auto last = " + std::wstring(120, L'c') + L";";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        REQUIRE(cpp.get_wide_lines().size() == 2);
+        CHECK(cpp.get_wide_lines()[0].m_usage.m_value == L"134");
+        CHECK(cpp.get_wide_lines()[0].m_line == 1);
+        CHECK(cpp.get_wide_lines()[0].m_string == L"auto first = aaaaaaaaaaaaaaaaaaa...");
+        CHECK(cpp.get_wide_lines()[1].m_usage.m_value == L"133");
+        CHECK(cpp.get_wide_lines()[1].m_line == 3);
+        }
+
+    SECTION("Formatting only")
+        {
+        // the code isn't parsed if only line formatting is being reviewed
+        cpp_i18n_review cpp(false);
+        cpp.set_style(static_cast<review_style>(check_tabs | check_trailing_spaces | check_line_width));
+        const wchar_t* code = L"auto label = _(\"Open file\"); \n\tSetTitle(_(\"Save file\"));";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_localizable_strings().empty());
+        CHECK(cpp.get_trailing_spaces().size() == 1);
+        CHECK(cpp.get_tabs().size() == 1);
+        }
+
+    SECTION("L10N check only")
+        {
+        // halfwidth is an l10n check, but it still needs the code parsed
+        cpp_i18n_review cpp(false);
+        cpp.set_style(check_halfwidth);
+        const wchar_t* code = L"auto label = _(L\"\uFF71\uFF72\uFF73 text\");";
+        cpp(code, L"");
+        cpp.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+        CHECK(cpp.get_localizable_strings().size() == 1);
+        CHECK(cpp.get_localizable_strings_with_halfwidths().size() == 1);
+        }
+    }
+
 TEST_CASE("Casing", "[cpp]")
     {
     SECTION("Pascal Case")
@@ -2,10 +2,13 @@
 #include "../src/i18n_review.h"
 #include "../src/i18n_string_util.h"
 #include <algorithm>
+#include <cwctype>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <iomanip>
+#include <random>
 #include <set>
 #include <sstream>
 
@@ -129,6 +132,12 @@ TEST_CASE("untranslatable", "[i18nreview]")
     CHECK(reviewer.is_untranslatable_string(LR"(\"categorical-columns\": [], \"date-columns\": [], )", false).first);
     CHECK(reviewer.is_untranslatable_string(LR"(\", \"canvas-margins\": [], \"padding\": [], \"outline\)", false).first);
     CHECK(reviewer.is_untranslatable_string(LR"({\"name\": \"%s\", "                 L"\"section\": {})", false).first);
+    // fonts, file extensions, and known internal strings (case insensitive)
+    CHECK(reviewer.is_untranslatable_string(L"Courier New", false).first);
+    CHECK(reviewer.is_untranslatable_string(L"courier new", false).first);
+    CHECK(reviewer.is_untranslatable_string(L"DOCX", false).first);
+    CHECK(reviewer.is_untranslatable_string(L"directx", false).first);
+    CHECK_FALSE(reviewer.is_untranslatable_string(L"Courier News", false).first);
     }
 
 TEST_CASE("translatable", "[i18nreview]")
@@ -375,5 +384,331 @@ TEST_CASE("Hex color remove", "[hexcolor]")
         }
     }
 
+TEST_CASE("Find first of chars", "[i18nstringutil]")
+    {
+    SECTION("Found at different offsets")
+        {
+        // long enough to cover vectorized blocks and the remaining tail
+        const std::wstring text{ L"abcdefghijklmnopqrstuvwxyz0123456789" };
+        for (size_t i = 0; i < text.length(); ++i)
+            {
+            const auto* found = i18n_string_util::find_first_of_chars(
+                text.data(), text.data() + text.length(), std::wstring_view{ &text[i], 1 });
+            CHECK(found == text.data() + i);
+            }
+        }
+
+    SECTION("First of several")
+        {
+        const std::wstring text{ L"int value = 5; // comment \"string\"" };
+        const auto* found = i18n_string_util::find_first_of_chars(
+            text.data(), text.data() + text.length(), L"\"/#");
+        CHECK(found == text.data() + 15);
+        }
+
+    SECTION("Not found")
+        {
+        const std::wstring text{ L"no delimiters in this text at all" };
+        CHECK(i18n_string_util::find_first_of_chars(text.data(), text.data() + text.length(),
+                                                    L"/#") == text.data() + text.length());
+        CHECK(i18n_string_util::find_first_of_chars(text.data(), text.data(), L"n") ==
+              text.data());
+        }
+
+    SECTION("Embedded NUL and non-ASCII")
+        {
+        std::wstring text(40, L'x');
+        text[37] = L'\0';
+        text[21] = L'\u00E9';
+        CHECK(i18n_string_util::find_first_of_chars(text.data(), text.data() + text.length(),
+                                                    std::wstring_view{ L"\0", 1 }) ==
+              text.data() + 37);
+        CHECK(i18n_string_util::find_first_of_chars(text.data(), text.data() + text.length(),
+                                                    L"\u00E9") == text.data() + 21);
+        }
+    }
+
+TEST_CASE("Char classes", "[i18nstringutil]")
+    {
+    using namespace i18n_string_util;
+
+    SECTION("Empty and ASCII")
+        {
+        CHECK(get_char_classes(L"") == 0);
+        CHECK(get_char_classes(L"Plain ASCII text that spans several blocks~") == 0);
+        }
+
+    SECTION("Each class at different offsets")
+        {
+        // long enough to cover vectorized blocks and the remaining tail
+        for (size_t i = 0; i < 37; ++i)
+            {
+            std::wstring text(37, L'x');
+            text[i] = L'\u00E9';
+            CHECK(get_char_classes(text) == char_class_extended);
+            text[i] = L'\uFF76'; // halfwidth Katakana "ka"
+            CHECK(get_char_classes(text) == (char_class_extended | char_class_halfwidth));
+            text[i] = L'\\';
+            CHECK(get_char_classes(text) == char_class_backslash);
+            }
+        }
+
+    SECTION("Halfwidth range boundaries")
+        {
+        CHECK(get_char_classes(L"abcdefgh\uFF61") == (char_class_extended | char_class_halfwidth));
+        CHECK(get_char_classes(L"abcdefgh\uFFDC") == (char_class_extended | char_class_halfwidth));
+        CHECK(get_char_classes(L"abcdefgh\uFF60") == char_class_extended);
+        CHECK(get_char_classes(L"abcdefgh\uFFDD") == char_class_extended);
+        }
+    }
+
+TEST_CASE("Escaped Unicode", "[i18nstringutil]")
+    {
+    using namespace i18n_string_util;
+    CHECK(contains_escaped_unicode_value(LR"(Caf\u00E9)"));
+    CHECK(contains_escaped_unicode_value(LR"(\U0001F600 smile)"));
+    CHECK(contains_escaped_unicode_value(LR"(\xE9)"));
+    CHECK_FALSE(contains_escaped_unicode_value(LR"(\u00G9)"));
+    CHECK_FALSE(contains_escaped_unicode_value(LR"(\U0001F60)"));
+    CHECK_FALSE(contains_escaped_unicode_value(LR"(C:\users\xavier)"));
+    CHECK_FALSE(contains_escaped_unicode_value(LR"(trailing\)"));
+    }
+
+TEST_CASE("Scan line block", "[i18nstringutil]")
+    {
+    SECTION("Each position")
+        {
+        for (size_t i = 0; i < i18n_string_util::LINE_SCAN_BLOCK_SIZE; ++i)
+            {
+            std::wstring text(i18n_string_util::LINE_SCAN_BLOCK_SIZE, L'x');
+            text[i] = L'\n';
+            CHECK(i18n_string_util::scan_line_block(text.data(), false) == (static_cast<uint64_t>(1) << i));
+            text[i] = L'\t';
+            CHECK(i18n_string_util::scan_line_block(text.data(), true) == (static_cast<uint64_t>(1) << i));
+            CHECK(i18n_string_util::scan_line_block(text.data(), false) == 0);
+            }
+        }
+
+    SECTION("CRLF and tabs")
+        {
+        std::wstring text(i18n_string_util::LINE_SCAN_BLOCK_SIZE, L' ');
+        text[0] = L'\t';
+        text[3] = L'\r';
+        text[4] = L'\n';
+        text.back() = L'\r';
+        const uint64_t lineBreaks = (static_cast<uint64_t>(1) << 3) | (static_cast<uint64_t>(1) << 4) |
+            (static_cast<uint64_t>(1) << (i18n_string_util::LINE_SCAN_BLOCK_SIZE - 1));
+        CHECK(i18n_string_util::scan_line_block(text.data(), false) == lineBreaks);
+        CHECK(i18n_string_util::scan_line_block(text.data(), true) == (lineBreaks | 1));
+        }
+
+    SECTION("Similar characters")
+        {
+        // characters sharing a low byte with a newline or tab shouldn't be matched
+        std::wstring text(i18n_string_util::LINE_SCAN_BLOCK_SIZE, L'\u010A');
+        text[1] = L'\u0109';
+        text[2] = L'\u0D0D';
+        CHECK(i18n_string_util::scan_line_block(text.data(), true) == 0);
+        }
+    }
+
+TEST_CASE("Whole word matcher", "[i18nstringutil]")
+    {
+    using namespace i18n_string_util;
+
+    SECTION("Counts")
+        {
+        const whole_word_matcher matcher{ { L"Java", L"Jakarta", L"Jakarta EE", L"", L"Java" } };
+        using counts = std::vector<std::pair<size_t, size_t>>;
+        CHECK(matcher.count(L"Java") == counts{ { 0, 1 } });
+        CHECK(matcher.count(L"Java, Jakarta EE, and Java.") == counts{ { 0, 2 }, { 1, 1 }, { 2, 1 } });
+        CHECK(matcher.count(L"JavaScript Javanese Jakartas").empty());
+        CHECK(matcher.count(L"(Jakarta)") == counts{ { 1, 1 } });
+        CHECK(matcher.count(L"Jakarta EEs") == counts{ { 1, 1 } });
+        CHECK(matcher.count(L"java").empty());
+        CHECK(matcher.count(L"").empty());
+        }
+
+    SECTION("Overlaps")
+        {
+        const whole_word_matcher matcher{ { L"a-a", L"a" } };
+        // same as find_whole_word(), where the search continues after the last match
+        CHECK(matcher.count(L"a-a-a") == std::vector<std::pair<size_t, size_t>>{ { 0, 1 }, { 1, 3 } });
+        }
+
+    SECTION("Same as find_whole_word")
+        {
+        const std::vector<std::wstring> words{ L"ab", L"b", L"abc", L"bc", L"c a", L"a", L"cab" };
+        const whole_word_matcher matcher{ words };
+        const std::wstring alphabet{ L"abc -." };
+        std::minstd_rand rand{ 42 };
+        for (size_t i = 0; i < 2'000; ++i)
+            {
+            std::wstring text(rand() % 12, L' ');
+            std::generate(text.begin(), text.end(), [&]() { return alphabet[rand() % alphabet.length()]; });
+            const auto found = matcher.count(text);
+            for (size_t wordIndex = 0; wordIndex < words.size(); ++wordIndex)
+                {
+                size_t expected{ 0 };
+                size_t pos{ 0 };
+                while ((pos = string_util::find_whole_word(text, words[wordIndex], pos)) != std::wstring::npos)
+                    {
+                    ++expected;
+                    pos += words[wordIndex].length();
+                    }
+                const auto hit = std::find_if(found.cbegin(), found.cend(),
+                    [wordIndex](const auto& wordCount) { return wordCount.first == wordIndex; });
+                CHECK((hit == found.cend() ? 0 : hit->second) == expected);
+                }
+            }
+        }
+    }
+
+TEST_CASE("Case folded set", "[stringutil]")
+    {
+    string_util::case_folded_wstring_set words{ L"Arial", L"MS PGothic", L"\u00C9t\u00E9" };
+    CHECK(words.size() == 3);
+    CHECK(words.contains(L"Arial"));
+    CHECK(words.contains(L"ARIAL"));
+    CHECK(words.contains(L"ms pgothic"));
+    CHECK(words.contains(L"\u00E9T\u00C9"));
+    CHECK_FALSE(words.contains(L"Aria"));
+    CHECK_FALSE(words.contains(L"Arial "));
+    CHECK_FALSE(words.contains(L""));
+    CHECK_FALSE(words.contains(std::wstring(100, L'a')));
+
+    words.insert(L"ARIAL");
+    CHECK(words.size() == 3);
+    const std::wstring longWord(100, L'A');
+    words.insert(longWord);
+    CHECK(words.contains(std::wstring(100, L'a')));
+    CHECK_FALSE(words.contains(std::wstring(99, L'a')));
+
+    words.clear();
+    CHECK(words.empty());
+    CHECK_FALSE(words.contains(L"Arial"));
+    }
+
+TEST_CASE("Unicode properties", "[i18nstringutil]")
+    {
+    using namespace i18n_string_util;
+
+    SECTION("ASCII")
+        {
+        for (wchar_t ch = 0; ch < 128; ++ch)
+            {
+            CHECK(is_space(ch) == static_cast<bool>(std::isspace(ch)));
+            CHECK(is_punctuation(ch) == static_cast<bool>(std::ispunct(ch)));
+            CHECK(is_alpha(ch) == static_cast<bool>(std::isalpha(ch)));
+            CHECK(is_alnum(ch) == static_cast<bool>(std::isalnum(ch)));
+            CHECK(is_upper(ch) == static_cast<bool>(std::isupper(ch)));
+            CHECK(is_lower(ch) == static_cast<bool>(std::islower(ch)));
+            CHECK(to_lower(ch) == static_cast<wchar_t>(std::tolower(ch)));
+            CHECK(to_upper(ch) == static_cast<wchar_t>(std::toupper(ch)));
+            }
+        }
+
+    SECTION("Spaces")
+        {
+        CHECK(is_space(L'\u3000'));
+        CHECK(is_space(L'\u2003'));
+        CHECK(is_space(L'\u2028'));
+        // no-break spaces
+        CHECK_FALSE(is_space(L'\u00A0'));
+        CHECK_FALSE(is_space(L'\u202F'));
+        CHECK_FALSE(is_space(L'\u200B'));
+        }
+
+    SECTION("Punctuation")
+        {
+        CHECK(is_punctuation(L'\u2014'));
+        CHECK(is_punctuation(L'\u00BF'));
+        CHECK(is_punctuation(L'\u300C'));
+        CHECK(is_punctuation(L'\u20AC'));
+        CHECK_FALSE(is_punctuation(L'\u00E9'));
+        CHECK_FALSE(is_punctuation(L'\u3000'));
+        }
+
+    SECTION("Letters")
+        {
+        CHECK(is_alpha(L'\u00C9'));
+        CHECK(is_alpha(L'\u65E5'));
+        CHECK(is_alpha(L'\u0416'));
+        CHECK_FALSE(is_alpha(L'\u0661'));
+        CHECK(is_alnum(L'\u0661'));
+        CHECK(is_upper(L'\u00C9'));
+        CHECK(is_lower(L'\u00E9'));
+        CHECK_FALSE(is_upper(L'\u65E5'));
+        CHECK_FALSE(is_lower(L'\u65E5'));
+        }
+
+    SECTION("Case mapping")
+        {
+        CHECK(to_lower(L'\u00C9') == L'\u00E9');
+        CHECK(to_upper(L'\u00E9') == L'\u00C9');
+        CHECK(to_lower(L'\u0416') == L'\u0436');
+        CHECK(to_upper(L'\u00FF') == L'\u0178');
+        CHECK(to_lower(L'\u0130') == L'i');
+        CHECK(to_upper(L'\u00DF') == L'\u00DF');
+        CHECK(to_lower(L'\u65E5') == L'\u65E5');
+        if constexpr (sizeof(wchar_t) == 4)
+            {
+            // Deseret, outside of the BMP
+            CHECK(to_lower(static_cast<wchar_t>(0x10400)) == static_cast<wchar_t>(0x10428));
+            CHECK(to_upper(static_cast<wchar_t>(0x10428)) == static_cast<wchar_t>(0x10400));
+            CHECK(is_upper(static_cast<wchar_t>(0x10400)));
+            CHECK_FALSE(is_space(static_cast<wchar_t>(0x10FFFF)));
+            }
+        }
+    }
+
+// run with "[!benchmark]" to compare against the C library's locale-dependent functions
+TEST_CASE("Unicode properties benchmark", "[i18nstringutil][!benchmark]")
+    {
+    using namespace i18n_string_util;
+
+    // English, French, Russian, Greek, Japanese, and Arabic text, along with spaces and punctuation
+    const std::wstring sample{ L"The file could not be opened.\tLe fichier n'a pas pu être ouvert. "
+                               L"Не удалось открыть файл. Δεν ήταν δυνατό το άνοιγμα του αρχείου.\n"
+                               L"ファイルを開けませんでした。 تعذر فتح الملف. «Ünïcödé» — 123…\n" };
+    std::wstring buffer;
+    for (size_t i = 0; i < 1'000; ++i)
+        {
+        buffer += sample;
+        }
+
+    BENCHMARK("is_space")
+        {
+        return std::count_if(buffer.cbegin(), buffer.cend(), [](const wchar_t ch) { return is_space(ch); });
+        };
+    BENCHMARK("std::iswspace")
+        {
+        return std::count_if(buffer.cbegin(), buffer.cend(), [](const wchar_t ch) { return std::iswspace(ch) != 0; });
+        };
+
+    BENCHMARK("is_alpha")
+        {
+        return std::count_if(buffer.cbegin(), buffer.cend(), [](const wchar_t ch) { return is_alpha(ch); });
+        };
+    BENCHMARK("std::iswalpha")
+        {
+        return std::count_if(buffer.cbegin(), buffer.cend(), [](const wchar_t ch) { return std::iswalpha(ch) != 0; });
+        };
+
+    BENCHMARK("to_lower")
+        {
+        std::wstring lowered(buffer.length(), L' ');
+        std::transform(buffer.cbegin(), buffer.cend(), lowered.begin(), [](const wchar_t ch) { return to_lower(ch); });
+        return lowered;
+        };
+    BENCHMARK("std::towlower")
+        {
+        std::wstring lowered(buffer.length(), L' ');
+        std::transform(buffer.cbegin(), buffer.cend(), lowered.begin(),
+                       [](const wchar_t ch) { return static_cast<wchar_t>(std::towlower(ch)); });
+        return lowered;
+        };
+    }
+
 // NOLINTEND
 // clang-format on
@@ -0,0 +1,121 @@
+#include "../src/ignore_rules.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <filesystem>
+#include <fstream>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+TEST_CASE("Glob matching", "[ignore]")
+	{
+	SECTION("Wildcards")
+		{
+		CHECK(ignore_rules::glob_match(L"*.o", L"main.o"));
+		CHECK(ignore_rules::glob_match(L"*.o", L".o"));
+		CHECK_FALSE(ignore_rules::glob_match(L"*.o", L"main.obj"));
+		CHECK_FALSE(ignore_rules::glob_match(L"*.o", L"src/main.o"));
+		CHECK(ignore_rules::glob_match(L"src/*.o", L"src/main.o"));
+		CHECK_FALSE(ignore_rules::glob_match(L"src/*.o", L"src/lib/main.o"));
+		CHECK(ignore_rules::glob_match(L"file?.txt", L"file1.txt"));
+		CHECK_FALSE(ignore_rules::glob_match(L"file?.txt", L"file10.txt"));
+		CHECK_FALSE(ignore_rules::glob_match(L"a?b", L"a/b"));
+		CHECK(ignore_rules::glob_match(L"a*b*c", L"aXXbYYc"));
+		CHECK_FALSE(ignore_rules::glob_match(L"a*b*c", L"aXXbYY"));
+		}
+
+	SECTION("Character classes")
+		{
+		CHECK(ignore_rules::glob_match(L"file[0-9].txt", L"file5.txt"));
+		CHECK_FALSE(ignore_rules::glob_match(L"file[0-9].txt", L"fileA.txt"));
+		CHECK(ignore_rules::glob_match(L"file[!0-9].txt", L"fileA.txt"));
+		CHECK(ignore_rules::glob_match(L"file[^0-9].txt", L"fileA.txt"));
+		CHECK(ignore_rules::glob_match(L"[]]", L"]"));
+		CHECK(ignore_rules::glob_match(L"file[", L"file["));
+		CHECK(ignore_rules::glob_match(L"\\*.txt", L"*.txt"));
+		CHECK_FALSE(ignore_rules::glob_match(L"\\*.txt", L"a.txt"));
+		}
+
+	SECTION("Double asterisks")
+		{
+		CHECK(ignore_rules::glob_match(L"**/foo", L"foo"));
+		CHECK(ignore_rules::glob_match(L"**/foo", L"a/b/foo"));
+		CHECK(ignore_rules::glob_match(L"a/**/b", L"a/b"));
+		CHECK(ignore_rules::glob_match(L"a/**/b", L"a/x/y/b"));
+		CHECK_FALSE(ignore_rules::glob_match(L"a/**/b", L"a/x/y/c"));
+		CHECK(ignore_rules::glob_match(L"abc/**", L"abc/x/y"));
+		CHECK_FALSE(ignore_rules::glob_match(L"abc/**", L"abc"));
+		// not a whole segment, so just a '*'
+		CHECK(ignore_rules::glob_match(L"a**b", L"aXb"));
+		CHECK_FALSE(ignore_rules::glob_match(L"a**b", L"a/b"));
+		}
+	}
+
+TEST_CASE("Ignore rules", "[ignore]")
+	{
+	SECTION("Patterns")
+		{
+		const ignore_rules rules(L"# build outputs\n"
+								 L"*.o\n"
+								 L"build/\n"
+								 L"/generated.h\n"
+								 L"docs/api\n"
+								 L"\n"
+								 L"*.log   \r\n"
+								 L"!keep.log\n"
+								 L"\\#notes.txt\n",
+								 std::wstring{}, nullptr);
+		CHECK(rules.is_ignored(L"main.o", false));
+		CHECK(rules.is_ignored(L"src/lib/main.o", false));
+		CHECK_FALSE(rules.is_ignored(L"main.cpp", false));
+		// folder only
+		CHECK(rules.is_ignored(L"build", true));
+		CHECK(rules.is_ignored(L"src/build", true));
+		CHECK_FALSE(rules.is_ignored(L"build", false));
+		// anchored to the ignore file's folder
+		CHECK(rules.is_ignored(L"generated.h", false));
+		CHECK_FALSE(rules.is_ignored(L"src/generated.h", false));
+		CHECK(rules.is_ignored(L"docs/api", true));
+		CHECK_FALSE(rules.is_ignored(L"src/docs/api", true));
+		// trailing spaces and a negated pattern
+		CHECK(rules.is_ignored(L"debug.log", false));
+		CHECK_FALSE(rules.is_ignored(L"keep.log", false));
+		CHECK_FALSE(rules.is_ignored(L"src/keep.log", false));
+		// escaped '#' is a pattern, not a comment
+		CHECK(rules.is_ignored(L"#notes.txt", false));
+		}
+
+	SECTION("Nested folders")
+		{
+		const auto rootRules =
+			std::make_shared<const ignore_rules>(L"*.h\n/vendor\n", std::wstring{}, nullptr);
+		const auto srcRules =
+			std::make_shared<const ignore_rules>(L"!api.h\n/gen\n", L"src", rootRules);
+		CHECK(srcRules->is_ignored(L"src/impl.h", false));
+		// a deeper ignore file overrides its parents
+		CHECK_FALSE(srcRules->is_ignored(L"src/api.h", false));
+		CHECK(rootRules->is_ignored(L"src/api.h", false));
+		CHECK(srcRules->is_ignored(L"vendor", true));
+		// anchored to the "src" folder
+		CHECK(srcRules->is_ignored(L"src/gen", true));
+		CHECK_FALSE(srcRules->is_ignored(L"gen", true));
+		CHECK_FALSE(srcRules->is_ignored(L"src/lib/gen", true));
+		}
+
+	SECTION("UTF-8 ignore files")
+		{
+		const std::filesystem::path folder{ std::filesystem::temp_directory_path() / L"quneiform-ignore-tests" };
+		std::filesystem::create_directories(folder);
+		// with a signature, an accented name, and a name outside of the BMP
+		std::ofstream(folder / L".gitignore", std::ios::binary) <<
+			"\xEF\xBB\xBFr\xC3\xA9sum\xC3\xA9.cpp\n\xF0\x9F\x93\x81/\n";
+		const auto rules = ignore_rules::load_folder(folder, std::wstring{}, nullptr);
+		std::filesystem::remove_all(folder);
+		REQUIRE(rules != nullptr);
+		CHECK(rules->is_ignored(L"r\u00E9sum\u00E9.cpp", false));
+		CHECK(rules->is_ignored(L"\U0001F4C1", true));
+		CHECK_FALSE(rules->is_ignored(L"resume.cpp", false));
+		}
+	}
+// NOLINTEND
@@ -0,0 +1,250 @@
+#include "../src/input.h"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <fstream>
+#include <string>
+#include <unordered_set>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+namespace
+	{
+	// a folder of test files that is removed afterwards
+	class temp_folder
+		{
+	  public:
+		explicit temp_folder(const std::wstring& name)
+			: m_root(std::filesystem::temp_directory_path() / name)
+			{
+			std::filesystem::remove_all(m_root);
+			std::filesystem::create_directories(m_root);
+			}
+		~temp_folder()
+			{
+			std::error_code removeError;
+			std::filesystem::remove_all(m_root, removeError);
+			}
+		temp_folder(const temp_folder&) = delete;
+		temp_folder& operator=(const temp_folder&) = delete;
+
+		void add_file(const std::filesystem::path& file) const
+			{
+			std::filesystem::create_directories((m_root / file).parent_path());
+			std::ofstream(m_root / file) << "int val = 5;\n";
+			}
+
+		[[nodiscard]]
+		const std::filesystem::path& root() const noexcept
+			{ return m_root; }
+
+		[[nodiscard]]
+		std::vector<std::filesystem::path> files(std::vector<std::filesystem::path> names) const
+			{
+			for (auto& name : names)
+				{
+				name = m_root / name;
+				}
+			std::sort(names.begin(), names.end());
+			return names;
+			}
+	  private:
+		std::filesystem::path m_root;
+		};
+
+	// the original, serial walk (without any exclusions)
+	std::vector<std::filesystem::path> walk_serially(const std::filesystem::path& inputFolder)
+		{
+		static const std::unordered_set<std::wstring> defaultIgnoredDirs{
+			L".vs", L".git", L".gitmodules", L".gitworktree", L".cache", L".clangd", L".cmake",
+			L".gradle", L".quarto", L".github", L".vscode", L".idea", L".svn"
+			};
+		static const std::unordered_set<std::wstring> supportedExtensions{
+			L".rc", L".plist", L".qmd", L".c", L".cs", L".cpp", L".h", L".hpp", L".po", L".pot",
+			L".mo"
+			};
+		static const std::unordered_set<std::wstring> ignoredFileNames{
+			L"CMakeCXXCompilerId.cpp", L"CMakeCCompilerId.c", L"catch.hpp",
+			L"catch_amalgamated.cpp", L"catch_amalgamated.hpp"
+			};
+		std::vector<std::filesystem::path> files;
+		for (std::filesystem::recursive_directory_iterator it(inputFolder), end; it != end; ++it)
+			{
+			const std::wstring fileName{ it->path().filename().wstring() };
+			if (it->is_directory())
+				{
+				if (defaultIgnoredDirs.contains(fileName))
+					{
+					it.disable_recursion_pending();
+					}
+				}
+			else if (it->is_regular_file() &&
+					 supportedExtensions.contains(it->path().extension().wstring()) &&
+					 !ignoredFileNames.contains(fileName) && !fileName.starts_with(L"pseudo_"))
+				{
+				files.push_back(it->path());
+				}
+			}
+		std::sort(files.begin(), files.end());
+		return files;
+		}
+	}
+
+TEST_CASE("Files to analyze", "[input]")
+	{
+	const temp_folder folder{ L"quneiform-input-tests" };
+	folder.add_file(L"a.cpp");
+	folder.add_file(L"b.h");
+	folder.add_file(L"notes.txt");
+	folder.add_file(L"catch.hpp");
+	folder.add_file(L"pseudo_es.po");
+	folder.add_file(L".git/c.cpp");
+	folder.add_file(L"src/d.cpp");
+	folder.add_file(L"src/e.cpp");
+	folder.add_file(L"src/gen/f.cpp");
+	folder.add_file(L"src/gen/deep/g.cpp");
+	folder.add_file(L"third/h.cpp");
+	folder.add_file(L"lib/third/i.cpp");
+	folder.add_file(L"lib/j.cs");
+
+	SECTION("No exclusions")
+		{
+		CHECK(get_files_to_analyze(folder.root(), {}, {}) ==
+			  folder.files({ L"a.cpp", L"b.h", L"src/d.cpp", L"src/e.cpp", L"src/gen/f.cpp",
+							 L"src/gen/deep/g.cpp", L"third/h.cpp", L"lib/third/i.cpp",
+							 L"lib/j.cs" }));
+		}
+
+	SECTION("Excluded folders")
+		{
+		// a folder name is excluded wherever it is
+		CHECK(get_files_to_analyze(folder.root(), { L"third" }, {}) ==
+			  folder.files({ L"a.cpp", L"b.h", L"src/d.cpp", L"src/e.cpp", L"src/gen/f.cpp",
+							 L"src/gen/deep/g.cpp", L"lib/j.cs" }));
+		// a path only excludes that folder (and its subfolders)
+		CHECK(get_files_to_analyze(folder.root(), { folder.root() / L"src/gen" }, {}) ==
+			  folder.files({ L"a.cpp", L"b.h", L"src/d.cpp", L"src/e.cpp", L"third/h.cpp",
+							 L"lib/third/i.cpp", L"lib/j.cs" }));
+		CHECK(get_files_to_analyze(folder.root(), { L"src/gen/" }, {}) ==
+			  folder.files({ L"a.cpp", L"b.h", L"src/d.cpp", L"src/e.cpp", L"third/h.cpp",
+							 L"lib/third/i.cpp", L"lib/j.cs" }));
+		}
+
+	SECTION("Nested exclusions")
+		{
+		CHECK(get_files_to_analyze(folder.root(),
+								   { folder.root() / L"src", folder.root() / L"src/gen/deep" }, {}) ==
+			  folder.files({ L"a.cpp", L"b.h", L"third/h.cpp", L"lib/third/i.cpp", L"lib/j.cs" }));
+		CHECK(get_files_to_analyze(folder.root(), { folder.root() / L"src/gen/deep", L"lib" }, {}) ==
+			  folder.files({ L"a.cpp", L"b.h", L"src/d.cpp", L"src/e.cpp", L"src/gen/f.cpp",
+							 L"third/h.cpp" }));
+		}
+
+	SECTION("Excluded files")
+		{
+		CHECK(get_files_to_analyze(folder.root(), {},
+								   { folder.root() / L"src/e.cpp", L"src/gen/deep/g.cpp" }) ==
+			  folder.files({ L"a.cpp", L"b.h", L"src/d.cpp", L"src/gen/f.cpp", L"third/h.cpp",
+							 L"lib/third/i.cpp", L"lib/j.cs" }));
+		}
+
+	SECTION("Exclusions from patterns")
+		{
+		const auto [excludedPaths, excludedFiles] = get_paths_files_to_exclude(
+			folder.root(), { L"src/gen", L"third", L"a.cpp", L"missing.cpp" });
+		CHECK(excludedPaths ==
+			  std::vector<std::filesystem::path>{ folder.root() / L"src/gen",
+												  folder.root() / L"third" });
+		CHECK(excludedFiles == std::vector<std::filesystem::path>{ folder.root() / L"a.cpp" });
+		// the top-level "third" is a path now, so only that one is excluded
+		CHECK(get_files_to_analyze(folder.root(), excludedPaths, excludedFiles) ==
+			  folder.files({ L"b.h", L"src/d.cpp", L"src/e.cpp", L"lib/third/i.cpp",
+							 L"lib/j.cs" }));
+		}
+
+	SECTION("Single file")
+		{
+		CHECK(get_files_to_analyze(folder.root() / L"a.cpp", {}, {}) ==
+			  folder.files({ L"a.cpp" }));
+		}
+	}
+
+TEST_CASE("Paths to analyze", "[input]")
+	{
+	const temp_folder folder{ L"quneiform-path-tests" };
+	folder.add_file(L"src/a.cpp");
+	std::ofstream(folder.root() / L".gitignore") << "build/\n*.gen.cpp\n";
+
+	SECTION("File types")
+		{
+		const input_filter filter{ folder.root(), {}, {} };
+		// files don't need to exist
+		CHECK(filter.is_path_included(L"src/a.cpp"));
+		CHECK(filter.is_path_included(L"src/unsaved.cpp"));
+		CHECK(filter.is_path_included(folder.root() / L"src/unsaved.po"));
+		CHECK_FALSE(filter.is_path_included(L"notes.txt"));
+		CHECK_FALSE(filter.is_path_included(L"Makefile"));
+		CHECK_FALSE(filter.is_path_included(L"src/catch.hpp"));
+		CHECK_FALSE(filter.is_path_included(L"pseudo_es.po"));
+		CHECK_FALSE(filter.is_path_included(L".git/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"src/"));
+		// outside of the input folder
+		CHECK(filter.is_path_included(folder.root() / L"../other/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(folder.root() / L"../other/a.txt"));
+		}
+
+	SECTION("Exclusions")
+		{
+		const input_filter filter{ folder.root(),
+								   { L"third", folder.root() / L"src/gen" },
+								   { folder.root() / L"src/b.cpp" } };
+		CHECK(filter.is_path_included(L"src/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"third/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"lib/third/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"src/gen/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"src/gen/deep/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"src/b.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"./src/../src/b.cpp"));
+		CHECK(filter.is_path_included(L"gen/a.cpp"));
+		}
+
+	SECTION("Ignore files")
+		{
+		CHECK(input_filter{ folder.root(), {}, {} }.is_path_included(L"build/a.cpp"));
+		const input_filter filter{ folder.root(), {}, {}, true };
+		CHECK(filter.is_path_included(L"src/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"build/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"src/build/a.cpp"));
+		CHECK_FALSE(filter.is_path_included(L"src/a.gen.cpp"));
+		}
+	}
+
+TEST_CASE("Files to analyze match a serial walk", "[input]")
+	{
+	// enough folders to keep all of the workers busy
+	const temp_folder folder{ L"quneiform-input-walk-tests" };
+	for (size_t i = 0; i < 20; ++i)
+		{
+		const std::wstring subfolder{ L"folder" + std::to_wstring(i) };
+		folder.add_file(subfolder + L"/file.cpp");
+		folder.add_file(subfolder + L"/file.txt");
+		for (size_t j = 0; j < 5; ++j)
+			{
+			const std::wstring nestedFolder{ subfolder + L"/nested" + std::to_wstring(j) };
+			folder.add_file(nestedFolder + L"/file.h");
+			folder.add_file(nestedFolder + L"/pseudo_file.po");
+			folder.add_file(nestedFolder + L"/.vscode/file.cpp");
+			folder.add_file(nestedFolder + L"/deeper/file.rc");
+			}
+		}
+
+	const auto serialFiles{ walk_serially(folder.root()) };
+	CHECK(serialFiles.size() == 20 * 11);
+	for (size_t i = 0; i < 5; ++i)
+		{
+		CHECK(get_files_to_analyze(folder.root(), {}, {}) == serialFiles);
+		}
+	}
+// NOLINTEND
@@ -0,0 +1,204 @@
+#include "../src/mo_file_review.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+
+// NOLINTBEGIN
+using namespace i18n_check;
+using namespace Catch::Matchers;
+
+namespace
+	{
+	// Builds an MO file (in little-endian or big-endian byte order) from source/translation pairs.
+	std::string build_mo(const std::vector<std::pair<std::string, std::string>>& entries,
+						 const bool bigEndian = false)
+		{
+		std::string mo;
+		const auto writeUInt32 = [&mo, bigEndian](uint32_t value)
+			{
+			for (size_t i = 0; i < 4; ++i)
+				{
+				const size_t shift = bigEndian ? (3 - i) * 8 : i * 8;
+				mo += static_cast<char>((value >> shift) & 0xFF);
+				}
+			};
+		const auto count = static_cast<uint32_t>(entries.size());
+		const uint32_t originalTable{ 28 };
+		const uint32_t translationTable{ originalTable + count * 8 };
+		const uint32_t stringOffset{ translationTable + count * 8 };
+
+		writeUInt32(mo_file_review::MO_MAGIC);
+		writeUInt32(0);
+		writeUInt32(count);
+		writeUInt32(originalTable);
+		writeUInt32(translationTable);
+		writeUInt32(0);
+		writeUInt32(0);
+		std::string strings;
+		for (const auto& entry : entries)
+			{
+			writeUInt32(static_cast<uint32_t>(entry.first.length()));
+			writeUInt32(stringOffset + static_cast<uint32_t>(strings.length()));
+			strings.append(entry.first).append(1, '\0');
+			}
+		std::string translations;
+		const uint32_t translationsOffset{ stringOffset + static_cast<uint32_t>(strings.length()) };
+		for (const auto& entry : entries)
+			{
+			writeUInt32(static_cast<uint32_t>(entry.second.length()));
+			writeUInt32(translationsOffset + static_cast<uint32_t>(translations.length()));
+			translations.append(entry.second).append(1, '\0');
+			}
+		return mo + strings + translations;
+		}
+	}
+
+// clang-format off
+TEST_CASE("MO Loading", "[mo][l10n]")
+	{
+	SECTION("Header and singular entries")
+		{
+		mo_file_review mo(false);
+		const auto data = build_mo({
+			{ "", "Content-Type: text/plain; charset=UTF-8\n" },
+			{ "&Server", "&\xD0\xA1\xD0\xB5\xD1\x80\xD0\xB2\xD0\xB5\xD1\x80" } });
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		REQUIRE(mo.get_catalog_entries().size() == 1);
+		CHECK(mo.get_catalog_entries()[0].second.m_source == L"&Server");
+		CHECK(mo.get_catalog_entries()[0].second.m_translation == L"&Сервер");
+		CHECK(mo.get_catalog_entries()[0].second.m_po_format == po_format_string::no_format);
+		}
+
+	SECTION("Big endian")
+		{
+		mo_file_review mo(false);
+		const auto data = build_mo({ { "", "" }, { "Open", "Ouvrir" } }, true);
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		REQUIRE(mo.get_catalog_entries().size() == 1);
+		CHECK(mo.get_catalog_entries()[0].second.m_source == L"Open");
+		CHECK(mo.get_catalog_entries()[0].second.m_translation == L"Ouvrir");
+		}
+
+	SECTION("Context and plurals")
+		{
+		mo_file_review mo(false);
+		const auto data = build_mo({
+			{ std::string{ "Menu\x04" "File" }, "Fichier" },
+			{ std::string{ "%d file\0%d files", 16 }, std::string{ "%d fichier\0%d fichiers", 22 } } });
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		REQUIRE(mo.get_catalog_entries().size() == 2);
+		CHECK(mo.get_catalog_entries()[0].second.m_source == L"File");
+		CHECK(mo.get_catalog_entries()[0].second.m_comment == L"Menu");
+		CHECK(mo.get_catalog_entries()[1].second.m_source == L"%d file");
+		CHECK(mo.get_catalog_entries()[1].second.m_source_plural == L"%d files");
+		CHECK(mo.get_catalog_entries()[1].second.m_translation == L"%d fichier");
+		CHECK(mo.get_catalog_entries()[1].second.m_translation_plural == L"%d fichiers");
+		CHECK(mo.get_catalog_entries()[1].second.m_po_format == po_format_string::cpp_format);
+		}
+
+	SECTION("Header charset")
+		{
+		mo_file_review mo(false);
+		const auto data = build_mo({
+			{ "", "Content-Type: text/plain; charset=ISO-8859-1\n" },
+			{ "Open", "Ouvrir le fichier \xE9tendu" } });
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		REQUIRE(mo.get_catalog_entries().size() == 1);
+		CHECK(mo.get_catalog_entries()[0].second.m_translation == L"Ouvrir le fichier \x00E9tendu");
+
+		// the charset is from each catalog's own header
+		const auto utf8Data = build_mo({
+			{ "", "Content-Type: text/plain; charset=UTF-8\n" },
+			{ "Open", "Ouvrir le fichier \xC3\xA9tendu" } });
+		CHECK(mo.load_catalog(utf8Data, L"test2.mo"));
+		REQUIRE(mo.get_catalog_entries().size() == 2);
+		CHECK(mo.get_catalog_entries()[1].second.m_translation == L"Ouvrir le fichier \x00E9tendu");
+		}
+
+	SECTION("Malformed UTF-8")
+		{
+		mo_file_review mo(false);
+		const auto data = build_mo({
+			{ "", "Content-Type: text/plain; charset=UTF-8\n" },
+			{ "Open", "Ouvrir\xC3" } });
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		REQUIRE(mo.get_catalog_entries().size() == 1);
+		CHECK(mo.get_catalog_entries()[0].second.m_translation.starts_with(L"Ouvrir"));
+		}
+
+	SECTION("Invalid files")
+		{
+		mo_file_review mo(false);
+		CHECK_FALSE(mo.load_catalog("msgid \"\"", L"test.mo"));
+		auto data = build_mo({ { "Open", "Ouvrir" } });
+		data.resize(40);
+		CHECK_FALSE(mo.load_catalog(data, L"test.mo"));
+		CHECK(mo.get_catalog_entries().empty());
+		}
+	}
+
+TEST_CASE("MO Review", "[mo][l10n]")
+	{
+	SECTION("Printf mismatch")
+		{
+		mo_file_review mo(false);
+		mo.set_style(check_mismatching_printf_commands);
+		const auto data = build_mo({ { "%d of %s", "%s de %s" }, { "%d of %s", "%d de %s" } });
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		mo.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		const auto issues = std::count_if(
+			mo.get_catalog_entries().cbegin(), mo.get_catalog_entries().cend(), [](const auto& ent)
+			{ return ent.second.m_issues.size() > 0; });
+		CHECK(issues == 1);
+		}
+
+	SECTION("Plural forms")
+		{
+		mo_file_review mo(false);
+		const auto data = build_mo({
+			{ "", "Content-Type: text/plain; charset=UTF-8\n"
+				  "Plural-Forms: nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && "
+				  "n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);\n" },
+			{ std::string{ "%d file\0%d files", 16 },
+			  std::string{ "%d \xD1\x84\xD0\xB0\xD0\xB9\xD0\xBB\0"
+						   "%d \xD1\x84\xD0\xB0\xD0\xB9\xD0\xBB\xD0\xB0\0"
+						   "%d \xD1\x84\xD0\xB0\xD0\xB9\xD0\xBB\xD0\xBE\xD0\xB2", 41 } },
+			{ std::string{ "%d folder\0%d folders", 20 }, std::string{ "%d dossier\0%d dossiers", 22 } },
+			{ std::string{ "%d item\0%d items", 16 }, std::string{ "%d item\0%d items\0%s items", 25 } } });
+		CHECK(mo.load_catalog(data, L"ru.mo"));
+		mo.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		REQUIRE(mo.get_catalog_entries().size() == 3);
+		const auto& entries = mo.get_catalog_entries();
+		REQUIRE(entries[0].second.m_plural_forms != nullptr);
+		CHECK(entries[0].second.m_plural_forms->get_plural_count() == 3);
+		CHECK(entries[0].second.m_translation_plural_forms ==
+			std::vector<std::wstring>{ L"%d файл", L"%d файла", L"%d файлов" });
+		CHECK(entries[0].second.m_translation == L"%d файл");
+		CHECK(entries[0].second.m_translation_plural == L"%d файла");
+		CHECK(entries[0].second.m_issues.empty());
+
+		REQUIRE(entries[1].second.m_issues.size() == 1);
+		CHECK(entries[1].second.m_issues[0].first == translation_issue::malformed_translation);
+		CHECK(entries[1].second.m_issues[0].second.starts_with(L"msgstr[2]"));
+
+		REQUIRE(entries[2].second.m_issues.size() == 1);
+		CHECK(entries[2].second.m_issues[0].first == translation_issue::printf_issue);
+		}
+
+	SECTION("Accelerator mismatch")
+		{
+		mo_file_review mo(false);
+		mo.set_style(check_accelerators);
+		const auto data = build_mo({ { "&Server", "\xD0\xA1\xD0\xB5\xD1\x80\xD0\xB2\xD0\xB5\xD1\x80" } });
+		CHECK(mo.load_catalog(data, L"test.mo"));
+		mo.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		const auto issues = std::count_if(
+			mo.get_catalog_entries().cbegin(), mo.get_catalog_entries().cend(), [](const auto& ent)
+			{ return ent.second.m_issues.size() > 0; });
+		CHECK(issues == 1);
+		}
+	}
+// NOLINTEND
+// clang-format on
@@ -1,7 +1,10 @@
 #include "../src/po_file_review.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <chrono>
+#include <string>
 
 // NOLINTBEGIN
 using namespace i18n_check;
@@ -31,6 +34,439 @@ msgstr "<%1> text")";
 		}
 	}
 
+TEST_CASE("Catalog entries", "[po][l10n]")
+	{
+	SECTION("Multiline, comments, and context")
+		{
+		po_file_review po(false);
+		const wchar_t* code = LR"(msgid ""
+msgstr ""
+"Content-Type: text/plain; charset=UTF-8\n"
+
+#. TRANSLATORS: The file's name
+#. and its path.
+#: ../src/common/file.cpp:604
+#, fuzzy, c-format
+msgctxt "Dialog"
+msgid "Can't open %s."
+msgstr "No se puede abrir %s."
+
+#: ../src/common/file.cpp:605
+#, c-format
+#| msgid "Old %s"
+msgid ""
+"Can't open "
+"\"%s\"."
+msgstr "No se puede abrir "
+  "\"%s\"."
+
+#: ../src/common/file.cpp:606
+#, qt-format, no-c-format
+msgid "%n file"
+msgid_plural "%n files"
+msgstr[0] "%n archivo"
+msgstr[1] "%n archivos"
+
+#~ msgid "Obsolete"
+#~ msgstr "Obsoleto")";
+		po(code, L"");
+
+		REQUIRE(po.get_catalog_entries().size() == 2);
+		const auto& entries = po.get_catalog_entries();
+		CHECK(entries[0].second.m_source == LR"(Can't open \"%s\".)");
+		CHECK(entries[0].second.m_translation == LR"(No se puede abrir \"%s\".)");
+		CHECK(entries[0].second.m_po_format == po_format_string::cpp_format);
+		CHECK(entries[0].second.m_line == 12);
+		CHECK(entries[1].second.m_source == L"%n file");
+		CHECK(entries[1].second.m_source_plural == L"%n files");
+		CHECK(entries[1].second.m_translation == L"%n archivo");
+		CHECK(entries[1].second.m_translation_plural == L"%n archivos");
+		CHECK(entries[1].second.m_po_format == po_format_string::qt_format);
+		CHECK(entries[1].second.m_line == 21);
+		}
+
+	SECTION("Fuzzy, comments, and CRLF")
+		{
+		po_file_review po(false);
+		po.review_fuzzy_translations(true);
+		const wchar_t* code = L"msgid \"\"\r\nmsgstr \"\"\r\n\r\n"
+			"#. TRANSLATORS: The file's name\r\n#. and its path.\r\n#, fuzzy, c-format\r\n"
+			"msgctxt \"Dialog\"\r\nmsgid \"Can't open %s.\"\r\nmsgstr \"\"\r\n\"No se puede \"\r\n\"abrir %s.\"\r\n\r\n"
+			"#, c-format\r\nmsgid \"C:\\\\\"\r\nmsgstr \"C:\\\\\"\r\n";
+		po(code, L"");
+
+		REQUIRE(po.get_catalog_entries().size() == 2);
+		const auto& entries = po.get_catalog_entries();
+		CHECK(entries[0].second.m_source == L"Can't open %s.");
+		CHECK(entries[0].second.m_translation == L"No se puede abrir %s.");
+		CHECK(entries[0].second.m_comment == L"TRANSLATORS: The file's name and its path.Dialog");
+		CHECK(entries[0].second.m_po_format == po_format_string::cpp_format);
+		CHECK(entries[0].second.m_line == 4);
+		CHECK(entries[1].second.m_source == LR"(C:\\)");
+		CHECK(entries[1].second.m_translation == LR"(C:\\)");
+		CHECK(entries[1].second.m_line == 13);
+		}
+	}
+
+TEST_CASE("Streaming", "[po][l10n]")
+	{
+	const wchar_t* code = LR"(msgid ""
+msgstr ""
+"Content-Type: text/plain; charset=UTF-8\n"
+
+#: ../src/common/file.cpp:604
+msgid "&Server"
+msgstr "Сервер"
+
+#: ../src/common/file.cpp:605
+#, c-format
+msgid "Can't open %s."
+msgstr "No se puede abrir %d."
+
+#: ../src/common/file.cpp:606
+msgid "Open"
+msgstr "Abrir")";
+
+	po_file_review po(false);
+	po(code, L"file.po");
+	po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+	REQUIRE(po.get_catalog_entries().size() == 3);
+
+	std::vector<std::pair<std::filesystem::path, translation_catalog_entry>> streamedEntries;
+	po_file_review streamingPo(false);
+	streamingPo.stream_catalog_entries(
+		[&streamedEntries](const auto& catEntry)
+		{
+		streamedEntries.push_back(catEntry);
+		});
+	streamingPo(code, L"file.po");
+
+	// entries are reviewed as they are read, and not kept
+	CHECK(streamingPo.get_catalog_entries().empty());
+	CHECK(streamingPo.get_streamed_entry_count() == 3);
+	REQUIRE(streamedEntries.size() == 3);
+	for (size_t i = 0; i < streamedEntries.size(); ++i)
+		{
+		CHECK(streamedEntries[i].first == L"file.po");
+		CHECK(streamedEntries[i].second.m_source == po.get_catalog_entries()[i].second.m_source);
+		CHECK(streamedEntries[i].second.m_line == po.get_catalog_entries()[i].second.m_line);
+		CHECK(streamedEntries[i].second.m_issues == po.get_catalog_entries()[i].second.m_issues);
+		}
+	CHECK(streamedEntries[0].second.m_issues.size() == 1);
+	CHECK(streamedEntries[1].second.m_issues.size() == 1);
+	CHECK(streamedEntries[2].second.m_issues.empty());
+
+	streamingPo.clear_results();
+	CHECK(streamingPo.get_streamed_entry_count() == 0);
+
+	// turning streaming off stores the entries again
+	streamingPo.stream_catalog_entries(nullptr);
+	streamingPo(code, L"file.po");
+	CHECK(streamingPo.get_catalog_entries().size() == 3);
+	CHECK(streamingPo.get_streamed_entry_count() == 0);
+	}
+
+TEST_CASE("Source issues shared across catalogs", "[po][l10n]")
+	{
+	po_file_review po(false);
+	po(LR"(msgid ""
+msgstr ""
+
+#, c-format
+msgid "See https://www.example.com for %s."
+msgstr "Ver https://www.example.com para %s.")", L"es.po");
+	po(LR"(msgid ""
+msgstr ""
+
+#, c-format
+msgid "See https://www.example.com for %s."
+msgstr "Voir https://www.example.com pour %d.")", L"fr.po");
+	po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+	REQUIRE(po.get_catalog_entries().size() == 2);
+	const auto& entries = po.get_catalog_entries();
+	// the source issue is found once, but attached to both catalogs...
+	REQUIRE(entries[0].second.m_issues.size() == 1);
+	CHECK(entries[0].second.m_issues[0].first == translation_issue::suspect_source_issue);
+	CHECK(entries[0].second.m_issues[0].second == L"See https://www.example.com for %s.");
+	// ...while the translation issues are still specific to each catalog
+	REQUIRE(entries[1].second.m_issues.size() == 2);
+	CHECK(entries[1].second.m_issues[0] == entries[0].second.m_issues[0]);
+	CHECK(entries[1].second.m_issues[1].first == translation_issue::printf_issue);
+	CHECK(translation_catalog_review::is_source_issue(entries[1].second.m_issues[0].first));
+	CHECK_FALSE(translation_catalog_review::is_source_issue(entries[1].second.m_issues[1].first));
+	}
+
+TEST_CASE("Reloading catalogs", "[po][l10n]")
+	{
+	const wchar_t* spanishCatalog = LR"(msgid ""
+msgstr ""
+
+#, c-format
+msgid "Can't open %s."
+msgstr "No se puede abrir %d.")";
+	const wchar_t* frenchCatalog = LR"(msgid ""
+msgstr ""
+
+#, c-format
+msgid "Can't open %s."
+msgstr "Impossible d'ouvrir %d."
+
+#, c-format
+msgid "Can't save %s."
+msgstr "Impossible d'enregistrer %d.")";
+
+	po_file_review po(false);
+	size_t reviewCount{ 0 };
+	const auto resetCallback = [&reviewCount](const size_t count) { reviewCount = count; };
+	const auto callback = [](size_t, const std::filesystem::path&) { return true; };
+	po(spanishCatalog, L"es.po");
+	po(frenchCatalog, L"fr.po");
+	po.review_strings(resetCallback, callback);
+	CHECK(reviewCount == 3);
+	REQUIRE(po.get_catalog_entries().size() == 3);
+
+	// reload the catalog that was loaded (and reviewed) first, with its issue fixed
+	po.clear_file_results(L"es.po");
+	REQUIRE(po.get_catalog_entries().size() == 2);
+	po(LR"(msgid ""
+msgstr ""
+
+#, c-format
+msgid "Can't open %s."
+msgstr "No se puede abrir %s.")", L"es.po");
+	po.review_strings(resetCallback, callback);
+	// only the reloaded entry is reviewed again...
+	CHECK(reviewCount == 1);
+	const auto& entries = po.get_catalog_entries();
+	REQUIRE(entries.size() == 3);
+	// ...and the other catalog's issues aren't duplicated
+	CHECK(entries[0].first == L"fr.po");
+	CHECK(entries[0].second.m_issues.size() == 1);
+	CHECK(entries[1].first == L"fr.po");
+	CHECK(entries[1].second.m_issues.size() == 1);
+	CHECK(entries[2].first == L"es.po");
+	CHECK(entries[2].second.m_issues.empty());
+
+	// nothing is left to review
+	po.review_strings(resetCallback, callback);
+	CHECK(reviewCount == 0);
+
+	// removing a catalog that sorts after the others
+	po.clear_file_results(L"fr.po");
+	REQUIRE(po.get_catalog_entries().size() == 1);
+	po(frenchCatalog, L"fr.po");
+	po.review_strings(resetCallback, callback);
+	CHECK(reviewCount == 2);
+	REQUIRE(po.get_catalog_entries().size() == 3);
+	CHECK(po.get_catalog_entries()[0].second.m_issues.empty());
+	CHECK(po.get_catalog_entries()[1].second.m_issues.size() == 1);
+	CHECK(po.get_catalog_entries()[2].second.m_issues.size() == 1);
+	}
+
+TEST_CASE("Plural forms", "[po][l10n]")
+	{
+	SECTION("Expressions")
+		{
+		const plural_forms english(L"nplurals=2; plural=(n != 1);");
+		CHECK(english.is_valid());
+		CHECK(english.get_plural_count() == 2);
+		CHECK(english.evaluate(0) == 1);
+		CHECK(english.evaluate(1) == 0);
+		CHECK(english.evaluate(2) == 1);
+		CHECK(english.get_sample_numbers() == std::vector<size_t>{ 1, 0 });
+		CHECK(english.get_first_out_of_range_number() == plural_forms::npos);
+		CHECK(english.is_used_by_one_number(0));
+		CHECK_FALSE(english.is_used_by_one_number(1));
+
+		const plural_forms russian(L"nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : "
+			"n%10>=2 && n%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);");
+		CHECK(russian.is_valid());
+		CHECK(russian.get_plural_count() == 3);
+		CHECK(russian.evaluate(1) == 0);
+		CHECK(russian.evaluate(11) == 2);
+		CHECK(russian.evaluate(21) == 0);
+		CHECK(russian.evaluate(22) == 1);
+		CHECK(russian.evaluate(112) == 2);
+		CHECK(russian.get_sample_numbers() == std::vector<size_t>{ 1, 2, 0 });
+
+		const plural_forms arabic(L"nplurals=6; plural=n==0 ? 0 : n==1 ? 1 : n==2 ? 2 : "
+			"n%100>=3 && n%100<=10 ? 3 : n%100>=11 ? 4 : 5;");
+		CHECK(arabic.get_sample_numbers() == std::vector<size_t>{ 0, 1, 2, 3, 11, 100 });
+
+		const plural_forms japanese(L"nplurals=1; plural=0;");
+		CHECK(japanese.get_sample_numbers() == std::vector<size_t>{ 0 });
+
+		// form 2 is never used, and form 2 is beyond nplurals
+		const plural_forms unusedForm(L"nplurals=3; plural=(n==1 ? 0 : 1);");
+		CHECK(unusedForm.get_sample_numbers() == std::vector<size_t>{ 1, 0, plural_forms::npos });
+		const plural_forms outOfRange(L"nplurals=2; plural=(n>1 ? 2 : 0);");
+		CHECK(outOfRange.get_first_out_of_range_number() == 2);
+		// the right side of || isn't evaluated when the left side is true
+		const plural_forms divideByZero(L"nplurals=2; plural=(n!=1 || n/0);");
+		CHECK(divideByZero.evaluate(0) == 1);
+		CHECK(divideByZero.evaluate(1) == plural_forms::npos);
+		CHECK(divideByZero.get_first_out_of_range_number() == 1);
+
+		CHECK_FALSE(plural_forms(L"nplurals=2; plural=(n != 1;").is_valid());
+		CHECK_FALSE(plural_forms(L"nplurals=2; plural=n << 1;").is_valid());
+		CHECK_FALSE(plural_forms(L"nplurals=0; plural=0;").is_valid());
+		CHECK_FALSE(plural_forms(L"plural=(n != 1);").is_valid());
+		CHECK(plural_forms(L"nplurals=2; plural=(n != 1);").evaluate(2) == 1);
+
+		const plural_forms doubleNot(L"nplurals=2; plural=!!n;");
+		CHECK(doubleNot.is_valid());
+		CHECK(doubleNot.evaluate(0) == 0);
+		CHECK(doubleNot.evaluate(5) == 1);
+		CHECK(plural_forms(L"nplurals=2; plural=!(!n);").is_valid());
+		}
+
+	SECTION("Deeply nested expressions")
+		{
+		const auto nested = [](const size_t depth, const std::wstring& open,
+			const std::wstring& close)
+			{
+			std::wstring expression{ L"nplurals=2; plural=" };
+			for (size_t i = 0; i < depth; ++i)
+				{
+				expression += open;
+				}
+			expression += L"n";
+			for (size_t i = 0; i < depth; ++i)
+				{
+				expression += close;
+				}
+			return expression + L";";
+			};
+		CHECK(plural_forms(nested(50, L"(", L")")).is_valid());
+		CHECK(plural_forms(nested(50, L"! ", L"")).is_valid());
+		CHECK(plural_forms(nested(50, L"n==1 ? 0 : ", L"")).is_valid());
+		// malformed, rather than overflowing the stack
+		CHECK_FALSE(plural_forms(nested(100'000, L"(", L")")).is_valid());
+		CHECK_FALSE(plural_forms(nested(100'000, L"!", L"")).is_valid());
+		CHECK_FALSE(plural_forms(nested(100'000, L"n==1 ? 0 : ", L"")).is_valid());
+		CHECK_FALSE(plural_forms(nested(100'000, L"(", L"")).is_valid());
+		}
+
+	SECTION("Catalog")
+		{
+		po_file_review po(false);
+		const wchar_t* code = LR"(msgid ""
+msgstr ""
+"Content-Type: text/plain; charset=UTF-8\n"
+"Plural-Forms: nplurals=3; plural=(n%10==1 && n%100!=11 ? 0 : n%10>=2 && n"
+"%10<=4 && (n%100<10 || n%100>=20) ? 1 : 2);\n"
+
+#, c-format
+msgid "%d file"
+msgid_plural "%d files"
+msgstr[0] "%d файл"
+msgstr[1] "%d файла"
+msgstr[2] "%d файлов"
+
+#, c-format
+msgid "%d folder"
+msgid_plural "%d folders"
+msgstr[0] "%d папка"
+msgstr[1] "%d папки"
+
+#, c-format
+msgid "%d item"
+msgid_plural "%d items"
+msgstr[0] "%d элемент"
+msgstr[1] "%d элемента"
+msgstr[2] "%s элементов"
+
+#, c-format
+msgid "%d user"
+msgid_plural "%d users"
+msgstr[0] ""
+msgstr[1] ""
+msgstr[2] "")";
+		po(code, L"ru.po");
+		po(code, L"uk.po");
+		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		REQUIRE(po.get_catalog_entries().size() == 8);
+		const auto& entries = po.get_catalog_entries();
+		// catalogs with the same header share the compiled expression
+		REQUIRE(entries[0].second.m_plural_forms != nullptr);
+		CHECK(entries[0].second.m_plural_forms == entries[4].second.m_plural_forms);
+		CHECK(entries[0].second.m_plural_forms->get_plural_count() == 3);
+
+		CHECK(entries[0].second.m_translation_plural_forms ==
+			std::vector<std::wstring>{ L"%d файл", L"%d файла", L"%d файлов" });
+		CHECK(entries[0].second.m_issues.empty());
+
+		REQUIRE(entries[1].second.m_issues.size() == 1);
+		CHECK(entries[1].second.m_issues[0].first == translation_issue::malformed_translation);
+		CHECK(entries[1].second.m_issues[0].second.starts_with(L"msgstr[2]"));
+
+		REQUIRE(entries[2].second.m_issues.size() == 1);
+		CHECK(entries[2].second.m_issues[0].first == translation_issue::printf_issue);
+
+		// untranslated entries aren't reviewed
+		CHECK(entries[3].second.m_issues.empty());
+		}
+
+	SECTION("Unused plural form")
+		{
+		po_file_review po(false);
+		const wchar_t* code = LR"(msgid ""
+msgstr ""
+"Plural-Forms: nplurals=3; plural=(n==1 ? 0 : 1);\n"
+
+#, c-format
+msgid "%d file"
+msgid_plural "%d files"
+msgstr[0] "%d fichier"
+msgstr[1] "%d fichiers"
+
+#, c-format
+msgid "%d folder"
+msgid_plural "%d folders"
+msgstr[0] "%d dossier"
+msgstr[1] "%d dossiers")";
+		po(code, L"fr.po");
+		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		REQUIRE(po.get_catalog_entries().size() == 2);
+		// reported once for the catalog, and the unused form isn't expected to be translated
+		REQUIRE(po.get_catalog_entries()[0].second.m_issues.size() == 1);
+		CHECK(po.get_catalog_entries()[0].second.m_issues[0].first ==
+			translation_issue::malformed_translation);
+		CHECK(po.get_catalog_entries()[1].second.m_issues.empty());
+		}
+
+	SECTION("Many plural forms")
+		{
+		po_file_review po(false);
+		std::wstring code{ LR"(msgid ""
+msgstr ""
+"Plural-Forms: nplurals=12; plural=n%12;\n"
+
+#, c-format
+msgid "%d file"
+msgid_plural "%d files"
+)" };
+		std::vector<std::wstring> expectedTranslations;
+		for (size_t i = 0; i < 12; ++i)
+			{
+			expectedTranslations.push_back(L"%d file " + std::wstring(i + 1, L's'));
+			code += L"msgstr[" + std::to_wstring(i) + L"] \"" + expectedTranslations.back() +
+				L"\"\n";
+			}
+		po(code, L"xx.po");
+		po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+		// msgstr[10] and later aren't dropped
+		REQUIRE(po.get_catalog_entries().size() == 1);
+		CHECK(po.get_catalog_entries()[0].second.m_translation_plural_forms ==
+			expectedTranslations);
+		CHECK(po.get_catalog_entries()[0].second.m_issues.empty());
+		}
+	}
+
 TEST_CASE("Accelerator Mismatch", "[po][l10n]")
 	{
 	SECTION("Real")
@@ -634,6 +1070,41 @@ msgstr "%d%d ﾂｱ 0x%02x｡")";
 	CHECK(issues == 1);
 	}
 
+TEST_CASE("Untranslatable names", "[po][l10n]")
+	{
+	po_file_review po(false);
+	po.set_style(check_consistency);
+	const wchar_t* code = LR"(
+
+#: ../src/common/file.cpp:604
+msgid "Install Java and the Jakarta EE runtime."
+msgstr "Installez Java et le runtime Jakarta."
+
+#: ../src/common/file.cpp:605
+msgid "Install Java (Jakarta EE)."
+msgstr "Installez Java (Jakarta EE)."
+
+#: ../src/common/file.cpp:606
+msgid "JavaScript and Javanese are not names to keep."
+msgstr "JavaScript et javanais ne sont pas des noms."
+
+#: ../src/common/file.cpp:607
+msgid "Java, Java, and Java."
+msgstr "Java et Java.")";
+
+	po(code, L"");
+	po.review_strings([](size_t){}, [](size_t, const std::filesystem::path&){ return true; });
+
+	REQUIRE(po.get_catalog_entries().size() == 4);
+	const auto& entries = po.get_catalog_entries();
+	REQUIRE(entries[0].second.m_issues.size() == 1);
+	CHECK(entries[0].second.m_issues[0].second.starts_with(L"'Jakarta EE'"));
+	CHECK(entries[1].second.m_issues.empty());
+	CHECK(entries[2].second.m_issues.empty());
+	REQUIRE(entries[3].second.m_issues.size() == 1);
+	CHECK(entries[3].second.m_issues[0].second.starts_with(L"'Java'"));
+	}
+
 TEST_CASE("Printf c-format positionals", "[po][l10n]")
 	{
 	SECTION("C-format positionals")
@@ -708,5 +1179,57 @@ msgstr "Неправильный %u %2$s")";
 		CHECK(issues == 1);
 		}
 	}
+
+// run with "[!benchmark]"
+TEST_CASE("Catalog parsing benchmark", "[po][l10n][!benchmark]")
+	{
+	constexpr size_t entryCount{ 5'000 };
+	std::wstring catalog{ LR"(msgid ""
+msgstr ""
+"Content-Type: text/plain; charset=UTF-8\n"
+"Plural-Forms: nplurals=2; plural=(n != 1);\n"
+)" };
+	// commented, formatted entries, with every tenth one being a plural
+	for (size_t i = 0; i < entryCount; ++i)
+		{
+		const std::wstring number{ std::to_wstring(i) };
+		catalog += L"\n#. TRANSLATORS: Shown in the status bar.\n#: ../src/file" + number + L".cpp:" +
+			number + L"\n#, c-format\n";
+		if (i % 10 == 0)
+			{
+			catalog += L"msgid \"%zu file in folder " + number + L"\"\n"
+				L"msgid_plural \"%zu files in folder " + number + L"\"\n"
+				L"msgstr[0] \"%zu archivo en la carpeta " + number + L"\"\n"
+				L"msgstr[1] \"%zu archivos en la carpeta " + number + L"\"\n";
+			}
+		else
+			{
+			catalog += L"msgid \"Can't open the file %s (" + number + L").\"\n"
+				L"msgstr \"No se puede abrir el archivo %s (" + number + L").\"\n";
+			}
+		}
+
+	po_file_review po(false);
+	BENCHMARK("Load")
+		{
+		po.clear_results();
+		po(catalog, L"messages.po");
+		return po.get_catalog_entries().size();
+		};
+
+	// the throughput (reviewing is timed once, as it is much slower than loading),
+	// to compare with the size of a real project's catalogs
+	po.clear_results();
+	const auto loadStart{ std::chrono::steady_clock::now() };
+	po(catalog, L"messages.po");
+	const auto reviewStart{ std::chrono::steady_clock::now() };
+	po.review_strings([](size_t) {}, [](size_t, const std::filesystem::path&) { return true; });
+	const auto reviewEnd{ std::chrono::steady_clock::now() };
+	REQUIRE(po.get_catalog_entries().size() == entryCount);
+	const std::chrono::duration<double> loadTime{ reviewStart - loadStart };
+	const std::chrono::duration<double> reviewTime{ reviewEnd - reviewStart };
+	WARN(static_cast<size_t>(entryCount / loadTime.count()) << " entries loaded per second, " <<
+		static_cast<size_t>(entryCount / reviewTime.count()) << " entries reviewed per second");
+	}
 // NOLINTEND
 // clang-format on
@@ -693,4 +693,115 @@ TEST_CASE("Suspicious absolute paths in Markdown destinations",
         }
     }
 
+TEST_CASE("Quarto tokenizing", "[quarto][tokenize]")
+    {
+    SECTION("Line numbers after blanked sections")
+        {
+        quarto_review qr;
+        qr.set_style(check_malformed_strings);
+
+        const std::wstring code = L"Intro line.\r\n"
+                                  L"```\r\nPages 1-5\r\n```\r\n"
+                                  L"$$\r\nx = 3-4\r\n$$\r\n"
+                                  L"See pages 10-20 and $a-b$ too.";
+
+        qr(code, L"lines.qmd");
+
+        const auto& issues = qr.get_range_dash_issues();
+        REQUIRE(issues.size() == 1);
+        CHECK(issues[0].m_string == L"10-20");
+        CHECK(issues[0].m_line == 8);
+        CHECK(issues[0].m_column == 11);
+        }
+
+    SECTION("Earliest section wins")
+        {
+        quarto_review qr;
+        qr.set_style(check_malformed_strings);
+
+        // the dollar sign inside of the code fence does not start a math section
+        const wchar_t* code = LR"(
+```
+echo $HOME
+```
+Pages 5-9 cost $5.
+)";
+
+        qr(code, L"earliest.qmd");
+
+        const auto& issues = qr.get_range_dash_issues();
+        REQUIRE(issues.size() == 1);
+        CHECK(issues[0].m_string == L"5-9");
+        CHECK(issues[0].m_line == 5);
+        }
+
+    SECTION("Unclosed sections are not blanked")
+        {
+        quarto_review qr;
+        qr.set_style(check_malformed_strings);
+
+        const wchar_t* code = LR"(
+```
+Pages 1-2
+<!-- quneiform-suppress-begin -->
+See [help](/docs/help.md)
+)";
+
+        qr(code, L"unclosed.qmd");
+
+        CHECK(qr.get_range_dash_issues().size() == 1);
+        REQUIRE(qr.get_absolute_path_links().size() == 1);
+        CHECK(qr.get_absolute_path_links()[0].m_string == L"[help](/docs/help.md)");
+        CHECK(qr.get_absolute_path_links()[0].m_line == 5);
+        }
+
+    SECTION("Prose checks")
+        {
+        quarto_review qr;
+        qr.set_style(static_cast<review_style>(check_malformed_strings | check_l10n_strings));
+
+        const wchar_t* code = LR"(
+The quick brown
+fox jumps. Then it ran.
+{{< pagebreak >}}
+Next page.
+)";
+
+        qr(code, L"prose.qmd");
+
+        REQUIRE(qr.get_multi_line_sentences().size() == 1);
+        CHECK(qr.get_multi_line_sentences()[0].m_string == L"brown\nfo");
+        CHECK(qr.get_multi_line_sentences()[0].m_line == 2);
+        CHECK(qr.get_multi_line_sentences()[0].m_column == 11);
+        REQUIRE(qr.get_multi_sentence_lines().size() == 1);
+        CHECK(qr.get_multi_sentence_lines()[0].m_string == L"jumps. T");
+        CHECK(qr.get_multi_sentence_lines()[0].m_line == 3);
+        REQUIRE(qr.get_malformed_content().size() == 1);
+        CHECK(qr.get_malformed_content()[0].m_string == L"{{< pagebreak >}}");
+        CHECK(qr.get_malformed_content()[0].m_line == 4);
+        }
+
+    SECTION("Large document")
+        {
+        quarto_review qr;
+        qr.set_style(check_malformed_strings);
+
+        std::wstring code;
+        for (size_t i = 0; i < 5'000; ++i)
+            {
+            code += L"Some prose with a [link](page.html) and $x$ math.\n"
+                    L"```\ncode 1-2\n```\n";
+            }
+        code += L"Last pages 3-4 and ![image](/img/last.png)\n";
+
+        qr(code, L"large.qmd");
+
+        REQUIRE(qr.get_range_dash_issues().size() == 1);
+        CHECK(qr.get_range_dash_issues()[0].m_line == 20'001);
+        REQUIRE(qr.get_absolute_path_links().size() == 1);
+        CHECK(qr.get_absolute_path_links()[0].m_line == 20'001);
+        CHECK(qr.get_absolute_path_links()[0].m_column == 20);
+        }
+    }
+
 // NOLINTEND
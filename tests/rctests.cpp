@@ -48,6 +48,40 @@ END)";
 		CHECK(rc.get_unsafe_localizable_strings()[0].m_string == L"image.bmp");
 		CHECK(rc.get_unsafe_localizable_strings()[1].m_string == L"%s");
 		}
+
+	SECTION("Lexing")
+		{
+		rc_file_review rc(false);
+		const wchar_t* code = LR"(// STRINGTABLE { IDS_COMMENTED "Commented out" }
+#include "resource.h"
+STRINGTABLE DISCARDABLE
+BEGIN
+    IDS_QUOTED,  "Say ""Hello"" to END users" // trailing "comment"
+    /* IDS_OLD   "Removed string" */
+    IDS_BRACE    "Open { and close }"
+END
+CAPTION "Not in a string table")";
+		rc(code, L"");
+		REQUIRE(rc.get_localizable_strings().size() == 2);
+		CHECK(rc.get_localizable_strings()[0].m_string == LR"(Say ""Hello"" to END users)");
+		CHECK(rc.get_localizable_strings()[0].m_line == 5);
+		CHECK(rc.get_localizable_strings()[1].m_string == L"Open { and close }");
+		CHECK(rc.get_localizable_strings()[1].m_line == 7);
+		}
+
+	SECTION("Large table")
+		{
+		rc_file_review rc(false);
+		std::wstring code{ L"STRINGTABLE\r\nBEGIN\r\n" };
+		for (size_t i = 0; i < 30'000; ++i)
+			{
+			code.append(L"    IDS_STRING").append(std::to_wstring(i)).append(L" \"Open file\"\r\n");
+			}
+		code.append(L"END\r\n");
+		rc(code, L"");
+		REQUIRE(rc.get_localizable_strings().size() == 30'000);
+		CHECK(rc.get_localizable_strings().back().m_line == 30'002);
+		}
 	}
 
 TEST_CASE("Fonts", "[rc][i18n]")
@@ -80,6 +114,21 @@ BEGIN)";
 		REQUIRE(rc.get_non_system_dialog_fonts().size() == 1);
 		CHECK(rc.get_non_system_dialog_fonts()[0].m_string == LR"(Comic Sans)");
 	}
+
+	SECTION("Hex size and spacing")
+	{
+		rc_file_review rc(false);
+		const wchar_t* code = LR"(IDD_ABOUTBOX DIALOGEX 0, 0, 170, 184
+CAPTION "FONT 20, ""Arial"""
+FONT 0x12 , "MS Shell Dlg 2"
+BEGIN
+END)";
+		rc(code, L"");
+		REQUIRE(rc.get_bad_dialog_font_sizes().size() == 1);
+		CHECK(rc.get_bad_dialog_font_sizes()[0].m_string == LR"(18)");
+		CHECK(rc.get_bad_dialog_font_sizes()[0].m_line == 3);
+		CHECK(rc.get_non_system_dialog_fonts().empty());
+	}
 }
 // NOLINTEND
 // clang-format on